@@ -523,6 +523,298 @@ namespace etl
     return binary_search(first, last, value, compare());
   }
 
+#include "private/diagnostic_float_equal_push.h"
+  namespace private_algorithm
+  {
+    //***************************************************************************
+    /// Block kernels for contiguous arithmetic ranges.
+    /// Each block is tested with a fixed length loop that has no early exit,
+    /// which the compiler can turn into SIMD compares for the target (SSE2,
+    /// AVX2, NEON, ...). Only the block that holds the answer is rescanned
+    /// element by element. Disabled by ETL_NO_ALGORITHM_BLOCK_KERNELS.
+    //***************************************************************************
+    template <typename T>
+    struct block_size
+    {
+      static ETL_CONSTANT size_t value = (sizeof(T) < 64U) ? (64U / sizeof(T)) : 1U;
+
+      /// Hits are counted rather than OR'd, in a counter as wide as the element, as that is the form compilers vectorise.
+      typedef typename etl::conditional<sizeof(T) == 1U, uint8_t,
+              typename etl::conditional<sizeof(T) == 2U, uint16_t,
+              typename etl::conditional<sizeof(T) == 4U, uint32_t, uint64_t>::type>::type>::type counter_type;
+    };
+
+    template <typename T>
+    ETL_CONSTANT size_t block_size<T>::value;
+
+    //*********************************
+    /// Is TIterator a pointer to an arithmetic type, compared with a value of the same type?
+    template <typename TIterator, typename T = typename etl::iterator_traits<TIterator>::value_type>
+    struct use_block_kernel
+      : etl::integral_constant<bool, (ETL_HAS_ALGORITHM_BLOCK_KERNELS == 1) &&
+                                     etl::is_pointer<TIterator>::value &&
+                                     etl::is_arithmetic<typename etl::remove_cv<typename etl::remove_pointer<TIterator>::type>::type>::value &&
+                                     etl::is_same<typename etl::remove_cv<typename etl::remove_pointer<TIterator>::type>::type, typename etl::remove_cv<T>::type>::value>
+    {
+    };
+
+    //*********************************
+    /// Are TIterator1 and TIterator2 pointers to the same arithmetic type?
+    template <typename TIterator1, typename TIterator2>
+    struct use_block_kernel2
+      : etl::integral_constant<bool, etl::is_pointer<TIterator2>::value &&
+                                     use_block_kernel<TIterator1, typename etl::remove_pointer<TIterator2>::type>::value>
+    {
+    };
+
+    //*********************************
+    /// Is TIterator a pointer to an integral type?
+    /// Floating point is excluded from min/max so that NaN ordering stays as for the generic loop.
+    template <typename TIterator>
+    struct use_integral_block_kernel
+      : etl::integral_constant<bool, use_block_kernel<TIterator>::value &&
+                                     etl::is_integral<typename etl::remove_pointer<TIterator>::type>::value>
+    {
+    };
+
+    //*********************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    T* find_block(T* first, T* last, const typename etl::remove_cv<T>::type& value)
+    {
+      const size_t Block = block_size<T>::value;
+
+      while (size_t(last - first) >= Block)
+      {
+        typename block_size<T>::counter_type hits = 0U;
+
+        for (size_t i = 0U; i < Block; ++i)
+        {
+          hits += (first[i] == value) ? 1U : 0U;
+        }
+
+        if (hits != 0U)
+        {
+          break;
+        }
+
+        first += Block;
+      }
+
+      while ((first != last) && !(*first == value))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*********************************
+    /// Finds the last element equal to 'value', or 'last' if there is none.
+    template <typename T>
+    ETL_CONSTEXPR14
+    T* find_last_block(T* first, T* last, const typename etl::remove_cv<T>::type& value)
+    {
+      const size_t Block = block_size<T>::value;
+
+      T* end = last;
+
+      while (size_t(end - first) >= Block)
+      {
+        typename block_size<T>::counter_type hits = 0U;
+
+        for (size_t i = 1U; i <= Block; ++i)
+        {
+          hits += (*(end - i) == value) ? 1U : 0U;
+        }
+
+        if (hits != 0U)
+        {
+          break;
+        }
+
+        end -= Block;
+      }
+
+      while (end != first)
+      {
+        --end;
+
+        if (*end == value)
+        {
+          return end;
+        }
+      }
+
+      return last;
+    }
+
+    //*********************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    ptrdiff_t count_block(T* first, T* last, const typename etl::remove_cv<T>::type& value)
+    {
+      const size_t Block = block_size<T>::value;
+
+      ptrdiff_t n = 0;
+
+      while (size_t(last - first) >= Block)
+      {
+        typename block_size<T>::counter_type hits = 0U;
+
+        for (size_t i = 0U; i < Block; ++i)
+        {
+          hits += (first[i] == value) ? 1U : 0U;
+        }
+
+        n     += ptrdiff_t(hits);
+        first += Block;
+      }
+
+      while (first != last)
+      {
+        n += (*first == value) ? 1 : 0;
+        ++first;
+      }
+
+      return n;
+    }
+
+    //*********************************
+    /// The smallest value in a non-empty range.
+    template <typename T>
+    ETL_CONSTEXPR14
+    typename etl::remove_cv<T>::type min_value_block(T* first, T* last)
+    {
+      typedef typename etl::remove_cv<T>::type value_t;
+
+      const size_t Block = block_size<T>::value;
+
+      value_t minimum = *first;
+
+      if (size_t(last - first) >= Block)
+      {
+        // One running min per lane.
+        value_t lanes[block_size<T>::value] = {};
+
+        for (size_t i = 0U; i < Block; ++i)
+        {
+          lanes[i] = first[i];
+        }
+
+        first += Block;
+
+        while (size_t(last - first) >= Block)
+        {
+          for (size_t i = 0U; i < Block; ++i)
+          {
+            lanes[i] = (first[i] < lanes[i]) ? first[i] : lanes[i];
+          }
+
+          first += Block;
+        }
+
+        for (size_t i = 0U; i < Block; ++i)
+        {
+          minimum = (lanes[i] < minimum) ? lanes[i] : minimum;
+        }
+      }
+
+      while (first != last)
+      {
+        minimum = (*first < minimum) ? *first : minimum;
+        ++first;
+      }
+
+      return minimum;
+    }
+
+    //*********************************
+    /// The largest value in a non-empty range.
+    template <typename T>
+    ETL_CONSTEXPR14
+    typename etl::remove_cv<T>::type max_value_block(T* first, T* last)
+    {
+      typedef typename etl::remove_cv<T>::type value_t;
+
+      const size_t Block = block_size<T>::value;
+
+      value_t maximum = *first;
+
+      if (size_t(last - first) >= Block)
+      {
+        // One running max per lane.
+        value_t lanes[block_size<T>::value] = {};
+
+        for (size_t i = 0U; i < Block; ++i)
+        {
+          lanes[i] = first[i];
+        }
+
+        first += Block;
+
+        while (size_t(last - first) >= Block)
+        {
+          for (size_t i = 0U; i < Block; ++i)
+          {
+            lanes[i] = (lanes[i] < first[i]) ? first[i] : lanes[i];
+          }
+
+          first += Block;
+        }
+
+        for (size_t i = 0U; i < Block; ++i)
+        {
+          maximum = (maximum < lanes[i]) ? lanes[i] : maximum;
+        }
+      }
+
+      while (first != last)
+      {
+        maximum = (maximum < *first) ? *first : maximum;
+        ++first;
+      }
+
+      return maximum;
+    }
+
+    //*********************************
+    /// Finds the first position where the ranges differ.
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR14
+    T1* mismatch_block(T1* first1, T1* last1, T2* first2)
+    {
+      const size_t Block = block_size<T1>::value;
+
+      while (size_t(last1 - first1) >= Block)
+      {
+        typename block_size<T1>::counter_type differences = 0U;
+
+        for (size_t i = 0U; i < Block; ++i)
+        {
+          differences += (first1[i] == first2[i]) ? 0U : 1U;
+        }
+
+        if (differences != 0U)
+        {
+          break;
+        }
+
+        first1 += Block;
+        first2 += Block;
+      }
+
+      while ((first1 != last1) && (*first1 == *first2))
+      {
+        ++first1;
+        ++first2;
+      }
+
+      return first1;
+    }
+  }
+#include "private/diagnostic_pop.h"
+
   //***************************************************************************
   // find_if
   //***************************************************************************
@@ -544,6 +836,37 @@ namespace etl
     return last;
   }
 
+#include "private/diagnostic_float_equal_push.h"
+  namespace private_algorithm
+  {
+    //*********************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14
+    TIterator find(TIterator first, TIterator last, const T& value, etl::false_type)
+    {
+      while (first != last)
+      {
+        if (*first == value)
+        {
+          return first;
+        }
+
+        ++first;
+      }
+
+      return last;
+    }
+
+    //*********************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14
+    TIterator find(TIterator first, TIterator last, const T& value, etl::true_type)
+    {
+      return private_algorithm::find_block(first, last, value);
+    }
+  }
+#include "private/diagnostic_pop.h"
+
   //***************************************************************************
   // find
   //***************************************************************************
@@ -552,17 +875,7 @@ namespace etl
   ETL_CONSTEXPR14
   TIterator find(TIterator first, TIterator last, const T& value)
   {
-    while (first != last)
-    {
-      if (*first == value)
-      {
-        return first;
-      }
-
-      ++first;
-    }
-
-    return last;
+    return private_algorithm::find(first, last, value, etl::integral_constant<bool, private_algorithm::use_block_kernel<TIterator, T>::value>());
   }
 
   //***************************************************************************
@@ -607,6 +920,39 @@ namespace etl
   }
 #endif
 
+#include "private/diagnostic_float_equal_push.h"
+  namespace private_algorithm
+  {
+    //*********************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14
+    typename etl::iterator_traits<TIterator>::difference_type count(TIterator first, TIterator last, const T& value, etl::false_type)
+    {
+      typename iterator_traits<TIterator>::difference_type n = 0;
+
+      while (first != last)
+      {
+        if (*first == value)
+        {
+          ++n;
+        }
+
+        ++first;
+      }
+
+      return n;
+    }
+
+    //*********************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14
+    typename etl::iterator_traits<TIterator>::difference_type count(TIterator first, TIterator last, const T& value, etl::true_type)
+    {
+      return private_algorithm::count_block(first, last, value);
+    }
+  }
+#include "private/diagnostic_pop.h"
+
   //***************************************************************************
   // count
   //***************************************************************************
@@ -615,19 +961,7 @@ namespace etl
   ETL_CONSTEXPR14
   typename etl::iterator_traits<TIterator>::difference_type count(TIterator first, TIterator last, const T& value)
   {
-    typename iterator_traits<TIterator>::difference_type n = 0;
-
-    while (first != last)
-    {
-      if (*first == value)
-      {
-        ++n;
-      }
-
-      ++first;
-    }
-
-    return n;
+    return private_algorithm::count(first, last, value, etl::integral_constant<bool, private_algorithm::use_block_kernel<TIterator, T>::value>());
   }
 
   //***************************************************************************
@@ -695,23 +1029,44 @@ namespace etl
 
 #else
 
-  template <typename TIterator1, typename TIterator2>
-  ETL_NODISCARD
-  ETL_CONSTEXPR14
-  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2)
+#include "private/diagnostic_float_equal_push.h"
+  namespace private_algorithm
   {
-    while (first1 != last1)
+    //*********************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, etl::false_type)
     {
-      if (*first1 != *first2)
+      while (first1 != last1)
       {
-        return false;
+        if (*first1 != *first2)
+        {
+          return false;
+        }
+
+        ++first1;
+        ++first2;
       }
 
-      ++first1;
-      ++first2;
+      return true;
     }
 
-    return true;
+    //*********************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, etl::true_type)
+    {
+      return private_algorithm::mismatch_block(first1, last1, first2) == last1;
+    }
+  }
+#include "private/diagnostic_pop.h"
+
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2)
+  {
+    return private_algorithm::equal(first1, last1, first2, etl::integral_constant<bool, private_algorithm::use_block_kernel2<TIterator1, TIterator2>::value>());
   }
 
   // Predicate
@@ -734,15 +1089,56 @@ namespace etl
     return true;
   }
 
+#include "private/diagnostic_float_equal_push.h"
+  namespace private_algorithm
+  {
+    //*********************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, etl::false_type)
+    {
+      while ((first1 != last1) && (first2 != last2))
+      {
+        if (*first1 != *first2)
+        {
+          return false;
+        }
+
+        ++first1;
+        ++first2;
+      }
+
+      return (first1 == last1) && (first2 == last2);
+    }
+
+    //*********************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, etl::true_type)
+    {
+      return ((last1 - first1) == (last2 - first2)) && (private_algorithm::mismatch_block(first1, last1, first2) == last1);
+    }
+  }
+#include "private/diagnostic_pop.h"
+
   // Four parameter
   template <typename TIterator1, typename TIterator2>
   ETL_NODISCARD
   ETL_CONSTEXPR14
   bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
+  {
+    return private_algorithm::equal(first1, last1, first2, last2, etl::integral_constant<bool, private_algorithm::use_block_kernel2<TIterator1, TIterator2>::value>());
+  }
+
+  // Four parameter, Predicate
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TPredicate predicate)
   {
     while ((first1 != last1) && (first2 != last2))
     {
-      if (*first1 != *first2)
+      if (!predicate(*first1 , *first2))
       {
         return false;
       }
@@ -753,27 +1149,124 @@ namespace etl
 
     return (first1 == last1) && (first2 == last2);
   }
+#endif
 
-  // Four parameter, Predicate
+#include "private/diagnostic_float_equal_push.h"
+  namespace private_algorithm
+  {
+    //*********************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, etl::false_type)
+    {
+      while ((first1 != last1) && (*first1 == *first2))
+      {
+        ++first1;
+        ++first2;
+      }
+
+      return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+    }
+
+    //*********************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, etl::true_type)
+    {
+      TIterator1 position = private_algorithm::mismatch_block(first1, last1, first2);
+
+      return ETL_OR_STD::pair<TIterator1, TIterator2>(position, first2 + (position - first1));
+    }
+
+    //*********************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, etl::false_type)
+    {
+      while ((first1 != last1) && (first2 != last2) && (*first1 == *first2))
+      {
+        ++first1;
+        ++first2;
+      }
+
+      return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+    }
+
+    //*********************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14
+    ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, etl::true_type)
+    {
+      if ((last2 - first2) < (last1 - first1))
+      {
+        last1 = first1 + (last2 - first2);
+      }
+
+      return private_algorithm::mismatch(first1, last1, first2, etl::true_type());
+    }
+  }
+#include "private/diagnostic_pop.h"
+
+  //***************************************************************************
+  /// Finds the first position where two ranges differ.
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/mismatch"></a>
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2)
+  {
+    return private_algorithm::mismatch(first1, last1, first2, etl::integral_constant<bool, private_algorithm::use_block_kernel2<TIterator1, TIterator2>::value>());
+  }
+
+  //***************************************************************************
+  /// mismatch with predicate.
+  ///\ingroup algorithm
+  //***************************************************************************
   template <typename TIterator1, typename TIterator2, typename TPredicate>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TPredicate predicate)
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TPredicate predicate)
   {
-    while ((first1 != last1) && (first2 != last2))
+    while ((first1 != last1) && predicate(*first1, *first2))
     {
-      if (!predicate(*first1 , *first2))
-      {
-        return false;
-      }
+      ++first1;
+      ++first2;
+    }
+
+    return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+  }
+
+  //***************************************************************************
+  /// mismatch for two bounded ranges.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
+  {
+    return private_algorithm::mismatch(first1, last1, first2, last2, etl::integral_constant<bool, private_algorithm::use_block_kernel2<TIterator1, TIterator2>::value>());
+  }
 
+  //***************************************************************************
+  /// mismatch for two bounded ranges with predicate.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TPredicate predicate)
+  {
+    while ((first1 != last1) && (first2 != last2) && predicate(*first1, *first2))
+    {
       ++first1;
       ++first2;
     }
 
-    return (first1 == last1) && (first2 == last2);
+    return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
   }
-#endif
 
   //***************************************************************************
   // lexicographical_compare
@@ -1180,6 +1673,173 @@ namespace etl
     return etl::search(first, last, search_first, search_last, compare());
   }
 
+  //***************************************************************************
+  /// A searcher that uses etl::search.
+  /// Equivalent to std::default_searcher.
+  //***************************************************************************
+  template <typename TPatternIterator, typename TCompare = etl::equal_to<typename etl::iterator_traits<TPatternIterator>::value_type> >
+  class default_searcher
+  {
+  public:
+
+    ETL_CONSTEXPR14 default_searcher(TPatternIterator pattern_first_, TPatternIterator pattern_last_, TCompare compare_ = TCompare())
+      : pattern_first(pattern_first_)
+      , pattern_last(pattern_last_)
+      , compare(compare_)
+    {
+    }
+
+    //*************************************************************************
+    /// Returns the range of the first match, or [last, last) if not found.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    etl::pair<TIterator, TIterator> operator()(TIterator first, TIterator last) const
+    {
+      TIterator itr = etl::search(first, last, pattern_first, pattern_last, compare);
+
+      if (itr == last)
+      {
+        return etl::pair<TIterator, TIterator>(last, last);
+      }
+
+      TIterator match_end = itr;
+      etl::advance(match_end, etl::distance(pattern_first, pattern_last));
+
+      return etl::pair<TIterator, TIterator>(itr, match_end);
+    }
+
+  private:
+
+    TPatternIterator pattern_first;
+    TPatternIterator pattern_last;
+    TCompare         compare;
+  };
+
+  //***************************************************************************
+  /// A Boyer-Moore-Horspool searcher, for repeated searches for the same pattern.
+  /// Similar to std::boyer_moore_horspool_searcher.
+  /// The pattern must be a random access range of integral values and must
+  /// outlive the searcher.
+  /// The skip table is indexed by the low eight bits of each value and each skip
+  /// is capped at 255, so the searcher is a fixed 256 bytes plus the pattern
+  /// iterators, whatever the width of the character type. Collisions in the
+  /// table only shorten a skip.
+  //***************************************************************************
+  template <typename TPatternIterator>
+  class boyer_moore_horspool_searcher
+  {
+  public:
+
+    typedef typename etl::iterator_traits<TPatternIterator>::value_type      value_type;
+    typedef typename etl::iterator_traits<TPatternIterator>::difference_type difference_type;
+
+    ETL_STATIC_ASSERT(etl::is_integral<value_type>::value, "Pattern values must be integral");
+
+    //*************************************************************************
+    /// Constructs the searcher and builds the skip table.
+    //*************************************************************************
+    ETL_CONSTEXPR14 boyer_moore_horspool_searcher(TPatternIterator pattern_first_, TPatternIterator pattern_last_)
+      : pattern_first(pattern_first_)
+      , pattern_length(etl::distance(pattern_first_, pattern_last_))
+      , skip_table()
+    {
+      const uint_least8_t default_skip = (pattern_length > Max_Skip) ? uint_least8_t(Max_Skip) : static_cast<uint_least8_t>(pattern_length);
+
+      for (size_t i = 0U; i < Table_Size; ++i)
+      {
+        skip_table[i] = default_skip;
+      }
+
+      // Later positions always give smaller skips, so the table keeps the minimum for each index.
+      for (difference_type i = 0; i < (pattern_length - 1); ++i)
+      {
+        const difference_type skip = pattern_length - 1 - i;
+
+        skip_table[table_index(pattern_first[i])] = (skip > Max_Skip) ? uint_least8_t(Max_Skip) : static_cast<uint_least8_t>(skip);
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the range of the first match, or [last, last) if not found.
+    /// TIterator must be a random access iterator.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    etl::pair<TIterator, TIterator> operator()(TIterator first, TIterator last) const
+    {
+      if (pattern_length == 0)
+      {
+        return etl::pair<TIterator, TIterator>(first, first);
+      }
+
+      if ((last - first) < pattern_length)
+      {
+        return etl::pair<TIterator, TIterator>(last, last);
+      }
+
+      const TIterator  final_candidate = last - pattern_length;
+      const value_type last_value      = pattern_first[pattern_length - 1];
+
+      TIterator itr = first;
+
+      while (true)
+      {
+        const value_type value = itr[pattern_length - 1];
+
+        if ((value == last_value) && etl::equal(pattern_first, pattern_first + (pattern_length - 1), itr))
+        {
+          return etl::pair<TIterator, TIterator>(itr, itr + pattern_length);
+        }
+
+        const difference_type skip = skip_table[table_index(value)];
+
+        if ((final_candidate - itr) < skip)
+        {
+          break;
+        }
+
+        itr += skip;
+      }
+
+      return etl::pair<TIterator, TIterator>(last, last);
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t          Table_Size = 256U;
+    static ETL_CONSTANT difference_type Max_Skip   = 255;
+
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t table_index(value_type value)
+    {
+      return static_cast<size_t>(static_cast<typename etl::make_unsigned<value_type>::type>(value)) & (Table_Size - 1U);
+    }
+
+    TPatternIterator pattern_first;
+    difference_type  pattern_length;
+    uint_least8_t    skip_table[Table_Size];
+  };
+
+  template <typename TPatternIterator>
+  ETL_CONSTANT size_t boyer_moore_horspool_searcher<TPatternIterator>::Table_Size;
+
+  template <typename TPatternIterator>
+  ETL_CONSTANT typename boyer_moore_horspool_searcher<TPatternIterator>::difference_type boyer_moore_horspool_searcher<TPatternIterator>::Max_Skip;
+
+  //***************************************************************************
+  /// Search using a searcher object.
+  //***************************************************************************
+  template<typename TIterator, typename TSearcher>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  TIterator search(TIterator first, TIterator last, const TSearcher& searcher)
+  {
+    return searcher(first, last).first;
+  }
+
   //***************************************************************************
   // Rotate
   //***************************************************************************
@@ -1499,15 +2159,34 @@ namespace etl
   ///\ingroup algorithm
   ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
   //***************************************************************************
+  namespace private_algorithm
+  {
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    TIterator min_element(TIterator begin, TIterator end, etl::false_type)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      return etl::min_element(begin, end, etl::less<value_t>());
+    }
+
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    TIterator min_element(TIterator begin, TIterator end, etl::true_type)
+    {
+      return (begin == end) ? end : private_algorithm::find_block(begin, end, private_algorithm::min_value_block(begin, end));
+    }
+  }
+
   template <typename TIterator>
   ETL_NODISCARD
   ETL_CONSTEXPR14
   TIterator min_element(TIterator begin,
                         TIterator end)
   {
-    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
-
-    return etl::min_element(begin, end, etl::less<value_t>());
+    return private_algorithm::min_element(begin, end, etl::integral_constant<bool, private_algorithm::use_integral_block_kernel<TIterator>::value>());
   }
 
   //***************************************************************************
@@ -1547,15 +2226,34 @@ namespace etl
   ///\ingroup algorithm
   ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
   //***************************************************************************
+  namespace private_algorithm
+  {
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    TIterator max_element(TIterator begin, TIterator end, etl::false_type)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      return etl::max_element(begin, end, etl::less<value_t>());
+    }
+
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    TIterator max_element(TIterator begin, TIterator end, etl::true_type)
+    {
+      return (begin == end) ? end : private_algorithm::find_block(begin, end, private_algorithm::max_value_block(begin, end));
+    }
+  }
+
   template <typename TIterator>
   ETL_NODISCARD
   ETL_CONSTEXPR14
   TIterator max_element(TIterator begin,
                         TIterator end)
   {
-    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
-
-    return etl::max_element(begin, end, etl::less<value_t>());
+    return private_algorithm::max_element(begin, end, etl::integral_constant<bool, private_algorithm::use_integral_block_kernel<TIterator>::value>());
   }
 
   //***************************************************************************
@@ -1601,15 +2299,40 @@ namespace etl
   ///\ingroup algorithm
   ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
   //***************************************************************************
+  namespace private_algorithm
+  {
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    ETL_OR_STD::pair<TIterator, TIterator> minmax_element(TIterator begin, TIterator end, etl::false_type)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      return etl::minmax_element(begin, end, etl::less<value_t>());
+    }
+
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    ETL_OR_STD::pair<TIterator, TIterator> minmax_element(TIterator begin, TIterator end, etl::true_type)
+    {
+      if (begin == end)
+      {
+        return ETL_OR_STD::pair<TIterator, TIterator>(end, end);
+      }
+
+      return ETL_OR_STD::pair<TIterator, TIterator>(private_algorithm::find_block(begin, end, private_algorithm::min_value_block(begin, end)),
+                                                    private_algorithm::find_last_block(begin, end, private_algorithm::max_value_block(begin, end)));
+    }
+  }
+
   template <typename TIterator>
   ETL_NODISCARD
   ETL_CONSTEXPR14
   ETL_OR_STD::pair<TIterator, TIterator> minmax_element(TIterator begin,
                                                         TIterator end)
   {
-    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
-
-    return etl::minmax_element(begin, end, etl::less<value_t>());
+    return private_algorithm::minmax_element(begin, end, etl::integral_constant<bool, private_algorithm::use_integral_block_kernel<TIterator>::value>());
   }
 
   //***************************************************************************
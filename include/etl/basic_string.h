@@ -177,6 +177,225 @@ namespace etl
 
     template <typename T>
     ETL_CONSTANT typename string_base_statics<T>::size_type string_base_statics<T>::npos;
+
+    //*************************************************************************
+    /// Finds the first occurrence of 'c' in the range [first, last).
+    /// Single byte characters use memchr when not constant evaluated.
+    //*************************************************************************
+    template <typename T>
+    const T* find_char_runtime(const T* first, const T* last, T c, etl::true_type)
+    {
+      return reinterpret_cast<const T*>(etl::mem_char(reinterpret_cast<const char*>(first),
+                                                      reinterpret_cast<const char*>(last),
+                                                      static_cast<char>(c)));
+    }
+
+    template <typename T>
+    const T* find_char_runtime(const T* first, const T* last, T c, etl::false_type)
+    {
+      while ((first != last) && (*first != c))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    template <typename T>
+    ETL_CONSTEXPR14 const T* find_char(const T* first, const T* last, T c) ETL_NOEXCEPT
+    {
+#if ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1)
+      if (!etl::is_constant_evaluated())
+      {
+        return find_char_runtime(first, last, c, etl::integral_constant<bool, sizeof(T) == 1U>());
+      }
+#endif
+
+      while ((first != last) && (*first != c))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Compares 'length' characters.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 bool equal_chars(const T* a, const T* b, size_t length) ETL_NOEXCEPT
+    {
+      for (size_t i = 0U; i < length; ++i)
+      {
+        if (a[i] != b[i])
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the pattern at or after 'position'.
+    /// Candidates are located with a scan for the first character and then
+    /// filtered on the last character before the full compare.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_substring(const T* text, size_t text_length, size_t position, const T* pattern, size_t pattern_length) ETL_NOEXCEPT
+    {
+      if ((position > text_length) || (pattern_length > (text_length - position)))
+      {
+        return string_base_statics<>::npos;
+      }
+
+      if (pattern_length == 0U)
+      {
+        return position;
+      }
+
+      const T  first_char = pattern[0];
+      const T  last_char  = pattern[pattern_length - 1U];
+      const T* itr        = text + position;
+      const T* stop       = text + (text_length - pattern_length + 1U); // One past the last candidate.
+
+      while (itr != stop)
+      {
+        itr = find_char(itr, stop, first_char);
+
+        if (itr == stop)
+        {
+          break;
+        }
+
+        if ((itr[pattern_length - 1U] == last_char) && equal_chars(itr + 1, pattern + 1, pattern_length - 1U))
+        {
+          return static_cast<size_t>(itr - text);
+        }
+
+        ++itr;
+      }
+
+      return string_base_statics<>::npos;
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence of the pattern that lies entirely within
+    /// [0, limit).
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t rfind_substring(const T* text, size_t limit, const T* pattern, size_t pattern_length) ETL_NOEXCEPT
+    {
+      if (pattern_length > limit)
+      {
+        return string_base_statics<>::npos;
+      }
+
+      size_t i = limit - pattern_length;
+
+      if (pattern_length == 0U)
+      {
+        return i;
+      }
+
+      const T first_char = pattern[0];
+      const T last_char  = pattern[pattern_length - 1U];
+
+      while (true)
+      {
+        if ((text[i] == first_char) &&
+            (text[i + pattern_length - 1U] == last_char) &&
+            equal_chars(text + i + 1U, pattern + 1, pattern_length - 1U))
+        {
+          return i;
+        }
+
+        if (i == 0U)
+        {
+          break;
+        }
+
+        --i;
+      }
+
+      return string_base_statics<>::npos;
+    }
+
+    //*************************************************************************
+    /// Finds the first character at or after 'position' that is (or is not)
+    /// in the set.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_first_in_set(const T* text, size_t text_length, size_t position,
+                                             const T* set, size_t set_length, bool in_set, etl::true_type) ETL_NOEXCEPT
+    {
+      const etl::private_string_utilities::char_set_bitmap bitmap(set, set_length);
+
+      for (size_t i = position; i < text_length; ++i)
+      {
+        if (bitmap.contains(text[i]) == in_set)
+        {
+          return i;
+        }
+      }
+
+      return string_base_statics<>::npos;
+    }
+
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_first_in_set(const T* text, size_t text_length, size_t position,
+                                             const T* set, size_t set_length, bool in_set, etl::false_type) ETL_NOEXCEPT
+    {
+      for (size_t i = position; i < text_length; ++i)
+      {
+        bool found = false;
+
+        for (size_t j = 0U; j < set_length; ++j)
+        {
+          if (text[i] == set[j])
+          {
+            found = true;
+            break;
+          }
+        }
+
+        if (found == in_set)
+        {
+          return i;
+        }
+      }
+
+      return string_base_statics<>::npos;
+    }
+
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_first_of(const T* text, size_t text_length, size_t position, const T* set, size_t set_length) ETL_NOEXCEPT
+    {
+      if (position >= text_length)
+      {
+        return string_base_statics<>::npos;
+      }
+
+      if (set_length == 1U)
+      {
+        const T* itr = find_char(text + position, text + text_length, set[0]);
+
+        return (itr == (text + text_length)) ? string_base_statics<>::npos : static_cast<size_t>(itr - text);
+      }
+
+      return find_first_in_set(text, text_length, position, set, set_length, true, etl::integral_constant<bool, sizeof(T) == 1U>());
+    }
+
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_first_not_of(const T* text, size_t text_length, size_t position, const T* set, size_t set_length) ETL_NOEXCEPT
+    {
+      if (position >= text_length)
+      {
+        return string_base_statics<>::npos;
+      }
+
+      return find_first_in_set(text, text_length, position, set, set_length, false, etl::integral_constant<bool, sizeof(T) == 1U>());
+    }
   }
 
   //***************************************************************************
@@ -1436,7 +1655,7 @@ namespace etl
     //*********************************************************************
     size_type find(const ibasic_string<T>& str, size_type pos = 0) const
     {
-      return find_impl(str.begin(), str.end(), str.size(), pos);
+      return find_impl(str.data(), str.size(), pos);
     }
 
     //*********************************************************************
@@ -1447,7 +1666,7 @@ namespace etl
     template <typename TOtherTraits>
     size_type find(const etl::basic_string_view<T, TOtherTraits>& view, size_type pos = 0) const
     {
-      return find_impl(view.begin(), view.end(), view.size(), pos);
+      return find_impl(view.data(), view.size(), pos);
     }
 
     //*********************************************************************
@@ -1457,9 +1676,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos = 0) const
     {
-      size_t sz = etl::strlen(s);
-
-      return find_impl(s, s + sz, sz, pos);
+      return find_impl(s, etl::strlen(s), pos);
     }
 
     //*********************************************************************
@@ -1470,9 +1687,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos, size_type n) const
     {
-      size_t sz = etl::strlen(s);
-
-      return find_impl(s, s + n, sz, pos);
+      return find_impl(s, n, pos);
     }
 
     //*********************************************************************
@@ -1482,16 +1697,7 @@ namespace etl
     //*********************************************************************
     size_type find(T c, size_type position = 0) const
     {
-      const_iterator i = etl::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return etl::distance(begin(), i);
-      }
-      else
-      {
-        return npos;
-      }
+      return find_impl(&c, 1U, position);
     }
 
     //*********************************************************************
@@ -1501,7 +1707,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const ibasic_string<T>& str, size_type position = npos) const
     {
-      return rfind_impl(str.rbegin(), str.rend(), str.size(), position);
+      return rfind_impl(str.data(), str.size(), position);
     }
 
     //*********************************************************************
@@ -1512,7 +1718,7 @@ namespace etl
     template <typename TOtherTraits>
     size_type rfind(const etl::basic_string_view<T, TOtherTraits>& view, size_type pos = 0) const
     {
-      return rfind_impl(view.rbegin(), view.rend(), view.size(), pos);
+      return rfind_impl(view.data(), view.size(), pos);
     }
 
     //*********************************************************************
@@ -1522,12 +1728,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const_pointer s, size_type position = npos) const
     {
-      size_type len = etl::strlen(s);
-
-      const_reverse_iterator srbegin(s + len);
-      const_reverse_iterator srend(s);
-
-      return rfind_impl(srbegin, srend, len, position);
+      return rfind_impl(s, etl::strlen(s), position);
     }
 
     //*********************************************************************
@@ -1537,10 +1738,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const_pointer s, size_type position, size_type length_) const
     {
-      const_reverse_iterator srbegin(s + length_);
-      const_reverse_iterator srend(s);
-
-      return rfind_impl(srbegin, srend, length_, position);
+      return rfind_impl(s, length_, position);
     }
 
     //*********************************************************************
@@ -2049,21 +2247,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
-        }
-      }
-
-      return npos;
+      return private_basic_string::find_first_of(p_buffer, size(), position, s, n);
     }
 
     //*********************************************************************
@@ -2073,18 +2257,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(value_type c, size_type position = 0) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return private_basic_string::find_first_of(p_buffer, size(), position, &c, 1U);
     }
 
     //*********************************************************************
@@ -2221,28 +2394,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_not_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          bool found = false;
-
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return private_basic_string::find_first_not_of(p_buffer, size(), position, s, n);
     }
 
     //*********************************************************************
@@ -2865,54 +3017,18 @@ namespace etl
     //*************************************************************************
     /// Common implementation for 'find'.
     //*************************************************************************
-    template <typename TIterator>
-    size_type find_impl(TIterator first, TIterator last, size_type sz, size_type pos = 0) const
+    size_type find_impl(const_pointer s, size_type sz, size_type pos = 0) const
     {
-      if ((pos + sz) > size())
-      {
-        return npos;
-      }
-
-      const_iterator iposition = etl::search(begin() + pos, end(), first, last);
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return private_basic_string::find_substring(p_buffer, size(), pos, s, sz);
     }
 
     //*************************************************************************
     /// Common implementation for 'rfind'.
+    /// Finds the last match that lies entirely before 'pos'.
     //*************************************************************************
-    template <typename TIterator>
-    size_type rfind_impl(TIterator rfirst, TIterator rlast, size_type sz, size_type pos = 0) const
+    size_type rfind_impl(const_pointer s, size_type sz, size_type pos = 0) const
     {
-      if (sz > size())
-      {
-        return npos;
-      }
-
-      if (pos >= size())
-      {
-        pos = size();
-      }
-
-      pos = size() - pos;
-
-      const_reverse_iterator iposition = etl::search(rbegin() + pos, rend(), rfirst, rlast);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - sz - etl::distance(rbegin(), iposition);
-      }
+      return private_basic_string::rfind_substring(p_buffer, etl::min(pos, size()), s, sz);
     }
 
     //*********************************************************************
@@ -0,0 +1,434 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_MAP_INCLUDED
+#define ETL_BTREE_MAP_INCLUDED
+
+#define ETL_IN_BTREE_MAP_H
+
+#include "platform.h"
+#include "functional.h"
+#include "utility.h"
+#include "pool.h"
+#include "initializer_list.h"
+#include "private/btree_base.h"
+
+#undef ETL_IN_BTREE_MAP_H
+
+//*****************************************************************************
+///\defgroup btree_map btree_map
+/// A B+ tree map with the capacity defined at compile time.
+/// Values are stored in contiguous arrays in linked leaves, so lookups touch
+/// a few wide nodes and in order traversal is a scan along the leaves.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_btree_map
+  {
+    //*************************************************************************
+    /// Gets the key of a map value.
+    //*************************************************************************
+    template <typename TKey, typename TMapped>
+    struct key_of_value
+    {
+      static const TKey& get(const ETL_OR_STD::pair<const TKey, TMapped>& value)
+      {
+        return value.first;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized B+ tree maps.
+  /// Can be used as a reference type for all btree_maps with the same key,
+  /// mapped type, fanout and compare.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t Fanout = 16U, typename TKeyCompare = etl::less<TKey> >
+  class ibtree_map : public etl::btree_base<ETL_OR_STD::pair<const TKey, TMapped>,
+                                            TKey,
+                                            etl::private_btree_map::key_of_value<TKey, TMapped>,
+                                            TKeyCompare,
+                                            Fanout>
+  {
+  private:
+
+    typedef etl::btree_base<ETL_OR_STD::pair<const TKey, TMapped>,
+                            TKey,
+                            etl::private_btree_map::key_of_value<TKey, TMapped>,
+                            TKeyCompare,
+                            Fanout> base_t;
+
+  public:
+
+    typedef typename base_t::key_type            key_type;
+    typedef typename base_t::value_type          value_type;
+    typedef TMapped                              mapped_type;
+    typedef typename base_t::key_compare         key_compare;
+    typedef typename base_t::reference           reference;
+    typedef typename base_t::const_reference     const_reference;
+    typedef typename base_t::pointer             pointer;
+    typedef typename base_t::const_pointer       const_pointer;
+    typedef typename base_t::size_type           size_type;
+    typedef typename base_t::const_key_reference const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&&                           rvalue_key_reference;
+#endif
+    typedef mapped_type&                         mapped_reference;
+    typedef const mapped_type&                   const_mapped_reference;
+
+    typedef typename base_t::iterator               iterator;
+    typedef typename base_t::const_iterator         const_iterator;
+    typedef typename base_t::reverse_iterator       reverse_iterator;
+    typedef typename base_t::const_reverse_iterator const_reverse_iterator;
+
+    //*************************************************************************
+    /// Compares values by their keys.
+    //*************************************************************************
+    class value_compare
+    {
+    public:
+
+      bool operator()(const_reference lhs, const_reference rhs) const
+      {
+        return (kcompare(lhs.first, rhs.first));
+      }
+
+    private:
+
+      key_compare kcompare;
+    };
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// Inserts a default constructed value if the key is not present.
+    /// If asserts or exceptions are enabled, emits btree_full if a value must be added and the map is full.
+    //*********************************************************************
+    mapped_reference operator [](const_key_reference key)
+    {
+      iterator i_element = this->find(key);
+
+      if (i_element == this->end())
+      {
+        i_element = this->insert(value_type(key, mapped_type())).first;
+      }
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// Inserts a default constructed value if the key is not present.
+    /// If asserts or exceptions are enabled, emits btree_full if a value must be added and the map is full.
+    //*********************************************************************
+    mapped_reference operator [](rvalue_key_reference key)
+    {
+      iterator i_element = this->find(key);
+
+      if (i_element == this->end())
+      {
+        i_element = this->insert(value_type(etl::move(key), mapped_type())).first;
+      }
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits an etl::btree_out_of_bounds if the key is not present.
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits an etl::btree_out_of_bounds if the key is not present.
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      const_iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      const_iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the value comparison function.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return value_compare();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_map& operator = (const ibtree_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_map(etl::ipool& leaf_pool, etl::ipool& internal_pool, size_type max_size_)
+      : base_t(leaf_pool, internal_pool, max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~ibtree_map()
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    ibtree_map(const ibtree_map&) ETL_DELETE;
+  };
+
+  //*************************************************************************
+  /// A B+ tree map that can hold up to Max_Size values.
+  /// Nodes are taken from internal pools sized for the worst case.
+  ///\tparam TKey        The key type.
+  ///\tparam TMapped     The mapped type.
+  ///\tparam Max_Size_   The maximum number of values.
+  ///\tparam Fanout_     The maximum number of children or values in a node. Default 16.
+  ///\tparam TKeyCompare The key comparison type. Default etl::less.
+  ///\ingroup btree_map
+  //*************************************************************************
+  template <typename TKey, typename TMapped, const size_t Max_Size_, const size_t Fanout_ = 16U, typename TKeyCompare = etl::less<TKey> >
+  class btree_map : public etl::ibtree_map<TKey, TMapped, Fanout_, TKeyCompare>
+  {
+  private:
+
+    typedef etl::ibtree_map<TKey, TMapped, Fanout_, TKeyCompare> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(Max_Size_ > 0U, "Zero size btree_map is not valid");
+
+    static ETL_CONSTANT size_t Max_Size = Max_Size_;
+
+    /// Every leaf apart from the root is at least half full.
+    static ETL_CONSTANT size_t Max_Leaves = (Max_Size_ / (Fanout_ / 2U)) + 1U;
+
+    /// Every internal node apart from the root has at least half of its children.
+    static ETL_CONSTANT size_t Max_Internal_Nodes = (Max_Leaves / (((Fanout_ + 1U) / 2U) - 1U)) + 1U;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_map()
+      : base_t(leaf_pool, internal_pool, Max_Size)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_map(const btree_map& other)
+      : base_t(leaf_pool, internal_pool, Max_Size)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_map(btree_map&& other)
+      : base_t(leaf_pool, internal_pool, Max_Size)
+    {
+      move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map(TIterator first, TIterator last)
+      : base_t(leaf_pool, internal_pool, Max_Size)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_map(std::initializer_list<typename base_t::value_type> init)
+      : base_t(leaf_pool, internal_pool, Max_Size)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map& operator = (const btree_map& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_map& operator = (btree_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->clear();
+        move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    void move_from(btree_map& other)
+    {
+      for (typename base_t::iterator itr = other.begin(); itr != other.end(); ++itr)
+      {
+        this->insert(etl::move(*itr));
+      }
+
+      other.clear();
+    }
+#endif
+
+    etl::pool<typename base_t::Leaf_Node, Max_Leaves>             leaf_pool;
+    etl::pool<typename base_t::Internal_Node, Max_Internal_Nodes> internal_pool;
+  };
+
+  template <typename TKey, typename TMapped, const size_t Max_Size_, const size_t Fanout_, typename TKeyCompare>
+  ETL_CONSTANT size_t btree_map<TKey, TMapped, Max_Size_, Fanout_, TKeyCompare>::Max_Size;
+
+  template <typename TKey, typename TMapped, const size_t Max_Size_, const size_t Fanout_, typename TKeyCompare>
+  ETL_CONSTANT size_t btree_map<TKey, TMapped, Max_Size_, Fanout_, TKeyCompare>::Max_Leaves;
+
+  template <typename TKey, typename TMapped, const size_t Max_Size_, const size_t Fanout_, typename TKeyCompare>
+  ETL_CONSTANT size_t btree_map<TKey, TMapped, Max_Size_, Fanout_, TKeyCompare>::Max_Internal_Nodes;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t Fanout, typename TKeyCompare>
+  bool operator ==(const etl::ibtree_map<TKey, TMapped, Fanout, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, Fanout, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t Fanout, typename TKeyCompare>
+  bool operator !=(const etl::ibtree_map<TKey, TMapped, Fanout, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, Fanout, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// Less than operator.
+  ///\ingroup btree_map
+  //*************************************************************************
+  template <typename TKey, typename TMapped, const size_t Fanout, typename TKeyCompare>
+  bool operator <(const etl::ibtree_map<TKey, TMapped, Fanout, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, Fanout, TKeyCompare>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), lhs.value_comp());
+  }
+}
+
+#endif
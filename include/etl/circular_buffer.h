@@ -41,6 +41,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "static_assert.h"
 #include "initializer_list.h"
+#include "span.h"
 
 namespace etl
 {
@@ -83,6 +84,19 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Full exception for the circular_buffer.
+  //***************************************************************************
+  class circular_buffer_full : public circular_buffer_exception
+  {
+  public:
+
+    circular_buffer_full(string_type file_name_, numeric_type line_number_)
+      : circular_buffer_exception(ETL_ERROR_TEXT("circular_buffer:full", ETL_CIRCULAR_BUFFER_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
   //***************************************************************************
   ///
   //***************************************************************************
@@ -900,6 +914,83 @@ namespace etl
       return pbuffer[(out + index) % buffer_size];
     }
 
+    //*************************************************************************
+    /// Gets the first contiguous block of stored items, starting with the oldest.
+    //*************************************************************************
+    etl::span<T> array_one()
+    {
+      return etl::span<T>(pbuffer + out, (in >= out) ? (in - out) : (buffer_size - out));
+    }
+
+    //*************************************************************************
+    /// Gets the first contiguous block of stored items, starting with the oldest.
+    //*************************************************************************
+    etl::span<const T> array_one() const
+    {
+      return etl::span<const T>(pbuffer + out, (in >= out) ? (in - out) : (buffer_size - out));
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous block of stored items.
+    /// Empty unless the stored items wrap around the end of the buffer.
+    //*************************************************************************
+    etl::span<T> array_two()
+    {
+      return etl::span<T>(pbuffer, (in >= out) ? 0U : in);
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous block of stored items.
+    /// Empty unless the stored items wrap around the end of the buffer.
+    //*************************************************************************
+    etl::span<const T> array_two() const
+    {
+      return etl::span<const T>(pbuffer, (in >= out) ? 0U : in);
+    }
+
+    //*************************************************************************
+    /// Gets the first contiguous block of free space, following the newest item.
+    /// Items may be written directly to the free space and then added with commit().
+    /// The free space is uninitialised, so T must be trivially copyable.
+    //*************************************************************************
+    etl::span<T> free_array_one()
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "Free space can only be written for trivially copyable types");
+
+      return etl::span<T>(pbuffer + in, etl::min(available(), buffer_size - in));
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous block of free space, at the start of the buffer.
+    /// Empty unless the free space wraps around the end of the buffer.
+    /// The free space is uninitialised, so T must be trivially copyable.
+    //*************************************************************************
+    etl::span<T> free_array_two()
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "Free space can only be written for trivially copyable types");
+
+      return etl::span<T>(pbuffer, available() - etl::min(available(), buffer_size - in));
+    }
+
+    //*************************************************************************
+    /// Adds n items that have been written directly to the free space,
+    /// free_array_one() first, then free_array_two().
+    /// Asserts an error if n is greater than the free space.
+    //*************************************************************************
+    void commit(size_type n)
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "Free space can only be written for trivially copyable types");
+      ETL_ASSERT_OR_RETURN(n <= available(), ETL_ERROR(circular_buffer_full));
+
+      in += n;
+      if (in >= buffer_size)
+      {
+        in -= buffer_size;
+      }
+
+      ETL_ADD_DEBUG_COUNT(n);
+    }
+
     //*************************************************************************
     /// push.
     /// Adds an item to the buffer.
@@ -961,6 +1052,42 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Push the items in a span.
+    /// The items are copied in at most two blocks.
+    /// If the buffer is filled then the oldest items are overwritten.
+    //*************************************************************************
+    void push(etl::span<const T> items)
+    {
+      const T*  p = items.data();
+      size_type n = items.size();
+
+      // Only the newest items fit.
+      if (n > capacity())
+      {
+        p += (n - capacity());
+        n = capacity();
+      }
+
+      if (n > available())
+      {
+        pop(n - available());
+      }
+
+      const size_type first_size = etl::min(n, buffer_size - in);
+
+      etl::uninitialized_copy(p, p + first_size, pbuffer + in);
+      etl::uninitialized_copy(p + first_size, p + n, pbuffer);
+
+      in += n;
+      if (in >= buffer_size)
+      {
+        in -= buffer_size;
+      }
+
+      ETL_ADD_DEBUG_COUNT(n);
+    }
+
     //*************************************************************************
     /// pop
     //*************************************************************************
@@ -974,13 +1101,25 @@ namespace etl
 
     //*************************************************************************
     /// pop(n)
+    /// Removes the n oldest items.
+    /// Asserts an error if there are fewer than n items in the buffer.
     //*************************************************************************
     void pop(size_type n)
     {
-      while (n-- != 0U)
+      ETL_ASSERT_OR_RETURN(n <= size(), ETL_ERROR(circular_buffer_empty));
+
+      const size_type first_size = etl::min(n, buffer_size - out);
+
+      etl::destroy(pbuffer + out, pbuffer + out + first_size);
+      etl::destroy(pbuffer, pbuffer + (n - first_size));
+
+      out += n;
+      if (out >= buffer_size)
       {
-        pop();
+        out -= buffer_size;
       }
+
+      ETL_SUBTRACT_DEBUG_COUNT(n);
     }
 
     //*************************************************************************
@@ -0,0 +1,647 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONST_PERFECT_MAP_INCLUDED
+#define ETL_CONST_PERFECT_MAP_INCLUDED
+
+#include "platform.h"
+
+#if ETL_NOT_USING_CPP11
+  #error NOT SUPPORTED FOR C++03 OR BELOW
+#endif
+
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "functional.h"
+#include "nth_type.h"
+#include "string_view.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include <stdint.h>
+
+///\defgroup const_perfect_map const_perfect_map
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup const_perfect_map
+  /// Exception base for const_perfect_map
+  //***************************************************************************
+  class const_perfect_map_exception : public etl::exception
+  {
+  public:
+
+    const_perfect_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup const_perfect_map
+  /// The perfect hash could not be built for the elements.
+  //***************************************************************************
+  class const_perfect_map_build_failed : public etl::const_perfect_map_exception
+  {
+  public:
+
+    const_perfect_map_build_failed(string_type file_name_, numeric_type line_number_)
+      : const_perfect_map_exception(ETL_ERROR_TEXT("const_perfect_map:build failed", ETL_CONST_PERFECT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Compile time hash for const_perfect_map keys.
+  /// Defined for integral and enum types and string views.
+  /// Specialise for other key types. The function call operator must be constexpr.
+  //***************************************************************************
+  template <typename TKey, typename = void>
+  struct const_perfect_hash;
+
+  //*************************************************************************
+  /// Integral and enum keys are mixed by const_perfect_map, so are used as is.
+  //*************************************************************************
+  template <typename TKey>
+  struct const_perfect_hash<TKey, etl::enable_if_t<etl::is_integral<TKey>::value || etl::is_enum<TKey>::value>>
+  {
+    ETL_CONSTEXPR uint64_t operator()(TKey key) const ETL_NOEXCEPT
+    {
+      return static_cast<uint64_t>(key);
+    }
+  };
+
+  //*************************************************************************
+  /// String views are hashed with 64 bit FNV-1a.
+  //*************************************************************************
+  template <typename T, typename TTraits>
+  struct const_perfect_hash<etl::basic_string_view<T, TTraits>, void>
+  {
+    ETL_CONSTEXPR14 uint64_t operator()(const etl::basic_string_view<T, TTraits>& key) const ETL_NOEXCEPT
+    {
+      uint64_t hash = 14695981039346656037ULL;
+
+      for (size_t i = 0U; i < key.size(); ++i)
+      {
+        hash ^= static_cast<uint64_t>(static_cast<typename etl::make_unsigned<T>::type>(key[i]));
+        hash *= 1099511628211ULL;
+      }
+
+      return hash;
+    }
+  };
+
+  namespace private_const_perfect_map
+  {
+    // Average number of keys per bucket.
+    static ETL_CONSTANT size_t Bucket_Load = 4U;
+
+    // The largest pilot value searched for.
+    static ETL_CONSTANT uint16_t Max_Pilot = 0xFFFFU;
+
+    // One spare slot is added for every Table_Slack elements.
+    static ETL_CONSTANT size_t Table_Slack = 64U;
+
+    // The number of hash seeds tried before the build fails.
+    static ETL_CONSTANT size_t Max_Seeds = 16U;
+
+    //*************************************************************************
+    /// The number of buckets needed for a number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t bucket_count(size_t size) ETL_NOEXCEPT
+    {
+      return (size == 0U) ? 1U : (size + Bucket_Load - 1U) / Bucket_Load;
+    }
+
+    //*************************************************************************
+    /// The number of slots needed for a number of elements.
+    /// A load factor just below 1 keeps the last buckets easy to place.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t table_size(size_t size) ETL_NOEXCEPT
+    {
+      return size + (size / Table_Slack) + 1U;
+    }
+
+    //*************************************************************************
+    /// The hash seed for a build attempt.
+    //*************************************************************************
+    ETL_CONSTEXPR uint64_t seed(size_t attempt) ETL_NOEXCEPT
+    {
+      return static_cast<uint64_t>(attempt) * 0xD6E8FEB86659FD93ULL;
+    }
+
+    //*************************************************************************
+    /// Spreads the bits of a key hash.
+    //*************************************************************************
+    ETL_CONSTEXPR14 uint64_t mix(uint64_t hash) ETL_NOEXCEPT
+    {
+      hash ^= hash >> 33U;
+      hash *= 0xFF51AFD7ED558CCDULL;
+      hash ^= hash >> 33U;
+      hash *= 0xC4CEB9FE1A85EC53ULL;
+      hash ^= hash >> 33U;
+
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Maps 32 bits of hash on to [0, range) without a division.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t reduce(uint64_t hash, size_t range) ETL_NOEXCEPT
+    {
+      return static_cast<size_t>(((hash & 0xFFFFFFFFULL) * range) >> 32U);
+    }
+
+    //*************************************************************************
+    /// The bucket for a mixed hash.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t bucket(uint64_t hash, size_t buckets) ETL_NOEXCEPT
+    {
+      return reduce(hash, buckets);
+    }
+
+    //*************************************************************************
+    /// The slot for a mixed hash, displaced by the bucket's pilot.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t slot(uint64_t hash, uint16_t pilot, size_t size) ETL_NOEXCEPT
+    {
+      return reduce(mix(hash ^ (pilot * 0x9E3779B97F4A7C15ULL)) >> 32U, size);
+    }
+  }
+
+  //***************************************************************************
+  /// Interface for a map of constants, with a perfect hash built at compile
+  /// time. Each lookup is one hash, one probe and one key compare.
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  class iconst_perfect_map
+  {
+  public:
+
+    using key_type        = TKey;
+    using value_type      = ETL_OR_STD::pair<const TKey, TMapped>;
+    using mapped_type     = TMapped;
+    using hasher          = THash;
+    using key_equal       = TKeyEqual;
+    using const_reference = const value_type&;
+    using const_pointer   = const value_type*;
+    using const_iterator  = const value_type*;
+    using size_type       = size_t;
+
+    //*************************************************************************
+    /// Check that the elements are valid for a map.
+    /// The keys must be unique and have distinct hashes.
+    /// \return <b>true</b> if the perfect hash could be built.
+    /// If it could not, lookups fall back to a linear search.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool is_valid() const ETL_NOEXCEPT
+    {
+      return valid;
+    }
+
+    //*************************************************************************
+    ///\brief Returns a <code>const_iterator</code> to the beginning of the map.
+    /// Elements are in the order that they were supplied.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator begin() const ETL_NOEXCEPT
+    {
+      return element_list;
+    }
+
+    //*************************************************************************
+    ///\brief Returns a <code>const_iterator</code> to the beginning of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cbegin() const ETL_NOEXCEPT
+    {
+      return element_list;
+    }
+
+    //*************************************************************************
+    ///\brief Returns a <code>const_iterator</code> to the end of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator end() const ETL_NOEXCEPT
+    {
+      return element_list + element_count;
+    }
+
+    //*************************************************************************
+    ///\brief Returns a <code>const_iterator</code> to the end of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cend() const ETL_NOEXCEPT
+    {
+      return element_list + element_count;
+    }
+
+    //*************************************************************************
+    ///\brief Returns a <code>const_pointer</code> to the beginning of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_pointer data() const ETL_NOEXCEPT
+    {
+      return element_list;
+    }
+
+    //*************************************************************************
+    ///\brief Index operator.
+    ///\param key The key of the element to return.
+    ///\return A <code>const mapped_type&</code> to the mapped value at the index.
+    /// Undefined behaviour if the key is not in the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const mapped_type& operator[](const key_type& key) const ETL_NOEXCEPT
+    {
+      return find(key)->second;
+    }
+
+    //*************************************************************************
+    ///\brief Gets the mapped value at the key index.
+    ///\param key The key of the element to return.
+    ///\return A <code>const mapped_type&</code> to the mapped value at the index.
+    /// Undefined behaviour if the key is not in the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const mapped_type& at(const key_type& key) const ETL_NOEXCEPT
+    {
+      return find(key)->second;
+    }
+
+    //*************************************************************************
+    ///\brief Gets a const_iterator to the mapped value at the key index.
+    ///\param key The key of the element to find.
+    ///\return A <code>const_iterator</code> to the mapped value at the index,
+    /// or end() if not found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator find(const key_type& key) const ETL_NOEXCEPT
+    {
+      if (element_count == 0U)
+      {
+        return end();
+      }
+
+      if (!valid)
+      {
+        for (const_iterator itr = begin(); itr != end(); ++itr)
+        {
+          if (key_equal()(itr->first, key))
+          {
+            return itr;
+          }
+        }
+
+        return end();
+      }
+
+      const uint64_t hash    = private_const_perfect_map::mix(static_cast<uint64_t>(hasher()(key)) ^ seed);
+      const size_t   bucket  = private_const_perfect_map::bucket(hash, private_const_perfect_map::bucket_count(element_count));
+      const size_t   slot    = private_const_perfect_map::slot(hash, pilot_list[bucket], private_const_perfect_map::table_size(element_count));
+      const_iterator itr     = element_list + slot_list[slot];
+
+      return key_equal()(itr->first, key) ? itr : end();
+    }
+
+    //*************************************************************************
+    ///\brief Checks if the map contains an element with key.
+    ///\param key The key of the element to check.
+    ///\return <b>true</b> if the map contains an element with key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool contains(const key_type& key) const ETL_NOEXCEPT
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    ///\brief Counts the number of elements with key.
+    ///\param key The key of the element to count.
+    ///\return 0 or 1
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type count(const key_type& key) const ETL_NOEXCEPT
+    {
+      return contains(key) ? 1 : 0;
+    }
+
+    //*************************************************************************
+    /// Checks if the map is empty.
+    ///\return <b>true</b> if the map is empty.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool empty() const ETL_NOEXCEPT
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the map is full.
+    ///\return <b>true</b> if the map is full.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool full() const ETL_NOEXCEPT
+    {
+      return (max_elements != 0) && (size() == max_elements);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the map.
+    ///\return The size of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type size() const ETL_NOEXCEPT
+    {
+      return element_count;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum size of the map.
+    ///\return The maximum size of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type max_size() const ETL_NOEXCEPT
+    {
+      return max_elements;
+    }
+
+    //*************************************************************************
+    /// Gets the capacity of the map.
+    /// This is always equal to max_size().
+    ///\return The capacity of the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type capacity() const ETL_NOEXCEPT
+    {
+      return max_elements;
+    }
+
+    //*************************************************************************
+    /// How to hash the keys.
+    ///\return An instance of the hasher type.
+    //*************************************************************************
+    ETL_CONSTEXPR14 hasher hash_function() const ETL_NOEXCEPT
+    {
+      return hasher();
+    }
+
+    //*************************************************************************
+    /// How to compare two keys for equality.
+    ///\return An instance of the key_equal type.
+    //*************************************************************************
+    ETL_CONSTEXPR14 key_equal key_eq() const ETL_NOEXCEPT
+    {
+      return key_equal();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ETL_CONSTEXPR14 iconst_perfect_map(const value_type* element_list_,
+                                       const uint16_t*   slot_list_,
+                                       const uint16_t*   pilot_list_,
+                                       size_type         size_,
+                                       size_type         max_elements_) ETL_NOEXCEPT
+      : valid(false)
+      , seed(0U)
+      , element_list(element_list_)
+      , slot_list(slot_list_)
+      , pilot_list(pilot_list_)
+      , element_count(size_)
+      , max_elements(max_elements_)
+    {
+    }
+
+    //*************************************************************************
+    /// Builds the perfect hash for the elements.
+    /// Each attempt uses a new hash seed.
+    /// Asserts if no seed gives a perfect hash, which is a compile error for
+    /// a constexpr map.
+    ///\param slots  Receives the element index for each slot.
+    ///\param pilots Receives the pilot for each bucket.
+    //*************************************************************************
+    template <size_t Size>
+    ETL_CONSTEXPR14 void build(uint16_t* slots, uint16_t* pilots)
+    {
+      for (size_t attempt = 0U; !valid && (attempt < private_const_perfect_map::Max_Seeds); ++attempt)
+      {
+        seed  = private_const_perfect_map::seed(attempt);
+        valid = try_build<Size>(slots, pilots);
+      }
+
+      ETL_ASSERT(valid, ETL_ERROR(const_perfect_map_build_failed));
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Tries to build the perfect hash with the current seed.
+    /// Buckets are placed largest first, each searching for the first pilot
+    /// that moves all of its keys to free slots.
+    ///\return <b>true</b> if every bucket was placed.
+    //*************************************************************************
+    template <size_t Size>
+    ETL_CONSTEXPR14 bool try_build(uint16_t* slots, uint16_t* pilots) const ETL_NOEXCEPT
+    {
+      const size_t n       = element_count;
+      const size_t buckets = private_const_perfect_map::bucket_count(n);
+      const size_t table   = private_const_perfect_map::table_size(n);
+
+      uint64_t hashes[Size]                                       = {};
+      size_t   bucket_of[Size]                                    = {};
+      size_t   keys_by_bucket[Size]                               = {};
+      size_t   bucket_start[Size + 1U]                            = {};
+      size_t   bucket_fill[Size]                                  = {};
+      bool     taken[private_const_perfect_map::table_size(Size)] = {};
+      size_t   largest                                            = 0U;
+
+      // Empty slots refer to the first element, which the key compare rejects.
+      for (size_t s = 0U; s < table; ++s)
+      {
+        slots[s] = 0U;
+      }
+
+      // Hash the keys and sort them by bucket.
+      for (size_t i = 0U; i < n; ++i)
+      {
+        hashes[i]    = private_const_perfect_map::mix(static_cast<uint64_t>(hasher()(element_list[i].first)) ^ seed);
+        bucket_of[i] = private_const_perfect_map::bucket(hashes[i], buckets);
+        ++bucket_start[bucket_of[i] + 1U];
+      }
+
+      for (size_t b = 0U; b < buckets; ++b)
+      {
+        const size_t bucket_size = bucket_start[b + 1U];
+        largest = (bucket_size > largest) ? bucket_size : largest;
+        bucket_start[b + 1U] += bucket_start[b];
+      }
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        const size_t b = bucket_of[i];
+        keys_by_bucket[bucket_start[b] + bucket_fill[b]++] = i;
+      }
+
+      for (size_t bucket_size = largest; bucket_size > 0U; --bucket_size)
+      {
+        for (size_t b = 0U; b < buckets; ++b)
+        {
+          const size_t* keys = keys_by_bucket + bucket_start[b];
+
+          if ((bucket_start[b + 1U] - bucket_start[b]) != bucket_size)
+          {
+            continue;
+          }
+
+          // Keys with equal hashes can never be separated.
+          for (size_t i = 0U; i < bucket_size; ++i)
+          {
+            for (size_t j = i + 1U; j < bucket_size; ++j)
+            {
+              if (hashes[keys[i]] == hashes[keys[j]])
+              {
+                return false;
+              }
+            }
+          }
+
+          bool found = false;
+
+          for (uint32_t pilot = 0U; !found && (pilot <= private_const_perfect_map::Max_Pilot); ++pilot)
+          {
+            size_t placed = 0U;
+
+            while (placed < bucket_size)
+            {
+              const size_t s = private_const_perfect_map::slot(hashes[keys[placed]], static_cast<uint16_t>(pilot), table);
+
+              if (taken[s])
+              {
+                break;
+              }
+
+              taken[s] = true;
+              slots[s] = static_cast<uint16_t>(keys[placed]);
+              ++placed;
+            }
+
+            if (placed == bucket_size)
+            {
+              pilots[b] = static_cast<uint16_t>(pilot);
+              found = true;
+            }
+            else
+            {
+              // Release the slots taken by this attempt.
+              for (size_t i = 0U; i < placed; ++i)
+              {
+                const size_t s = private_const_perfect_map::slot(hashes[keys[i]], static_cast<uint16_t>(pilot), table);
+
+                taken[s] = false;
+                slots[s] = 0U;
+              }
+            }
+          }
+
+          if (!found)
+          {
+            return false;
+          }
+        }
+      }
+
+      return true;
+    }
+
+    bool     valid;
+    uint64_t seed;
+
+    const value_type* element_list;
+    const uint16_t*   slot_list;
+    const uint16_t*   pilot_list;
+    size_type         element_count;
+    size_type         max_elements;
+  };
+
+  //*********************************************************************
+  /// Map of constants designed for constexpr, with a perfect hash computed
+  /// from the elements at construction.
+  /// Keys must be hashable by THash at compile time.
+  /// Asserts if the keys are not unique or their hashes are not distinct.
+  //*********************************************************************
+  template <typename TKey, typename TMapped, size_t Size, typename THash = etl::const_perfect_hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>>
+  class const_perfect_map : public iconst_perfect_map<TKey, TMapped, THash, TKeyEqual>
+  {
+  public:
+
+    using base_t = iconst_perfect_map<TKey, TMapped, THash, TKeyEqual>;
+
+    using key_type        = typename base_t::key_type;
+    using value_type      = typename base_t::value_type;
+    using mapped_type     = typename base_t::mapped_type;
+    using hasher          = typename base_t::hasher;
+    using key_equal       = typename base_t::key_equal;
+    using const_reference = typename base_t::const_reference;
+    using const_pointer   = typename base_t::const_pointer;
+    using const_iterator  = typename base_t::const_iterator;
+    using size_type       = typename base_t::size_type;
+
+    static_assert((etl::is_default_constructible<key_type>::value),    "key_type must be default constructible");
+    static_assert((etl::is_default_constructible<mapped_type>::value), "mapped_type must be default constructible");
+    static_assert((Size > 0U) && (Size <= 0xFFFFU),                    "Size must be in the range 1 to 65535");
+
+    //*************************************************************************
+    ///\brief Construct a const_perfect_map from a variadic list of elements.
+    /// Static asserts if the elements are not of type <code>value_type</code>.
+    /// Static asserts if the number of elements is greater than the capacity of the const_perfect_map.
+    //*************************************************************************
+    template <typename... TElements>
+    ETL_CONSTEXPR14 explicit const_perfect_map(TElements&&... elements)
+      : base_t(element_list, slot_list, pilot_list, sizeof...(elements), Size)
+      , element_list{etl::forward<TElements>(elements)...}
+      , slot_list{}
+      , pilot_list{}
+    {
+      static_assert((etl::are_all_same<value_type, etl::decay_t<TElements>...>::value), "All elements must be value_type");
+      static_assert(sizeof...(elements) <= Size,                                        "Number of elements exceeds capacity");
+
+      this->template build<Size>(slot_list, pilot_list);
+    }
+
+  private:
+
+    value_type element_list[Size];
+    uint16_t   slot_list[private_const_perfect_map::table_size(Size)];
+    uint16_t   pilot_list[private_const_perfect_map::bucket_count(Size)];
+  };
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17
+  template <typename... TElements>
+  const_perfect_map(TElements...) -> const_perfect_map<typename etl::nth_type_t<0, TElements...>::first_type,
+                                                       typename etl::nth_type_t<0, TElements...>::second_type,
+                                                       sizeof...(TElements)>;
+#endif
+}
+
+#endif
@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/statistics_sums.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -132,12 +134,7 @@ namespace etl
     //*********************************
     void add(TInput value1, TInput value2)
     {
-      inner_product   += TCalc(value1 * value2);
-      sum_of_squares1 += TCalc(value1 * value1);
-      sum_of_squares2 += TCalc(value2 * value2);
-      sum1            += TCalc(value1);
-      sum2            += TCalc(value2);
-      ++counter;
+      accumulator.add(value1, value2);
       recalculate = true;
     }
 
@@ -155,6 +152,27 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add spans of values.
+    /// Pairs are taken up to the length of the shorter span.
+    //*********************************
+    void add(etl::span<const TInput> values1, etl::span<const TInput> values2)
+    {
+      const size_t n = (values1.size() < values2.size()) ? values1.size() : values2.size();
+
+      accumulator.add(values1.data(), values2.data(), n);
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Adds the partial result of another correlation.
+    //*********************************
+    void merge(const correlation& other)
+    {
+      accumulator.merge(other.accumulator);
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
@@ -207,7 +225,7 @@ namespace etl
     //*********************************
     size_t count() const
     {
-      return size_t(counter);
+      return size_t(accumulator.count());
     }
 
     //*********************************
@@ -215,12 +233,7 @@ namespace etl
     //*********************************
     void clear()
     {
-      inner_product     = calc_t(0);
-      sum_of_squares1   = calc_t(0);
-      sum_of_squares2   = calc_t(0);
-      sum1              = calc_t(0);
-      sum2              = calc_t(0);
-      counter           = 0U;
+      accumulator.clear();
       covariance_value  = 0.0;
       correlation_value = 0.0;
       recalculate       = true;
@@ -238,16 +251,13 @@ namespace etl
         correlation_value = 0.0;
         covariance_value  = 0.0;
 
-        if (counter != 0)
+        if (accumulator.count() != 0)
         {
-          double n = double(counter);
-          double adjustment = 1.0 / (n * (n - Adjustment));
-
-          double square_of_sum1 = (sum1 * sum1);
-          double square_of_sum2 = (sum2 * sum2);
+          double n = double(accumulator.count());
+          double adjustment = 1.0 / (n - Adjustment);
 
-          double variance1 = ((n * sum_of_squares1) - square_of_sum1) * adjustment;
-          double variance2 = ((n * sum_of_squares2) - square_of_sum2) * adjustment;
+          double variance1 = accumulator.m2_1() * adjustment;
+          double variance2 = accumulator.m2_2() * adjustment;
 
           double stddev1 = 0.0;
           double stddev2 = 0.0;
@@ -262,7 +272,7 @@ namespace etl
             stddev2 = sqrt(variance2);
           }
 
-          covariance_value = ((n * inner_product) - (sum1 * sum2)) * adjustment;
+          covariance_value = accumulator.co_moment() * adjustment;
 
           if ((stddev1 > 0.0) && (stddev2 > 0.0))
           {            
@@ -274,12 +284,7 @@ namespace etl
       }
     }
 
-    calc_t   inner_product;
-    calc_t   sum_of_squares1;
-    calc_t   sum_of_squares2;
-    calc_t   sum1;
-    calc_t   sum2;
-    uint32_t counter;
+    private_statistics::co_moments<calc_t> accumulator;
     mutable double covariance_value;
     mutable double correlation_value;
     mutable bool   recalculate;
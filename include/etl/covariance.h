@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/statistics_sums.h"
 
 #include <stdint.h>
 
@@ -131,10 +133,7 @@ namespace etl
     //*********************************
     void add(TInput value1, TInput value2)
     {
-      inner_product += TCalc(value1 * value2);
-      sum1          += TCalc(value1);
-      sum2          += TCalc(value2);
-      ++counter;
+      accumulator.add(value1, value2);
       recalculate = true;
     }
 
@@ -152,6 +151,27 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add spans of values.
+    /// Pairs are taken up to the length of the shorter span.
+    //*********************************
+    void add(etl::span<const TInput> values1, etl::span<const TInput> values2)
+    {
+      const size_t n = (values1.size() < values2.size()) ? values1.size() : values2.size();
+
+      accumulator.add(values1.data(), values2.data(), n);
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Adds the partial result of another covariance.
+    //*********************************
+    void merge(const covariance& other)
+    {
+      accumulator.merge(other.accumulator);
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
@@ -180,12 +200,11 @@ namespace etl
       {
         covariance_value = 0.0;
 
-        if (counter != 0)
+        if (accumulator.count() != 0)
         {
-          double n = double(counter);
-          double adjustment = 1.0 / (n * (n - Adjustment));
+          double n = double(accumulator.count());
 
-          covariance_value = ((n * inner_product) - (sum1 * sum2)) * adjustment;
+          covariance_value = accumulator.co_moment() / (n - Adjustment);
 
           recalculate = false;
         }
@@ -207,7 +226,7 @@ namespace etl
     //*********************************
     size_t count() const
     {
-      return size_t(counter);
+      return size_t(accumulator.count());
     }
 
     //*********************************
@@ -215,20 +234,14 @@ namespace etl
     //*********************************
     void clear()
     {
-      inner_product    = calc_t(0);
-      sum1             = calc_t(0);
-      sum2             = calc_t(0);
-      counter          = 0U;
+      accumulator.clear();
       covariance_value = 0.0;
       recalculate      = true;
     }
 
   private:
   
-    calc_t   inner_product;
-    calc_t   sum1;
-    calc_t   sum2;
-    uint32_t counter;
+    private_statistics::co_moments<calc_t> accumulator;
     mutable double covariance_value;
     mutable bool   recalculate;
   };
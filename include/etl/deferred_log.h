@@ -0,0 +1,369 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DEFERRED_LOG_INCLUDED
+#define ETL_DEFERRED_LOG_INCLUDED
+
+#include "platform.h"
+#include "array.h"
+#include "array_view.h"
+#include "bip_buffer_spsc_atomic.h"
+#include "format.h"
+#include "span.h"
+#include "static_assert.h"
+#include "string_view.h"
+
+#include <string.h>
+#include <stdint.h>
+
+#if ETL_USING_CPP11 && ETL_HAS_ATOMIC
+
+namespace etl
+{
+  namespace private_deferred_log
+  {
+    // Identifies the type of each stored argument
+    enum class arg_tag : uint8_t
+    {
+      BOOL,
+      CHAR,
+      INT,
+      UNSIGNED_INT,
+      LONG_LONG,
+      UNSIGNED_LONG_LONG,
+      FLOAT,
+      DOUBLE,
+      LONG_DOUBLE,
+      STRING,
+      POINTER
+    };
+
+    template <typename T> struct tag_of;
+    template <> struct tag_of<bool>                   { static ETL_CONSTANT arg_tag value = arg_tag::BOOL; };
+    template <> struct tag_of<char>                   { static ETL_CONSTANT arg_tag value = arg_tag::CHAR; };
+    template <> struct tag_of<int>                    { static ETL_CONSTANT arg_tag value = arg_tag::INT; };
+    template <> struct tag_of<unsigned int>           { static ETL_CONSTANT arg_tag value = arg_tag::UNSIGNED_INT; };
+    template <> struct tag_of<long long int>          { static ETL_CONSTANT arg_tag value = arg_tag::LONG_LONG; };
+    template <> struct tag_of<unsigned long long int> { static ETL_CONSTANT arg_tag value = arg_tag::UNSIGNED_LONG_LONG; };
+    template <> struct tag_of<float>                  { static ETL_CONSTANT arg_tag value = arg_tag::FLOAT; };
+    template <> struct tag_of<double>                 { static ETL_CONSTANT arg_tag value = arg_tag::DOUBLE; };
+    template <> struct tag_of<long double>            { static ETL_CONSTANT arg_tag value = arg_tag::LONG_DOUBLE; };
+    template <> struct tag_of<const void*>            { static ETL_CONSTANT arg_tag value = arg_tag::POINTER; };
+
+    // Record header: record size, format string pointer, format string size, argument count
+    static ETL_CONSTANT size_t Header_Size = sizeof(uint16_t) + sizeof(const char*) + sizeof(uint16_t) + sizeof(uint8_t);
+
+    // Records have 16 bit sizes
+    static ETL_CONSTANT size_t Max_Record_Size = 0xFFFFU;
+
+    // Longer string arguments are truncated
+    static ETL_CONSTANT size_t Max_String_Size = 0xFFU;
+
+    // The context only selects the argument conversions, the stored values do not depend on it
+    using encode_context = etl::format_context<char*>;
+
+    template <typename T>
+    void write_value(uint8_t*& p, const T& value)
+    {
+      memcpy(p, &value, sizeof(T));
+      p += sizeof(T);
+    }
+
+    template <typename T>
+    T read_value(const uint8_t*& p)
+    {
+      T value;
+      memcpy(&value, p, sizeof(T));
+      p += sizeof(T);
+      return value;
+    }
+
+    inline size_t stored_string_size(etl::string_view s)
+    {
+      return (s.size() < Max_String_Size) ? s.size() : Max_String_Size;
+    }
+
+    // Returns the number of bytes an argument is stored in
+    struct size_visitor
+    {
+      size_t operator()(etl::monostate) const
+      {
+        return 0U;
+      }
+
+      size_t operator()(const char* s) const
+      {
+        return operator()(etl::string_view(s));
+      }
+
+      size_t operator()(etl::string_view s) const
+      {
+        return sizeof(arg_tag) + sizeof(uint8_t) + stored_string_size(s);
+      }
+
+      template <typename T>
+      size_t operator()(T) const
+      {
+        return sizeof(arg_tag) + sizeof(T);
+      }
+    };
+
+    // Stores an argument as its tag followed by its raw bytes
+    // Strings are copied, as they may not outlive the call
+    struct write_visitor
+    {
+      explicit write_visitor(uint8_t* p_)
+      : p(p_)
+      {
+      }
+
+      void operator()(etl::monostate)
+      {
+      }
+
+      void operator()(const char* s)
+      {
+        operator()(etl::string_view(s));
+      }
+
+      void operator()(etl::string_view s)
+      {
+        const uint8_t size = static_cast<uint8_t>(stored_string_size(s));
+
+        write_value(p, arg_tag::STRING);
+        write_value(p, size);
+        memcpy(p, s.data(), size);
+        p += size;
+      }
+
+      template <typename T>
+      void operator()(T value)
+      {
+        const arg_tag tag = tag_of<T>::value;
+
+        write_value(p, tag);
+        write_value(p, value);
+      }
+
+      uint8_t* p;
+    };
+
+    // Rebuilds a stored argument
+    // Strings refer to the copy in the record
+    template <typename TArg>
+    TArg read_arg(const uint8_t*& p)
+    {
+      switch (read_value<arg_tag>(p))
+      {
+        case arg_tag::BOOL:               return TArg(read_value<bool>(p));
+        case arg_tag::CHAR:               return TArg(read_value<char>(p));
+        case arg_tag::INT:                return TArg(read_value<int>(p));
+        case arg_tag::UNSIGNED_INT:       return TArg(read_value<unsigned int>(p));
+        case arg_tag::LONG_LONG:          return TArg(read_value<long long int>(p));
+        case arg_tag::UNSIGNED_LONG_LONG: return TArg(read_value<unsigned long long int>(p));
+        case arg_tag::FLOAT:              return TArg(read_value<float>(p));
+        case arg_tag::DOUBLE:             return TArg(read_value<double>(p));
+        case arg_tag::LONG_DOUBLE:        return TArg(read_value<long double>(p));
+        case arg_tag::POINTER:            return TArg(read_value<const void*>(p));
+        case arg_tag::STRING:
+        {
+          const uint8_t size = read_value<uint8_t>(p);
+          etl::string_view s(reinterpret_cast<const char*>(p), size);
+          p += size;
+          return TArg(s);
+        }
+        default:                          return TArg();
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Deferred formatting log.
+  /// log() stores the format string pointer and the raw argument values in a
+  /// lock free single producer, single consumer byte ring, leaving the text
+  /// to be rendered later by format_next(), typically from a background task.
+  /// The format string must outlive the record, as only its address is stored.
+  /// Records are:
+  ///   uint16_t record size, const char* format, uint16_t format size, uint8_t argument count,
+  ///   then per argument a one byte tag followed by the value bytes, or for strings
+  ///   a one byte length followed by the characters (truncated to 255).
+  /// All fields are in native byte order and unaligned.
+  ///\tparam Buffer_Size   The size of the byte ring.
+  ///\tparam Max_Arguments The maximum number of arguments in one record.
+  //***************************************************************************
+  template <size_t Buffer_Size, size_t Max_Arguments = 8U>
+  class deferred_log
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Buffer_Size > private_deferred_log::Header_Size, "Buffer_Size too small");
+    ETL_STATIC_ASSERT(Max_Arguments <= 255U, "Max_Arguments must fit in one byte");
+
+    deferred_log()
+    : dropped_records(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Stores a record for later formatting.
+    /// Returns false and counts the record as dropped if there is no room.
+    /// Producer side only.
+    //*************************************************************************
+    template <typename... Args>
+    bool log(etl::format_string<Args...> fmt, Args&&... args)
+    {
+      ETL_STATIC_ASSERT(sizeof...(Args) <= Max_Arguments, "Too many arguments");
+
+      auto the_args = etl::make_format_args<char*, private_deferred_log::encode_context>(args...);
+      etl::array_view<etl::basic_format_arg<private_deferred_log::encode_context>> arg_list = the_args.get();
+      const etl::string_view format = fmt.get();
+
+      size_t record_size = private_deferred_log::Header_Size;
+
+      for (size_t i = 0U; i < arg_list.size(); ++i)
+      {
+        record_size += arg_list[i].template visit<size_t>(private_deferred_log::size_visitor());
+      }
+
+      etl::span<uint8_t> record;
+
+      if ((record_size <= private_deferred_log::Max_Record_Size) && (format.size() <= private_deferred_log::Max_Record_Size))
+      {
+        record = ring.write_reserve(record_size);
+      }
+
+      if (record.size() < record_size)
+      {
+        dropped_records.fetch_add(1U, etl::memory_order_relaxed);
+        return false;
+      }
+
+      uint8_t* p = record.data();
+      private_deferred_log::write_value(p, static_cast<uint16_t>(record_size));
+      private_deferred_log::write_value(p, format.data());
+      private_deferred_log::write_value(p, static_cast<uint16_t>(format.size()));
+      private_deferred_log::write_value(p, static_cast<uint8_t>(arg_list.size()));
+
+      private_deferred_log::write_visitor writer(p);
+
+      for (size_t i = 0U; i < arg_list.size(); ++i)
+      {
+        arg_list[i].template visit<void>(writer);
+      }
+
+      ring.write_commit(record.first(record_size));
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Formats the oldest record to 'out' and releases it.
+    /// Returns false if there are no records.
+    /// Consumer side only.
+    //*************************************************************************
+    template <typename OutputIt,
+              typename = etl::enable_if_t<!etl::is_base_of<etl::istring, OutputIt>::value>>
+    bool format_next(OutputIt& out)
+    {
+      etl::span<uint8_t> readable = ring.read_reserve();
+
+      if (readable.empty())
+      {
+        return false;
+      }
+
+      const uint8_t* p = readable.data();
+      const size_t     record_size = private_deferred_log::read_value<uint16_t>(p);
+      const char*      format      = private_deferred_log::read_value<const char*>(p);
+      const size_t     format_size = private_deferred_log::read_value<uint16_t>(p);
+      const size_t     arg_count   = private_deferred_log::read_value<uint8_t>(p);
+
+      etl::array<etl::format_arg<OutputIt>, Max_Arguments> arg_list;
+
+      for (size_t i = 0U; i < arg_count; ++i)
+      {
+        arg_list[i] = private_deferred_log::read_arg<etl::format_arg<OutputIt>>(p);
+      }
+
+      out = etl::vformat_to(out,
+                            etl::string_view(format, format_size),
+                            etl::format_args<OutputIt>(etl::array_view<etl::format_arg<OutputIt>>(arg_list.data(), arg_count)));
+
+      ring.read_commit(readable.first(record_size));
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Formats the oldest record to 'out', replacing its contents, and releases it.
+    /// Output that does not fit is truncated.
+    /// Returns false, leaving 'out' unchanged, if there are no records.
+    /// Consumer side only.
+    //*************************************************************************
+    bool format_next(etl::istring& out)
+    {
+      using limit_iterator = private_format::limit_iterator<etl::istring::iterator>;
+
+      etl::istring::iterator begin = out.begin();
+      limit_iterator it(begin, out.max_size());
+
+      if (!format_next(it))
+      {
+        return false;
+      }
+
+      out.uninitialized_resize(static_cast<size_t>(it.get() - out.begin()));
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns true if there are no records waiting to be formatted.
+    //*************************************************************************
+    bool empty() const
+    {
+      return ring.empty();
+    }
+
+    //*************************************************************************
+    /// Returns the number of records dropped because the ring was full.
+    //*************************************************************************
+    size_t dropped() const
+    {
+      return dropped_records.load(etl::memory_order_relaxed);
+    }
+
+  private:
+
+    etl::bip_buffer_spsc_atomic<uint8_t, Buffer_Size> ring;
+    etl::atomic<size_t> dropped_records;
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,1012 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EXECUTION_INCLUDED
+#define ETL_EXECUTION_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "memory.h"
+#include "span.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup execution execution
+/// Parallel versions of algorithms for random access ranges.
+/// The range is split into at most one chunk per worker, each chunk being
+/// handed to a user supplied worker pool. No memory is allocated.
+///\ingroup algorithms
+//*****************************************************************************
+
+#if !defined(ETL_EXECUTION_MAX_CHUNKS)
+  /// The maximum number of chunks that a range will be split into.
+  #define ETL_EXECUTION_MAX_CHUNKS 64
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for parallel algorithms.
+  ///\ingroup execution
+  //***************************************************************************
+  class execution_exception : public etl::exception
+  {
+  public:
+
+    execution_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The buffer is smaller than the range.
+  ///\ingroup execution
+  //***************************************************************************
+  class execution_buffer_too_small : public etl::execution_exception
+  {
+  public:
+
+    execution_buffer_too_small(string_type file_name_, numeric_type line_number_)
+      : etl::execution_exception(ETL_ERROR_TEXT("execution:buffer too small", ETL_EXECUTION_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Interface for a job that is split into indexed chunks.
+  ///\ingroup execution
+  //***************************************************************************
+  class iparallel_task
+  {
+  public:
+
+    //*************************************************************************
+    /// Processes the chunk at 'index'.
+    /// May be called concurrently for different indexes.
+    //*************************************************************************
+    virtual void operator ()(size_t index) = 0;
+
+  protected:
+
+    virtual ~iparallel_task()
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Interface for a pool of workers.
+  /// Implement this over the threads or tasks that the platform provides.
+  ///\ingroup execution
+  //***************************************************************************
+  class iworker_pool
+  {
+  public:
+
+    //*************************************************************************
+    /// The number of chunks that may be processed at the same time.
+    //*************************************************************************
+    virtual size_t concurrency() const = 0;
+
+    //*************************************************************************
+    /// Calls task(index) for every index in [0, count), in any order and on
+    /// any worker. Returns when all of the calls have completed.
+    //*************************************************************************
+    virtual void run(etl::iparallel_task& task, size_t count) = 0;
+
+  protected:
+
+    virtual ~iworker_pool()
+    {
+    }
+  };
+
+  namespace execution
+  {
+    //*************************************************************************
+    /// Sequenced execution policy.
+    /// The algorithms run on the calling thread.
+    //*************************************************************************
+    class sequenced_policy
+    {
+    };
+
+    static ETL_CONSTANT sequenced_policy seq = sequenced_policy();
+
+    //*************************************************************************
+    /// Parallel execution policy.
+    /// The algorithms split the range into chunks of at least
+    /// 'min_chunk_size' elements and run them on the worker pool.
+    //*************************************************************************
+    class parallel_policy
+    {
+    public:
+
+      static ETL_CONSTANT size_t Default_Min_Chunk_Size = 1024U;
+      static ETL_CONSTANT size_t Max_Chunks             = ETL_EXECUTION_MAX_CHUNKS;
+
+      //***********************************************************************
+      /// Constructor.
+      //***********************************************************************
+      parallel_policy(etl::iworker_pool& pool_, size_t min_chunk_size_ = Default_Min_Chunk_Size)
+        : p_pool(&pool_)
+        , min_chunk(min_chunk_size_ == 0U ? 1U : min_chunk_size_)
+      {
+      }
+
+      //***********************************************************************
+      /// The worker pool.
+      //***********************************************************************
+      etl::iworker_pool& pool() const
+      {
+        return *p_pool;
+      }
+
+      //***********************************************************************
+      /// The minimum number of elements in a chunk.
+      //***********************************************************************
+      size_t min_chunk_size() const
+      {
+        return min_chunk;
+      }
+
+      //***********************************************************************
+      /// The number of chunks that a range of 'size' elements will be split into.
+      //***********************************************************************
+      size_t chunk_count(size_t size) const
+      {
+        size_t count = size / min_chunk;
+        count = etl::min(count, p_pool->concurrency());
+        count = etl::min(count, size_t(Max_Chunks));
+
+        return (count == 0U) ? 1U : count;
+      }
+
+    private:
+
+      etl::iworker_pool* p_pool;
+      size_t             min_chunk;
+    };
+
+    //*************************************************************************
+    /// Creates a parallel execution policy for the worker pool.
+    //*************************************************************************
+    inline parallel_policy par(etl::iworker_pool& pool, size_t min_chunk_size = parallel_policy::Default_Min_Chunk_Size)
+    {
+      return parallel_policy(pool, min_chunk_size);
+    }
+  }
+
+  //***************************************************************************
+  /// Checks whether T is an execution policy.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename T>
+  struct is_execution_policy : etl::false_type
+  {
+  };
+
+  template <>
+  struct is_execution_policy<etl::execution::sequenced_policy> : etl::true_type
+  {
+  };
+
+  template <>
+  struct is_execution_policy<etl::execution::parallel_policy> : etl::true_type
+  {
+  };
+
+  namespace private_execution
+  {
+    //*************************************************************************
+    /// Splits 'size' elements into 'count' chunks that differ in size by at
+    /// most one element.
+    //*************************************************************************
+    class chunks
+    {
+    public:
+
+      chunks(size_t size_, size_t count_)
+        : quotient(size_ / count_)
+        , remainder(size_ % count_)
+        , n_chunks(count_)
+      {
+      }
+
+      size_t count() const
+      {
+        return n_chunks;
+      }
+
+      /// The offset of the first element of the chunk.
+      size_t begin(size_t index) const
+      {
+        return (quotient * index) + etl::min(index, remainder);
+      }
+
+      /// The offset of one past the last element of the chunk.
+      size_t end(size_t index) const
+      {
+        return begin(index + 1U);
+      }
+
+    private:
+
+      size_t quotient;
+      size_t remainder;
+      size_t n_chunks;
+    };
+
+    //*************************************************************************
+    /// Runs the task for each chunk.
+    /// A single chunk is run on the calling thread.
+    //*************************************************************************
+    inline void run(const etl::execution::parallel_policy& policy, etl::iparallel_task& task, size_t count)
+    {
+      if (count == 1U)
+      {
+        task(0U);
+      }
+      else
+      {
+        policy.pool().run(task, count);
+      }
+    }
+
+    //*************************************************************************
+    template <typename TIterator, typename TFunction>
+    class for_each_task : public etl::iparallel_task
+    {
+    public:
+
+      for_each_task(TIterator first_, const chunks& chunks_, TFunction& function_)
+        : first(first_)
+        , chunk(chunks_)
+        , function(function_)
+      {
+      }
+
+      void operator ()(size_t index) ETL_OVERRIDE
+      {
+        etl::for_each(first + chunk.begin(index), first + chunk.end(index), function);
+      }
+
+    private:
+
+      TIterator     first;
+      const chunks& chunk;
+      TFunction&    function;
+    };
+
+    //*************************************************************************
+    template <typename TInputIterator, typename TOutputIterator, typename TUnaryFunction>
+    class transform_task : public etl::iparallel_task
+    {
+    public:
+
+      transform_task(TInputIterator first_, TOutputIterator d_first_, const chunks& chunks_, TUnaryFunction& function_)
+        : first(first_)
+        , d_first(d_first_)
+        , chunk(chunks_)
+        , function(function_)
+      {
+      }
+
+      void operator ()(size_t index) ETL_OVERRIDE
+      {
+        etl::transform(first + chunk.begin(index), first + chunk.end(index), d_first + chunk.begin(index), function);
+      }
+
+    private:
+
+      TInputIterator  first;
+      TOutputIterator d_first;
+      const chunks&   chunk;
+      TUnaryFunction& function;
+    };
+
+    //*************************************************************************
+    template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TBinaryFunction>
+    class transform2_task : public etl::iparallel_task
+    {
+    public:
+
+      transform2_task(TInputIterator1 first1_, TInputIterator2 first2_, TOutputIterator d_first_, const chunks& chunks_, TBinaryFunction& function_)
+        : first1(first1_)
+        , first2(first2_)
+        , d_first(d_first_)
+        , chunk(chunks_)
+        , function(function_)
+      {
+      }
+
+      void operator ()(size_t index) ETL_OVERRIDE
+      {
+        const size_t begin = chunk.begin(index);
+
+        etl::transform(first1 + begin, first1 + chunk.end(index), first2 + begin, d_first + begin, function);
+      }
+
+    private:
+
+      TInputIterator1  first1;
+      TInputIterator2  first2;
+      TOutputIterator  d_first;
+      const chunks&    chunk;
+      TBinaryFunction& function;
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename T, typename TBinaryOperation>
+    class reduce_task : public etl::iparallel_task
+    {
+    public:
+
+      reduce_task(TIterator first_, const chunks& chunks_, TBinaryOperation& operation_)
+        : first(first_)
+        , chunk(chunks_)
+        , operation(operation_)
+      {
+      }
+
+      ~reduce_task()
+      {
+        for (size_t i = 0U; i < chunk.count(); ++i)
+        {
+          partials[int(i)].~T();
+        }
+      }
+
+      void operator ()(size_t index) ETL_OVERRIDE
+      {
+        TIterator itr  = first + chunk.begin(index);
+        TIterator last = first + chunk.end(index);
+
+        // Every chunk holds at least one element.
+        T sum = *itr;
+
+        while (++itr != last)
+        {
+          sum = operation(sum, *itr);
+        }
+
+        ::new (&partials[int(index)]) T(sum);
+      }
+
+      /// Combines the partial results of the chunks with the initial value.
+      T result(T init) const
+      {
+        for (size_t i = 0U; i < chunk.count(); ++i)
+        {
+          init = operation(init, partials[int(i)]);
+        }
+
+        return init;
+      }
+
+    private:
+
+      TIterator         first;
+      const chunks&     chunk;
+      TBinaryOperation& operation;
+      etl::uninitialized_buffer_of<T, etl::execution::parallel_policy::Max_Chunks> partials;
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    class fill_task : public etl::iparallel_task
+    {
+    public:
+
+      fill_task(TIterator first_, const chunks& chunks_, const T& value_)
+        : first(first_)
+        , chunk(chunks_)
+        , value(value_)
+      {
+      }
+
+      void operator ()(size_t index) ETL_OVERRIDE
+      {
+        etl::fill(first + chunk.begin(index), first + chunk.end(index), value);
+      }
+
+    private:
+
+      TIterator     first;
+      const chunks& chunk;
+      const T&      value;
+    };
+
+    //*************************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    class copy_task : public etl::iparallel_task
+    {
+    public:
+
+      copy_task(TInputIterator first_, TOutputIterator d_first_, const chunks& chunks_)
+        : first(first_)
+        , d_first(d_first_)
+        , chunk(chunks_)
+      {
+      }
+
+      void operator ()(size_t index) ETL_OVERRIDE
+      {
+        etl::copy(first + chunk.begin(index), first + chunk.end(index), d_first + chunk.begin(index));
+      }
+
+    private:
+
+      TInputIterator  first;
+      TOutputIterator d_first;
+      const chunks&   chunk;
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename TUnaryPredicate>
+    class count_if_task : public etl::iparallel_task
+    {
+    public:
+
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      count_if_task(TIterator first_, const chunks& chunks_, TUnaryPredicate& predicate_)
+        : first(first_)
+        , chunk(chunks_)
+        , predicate(predicate_)
+      {
+      }
+
+      void operator ()(size_t index) ETL_OVERRIDE
+      {
+        partials[index] = etl::count_if(first + chunk.begin(index), first + chunk.end(index), predicate);
+      }
+
+      difference_type result() const
+      {
+        difference_type n = 0;
+
+        for (size_t i = 0U; i < chunk.count(); ++i)
+        {
+          n += partials[i];
+        }
+
+        return n;
+      }
+
+    private:
+
+      TIterator        first;
+      const chunks&    chunk;
+      TUnaryPredicate& predicate;
+      difference_type  partials[etl::execution::parallel_policy::Max_Chunks];
+    };
+
+    //*************************************************************************
+    /// Merges the adjacent sorted ranges [first, middle) and [middle, last)
+    /// without a buffer, by recursive rotation.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void merge_in_place(TIterator first, TIterator middle, TIterator last, TCompare& compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type length1 = middle - first;
+      const difference_type length2 = last - middle;
+
+      if ((length1 == 0) || (length2 == 0))
+      {
+        return;
+      }
+
+      if ((length1 + length2) == 2)
+      {
+        if (compare(*middle, *first))
+        {
+          etl::iter_swap(first, middle);
+        }
+
+        return;
+      }
+
+      TIterator first_cut;
+      TIterator second_cut;
+
+      if (length1 > length2)
+      {
+        first_cut  = first + (length1 / 2);
+        second_cut = etl::lower_bound(middle, last, *first_cut, compare);
+      }
+      else
+      {
+        second_cut = middle + (length2 / 2);
+        first_cut  = etl::upper_bound(first, middle, *second_cut, compare);
+      }
+
+      TIterator new_middle;
+
+      if (first_cut == middle)
+      {
+        new_middle = second_cut;
+      }
+      else if (middle == second_cut)
+      {
+        new_middle = first_cut;
+      }
+      else
+      {
+        new_middle = etl::rotate(first_cut, middle, second_cut);
+      }
+
+      merge_in_place(first, first_cut, new_middle, compare);
+      merge_in_place(new_middle, second_cut, last, compare);
+    }
+
+    //*************************************************************************
+    /// Merges the adjacent sorted ranges [first, middle) and [middle, last)
+    /// by moving the first range to the buffer.
+    //*************************************************************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void merge_with_buffer(TIterator first, TIterator middle, TIterator last, TBufferIterator buffer, TCompare& compare)
+    {
+      TBufferIterator buffer_last = etl::move(first, middle, buffer);
+
+      // The output never overtakes the unread part of the second range.
+      while ((buffer != buffer_last) && (middle != last))
+      {
+        if (compare(*middle, *buffer))
+        {
+          *first = ETL_MOVE(*middle);
+          ++middle;
+        }
+        else
+        {
+          *first = ETL_MOVE(*buffer);
+          ++buffer;
+        }
+
+        ++first;
+      }
+
+      etl::move(buffer, buffer_last, first);
+    }
+
+    //*************************************************************************
+    /// Sorts the chunks, then merges pairs of adjacent runs until a single
+    /// run remains. The merges in each pass are run in parallel.
+    //*************************************************************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    class sort_task : public etl::iparallel_task
+    {
+    public:
+
+      sort_task(TIterator first_, TBufferIterator buffer_, bool has_buffer_, const chunks& chunks_, TCompare& compare_)
+        : first(first_)
+        , buffer(buffer_)
+        , has_buffer(has_buffer_)
+        , chunk(chunks_)
+        , compare(compare_)
+        , width(0U)
+      {
+      }
+
+      /// Sets the number of chunks in each run to merge.
+      /// Zero selects sorting of the individual chunks.
+      void set_width(size_t width_)
+      {
+        width = width_;
+      }
+
+      void operator ()(size_t index) ETL_OVERRIDE
+      {
+        if (width == 0U)
+        {
+          etl::sort(first + chunk.begin(index), first + chunk.end(index), compare);
+        }
+        else
+        {
+          // Merge run 'index * 2' with run 'index * 2 + 1'.
+          const size_t first_chunk = index * 2U * width;
+          const size_t begin       = chunk.begin(first_chunk);
+          const size_t middle      = chunk.begin(first_chunk + width);
+          const size_t end         = chunk.begin(etl::min(first_chunk + (2U * width), chunk.count()));
+
+          if (has_buffer)
+          {
+            merge_with_buffer(first + begin, first + middle, first + end, buffer + begin, compare);
+          }
+          else
+          {
+            merge_in_place(first + begin, first + middle, first + end, compare);
+          }
+        }
+      }
+
+    private:
+
+      TIterator       first;
+      TBufferIterator buffer;
+      bool            has_buffer;
+      const chunks&   chunk;
+      TCompare&       compare;
+      size_t          width;
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void sort(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TBufferIterator buffer, bool has_buffer, TCompare& compare)
+    {
+      const size_t size = static_cast<size_t>(etl::distance(first, last));
+      const chunks chunk(size, policy.chunk_count(size));
+
+      sort_task<TIterator, TBufferIterator, TCompare> task(first, buffer, has_buffer, chunk, compare);
+
+      run(policy, task, chunk.count());
+
+      for (size_t width = 1U; width < chunk.count(); width *= 2U)
+      {
+        task.set_width(width);
+
+        // Pairs of runs. An unpaired last run is already merged.
+        run(policy, task, (chunk.count() - width + (2U * width) - 1U) / (2U * width));
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Calls the function for each element of the range.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TFunction>
+  void for_each(const etl::execution::sequenced_policy&, TIterator first, TIterator last, TFunction function)
+  {
+    etl::for_each(first, last, function);
+  }
+
+  //***************************************************************************
+  /// Calls the function for each element of the range, in parallel.
+  /// The function may be called concurrently.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TFunction>
+  void for_each(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TFunction function)
+  {
+    const size_t size = static_cast<size_t>(etl::distance(first, last));
+    const private_execution::chunks chunk(size, policy.chunk_count(size));
+
+    private_execution::for_each_task<TIterator, TFunction> task(first, chunk, function);
+
+    private_execution::run(policy, task, chunk.count());
+  }
+
+  //***************************************************************************
+  /// Transforms the elements of the range.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename TUnaryFunction>
+  TOutputIterator transform(const etl::execution::sequenced_policy&, TInputIterator first, TInputIterator last, TOutputIterator d_first, TUnaryFunction function)
+  {
+    return etl::transform(first, last, d_first, function);
+  }
+
+  //***************************************************************************
+  /// Transforms the elements of the range, in parallel.
+  /// The function may be called concurrently.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename TUnaryFunction>
+  TOutputIterator transform(const etl::execution::parallel_policy& policy, TInputIterator first, TInputIterator last, TOutputIterator d_first, TUnaryFunction function)
+  {
+    const size_t size = static_cast<size_t>(etl::distance(first, last));
+    const private_execution::chunks chunk(size, policy.chunk_count(size));
+
+    private_execution::transform_task<TInputIterator, TOutputIterator, TUnaryFunction> task(first, d_first, chunk, function);
+
+    private_execution::run(policy, task, chunk.count());
+
+    return d_first + size;
+  }
+
+  //***************************************************************************
+  /// Transforms the elements of two ranges.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TBinaryFunction>
+  TOutputIterator transform(const etl::execution::sequenced_policy&, TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TOutputIterator d_first, TBinaryFunction function)
+  {
+    return etl::transform(first1, last1, first2, d_first, function);
+  }
+
+  //***************************************************************************
+  /// Transforms the elements of two ranges, in parallel.
+  /// The function may be called concurrently.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TBinaryFunction>
+  TOutputIterator transform(const etl::execution::parallel_policy& policy, TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TOutputIterator d_first, TBinaryFunction function)
+  {
+    const size_t size = static_cast<size_t>(etl::distance(first1, last1));
+    const private_execution::chunks chunk(size, policy.chunk_count(size));
+
+    private_execution::transform2_task<TInputIterator1, TInputIterator2, TOutputIterator, TBinaryFunction> task(first1, first2, d_first, chunk, function);
+
+    private_execution::run(policy, task, chunk.count());
+
+    return d_first + size;
+  }
+
+  //***************************************************************************
+  /// Reduces the range with the operation.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  T reduce(const etl::execution::sequenced_policy&, TIterator first, TIterator last, T init, TBinaryOperation operation)
+  {
+    return etl::accumulate(first, last, init, operation);
+  }
+
+  //***************************************************************************
+  /// Reduces the range with the operation, in parallel.
+  /// The operation must be associative and commutative, as the elements may
+  /// be grouped in any order.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  T reduce(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, T init, TBinaryOperation operation)
+  {
+    const size_t size = static_cast<size_t>(etl::distance(first, last));
+
+    if (size == 0U)
+    {
+      return init;
+    }
+
+    const private_execution::chunks chunk(size, policy.chunk_count(size));
+
+    private_execution::reduce_task<TIterator, T, TBinaryOperation> task(first, chunk, operation);
+
+    private_execution::run(policy, task, chunk.count());
+
+    return task.result(init);
+  }
+
+  //***************************************************************************
+  /// Sums the range.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TExecutionPolicy, typename TIterator, typename T>
+  typename etl::enable_if<etl::is_execution_policy<TExecutionPolicy>::value, T>::type
+    reduce(const TExecutionPolicy& policy, TIterator first, TIterator last, T init)
+  {
+    return etl::reduce(policy, first, last, init, etl::plus<T>());
+  }
+
+  //***************************************************************************
+  /// Sums the range, starting from a value initialised element.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TExecutionPolicy, typename TIterator>
+  typename etl::enable_if<etl::is_execution_policy<TExecutionPolicy>::value, typename etl::iterator_traits<TIterator>::value_type>::type
+    reduce(const TExecutionPolicy& policy, TIterator first, TIterator last)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    return etl::reduce(policy, first, last, value_type(), etl::plus<value_type>());
+  }
+
+  //***************************************************************************
+  /// Accumulates the range with the operation.
+  /// The parallel version is equivalent to etl::reduce.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TExecutionPolicy, typename TIterator, typename T, typename TBinaryOperation>
+  typename etl::enable_if<etl::is_execution_policy<TExecutionPolicy>::value, T>::type
+    accumulate(const TExecutionPolicy& policy, TIterator first, TIterator last, T init, TBinaryOperation operation)
+  {
+    return etl::reduce(policy, first, last, init, operation);
+  }
+
+  //***************************************************************************
+  /// Accumulates the range.
+  /// The parallel version is equivalent to etl::reduce.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TExecutionPolicy, typename TIterator, typename T>
+  typename etl::enable_if<etl::is_execution_policy<TExecutionPolicy>::value, T>::type
+    accumulate(const TExecutionPolicy& policy, TIterator first, TIterator last, T init)
+  {
+    return etl::reduce(policy, first, last, init, etl::plus<T>());
+  }
+
+  //***************************************************************************
+  /// Fills the range with the value.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  void fill(const etl::execution::sequenced_policy&, TIterator first, TIterator last, const T& value)
+  {
+    etl::fill(first, last, value);
+  }
+
+  //***************************************************************************
+  /// Fills the range with the value, in parallel.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  void fill(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, const T& value)
+  {
+    const size_t size = static_cast<size_t>(etl::distance(first, last));
+    const private_execution::chunks chunk(size, policy.chunk_count(size));
+
+    private_execution::fill_task<TIterator, T> task(first, chunk, value);
+
+    private_execution::run(policy, task, chunk.count());
+  }
+
+  //***************************************************************************
+  /// Copies the range.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  TOutputIterator copy(const etl::execution::sequenced_policy&, TInputIterator first, TInputIterator last, TOutputIterator d_first)
+  {
+    return etl::copy(first, last, d_first);
+  }
+
+  //***************************************************************************
+  /// Copies the range, in parallel.
+  /// The ranges must not overlap.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  TOutputIterator copy(const etl::execution::parallel_policy& policy, TInputIterator first, TInputIterator last, TOutputIterator d_first)
+  {
+    const size_t size = static_cast<size_t>(etl::distance(first, last));
+    const private_execution::chunks chunk(size, policy.chunk_count(size));
+
+    private_execution::copy_task<TInputIterator, TOutputIterator> task(first, d_first, chunk);
+
+    private_execution::run(policy, task, chunk.count());
+
+    return d_first + size;
+  }
+
+  //***************************************************************************
+  /// Counts the elements that satisfy the predicate.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  typename etl::iterator_traits<TIterator>::difference_type
+    count_if(const etl::execution::sequenced_policy&, TIterator first, TIterator last, TUnaryPredicate predicate)
+  {
+    return etl::count_if(first, last, predicate);
+  }
+
+  //***************************************************************************
+  /// Counts the elements that satisfy the predicate, in parallel.
+  /// The predicate may be called concurrently.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  typename etl::iterator_traits<TIterator>::difference_type
+    count_if(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TUnaryPredicate predicate)
+  {
+    const size_t size = static_cast<size_t>(etl::distance(first, last));
+    const private_execution::chunks chunk(size, policy.chunk_count(size));
+
+    private_execution::count_if_task<TIterator, TUnaryPredicate> task(first, chunk, predicate);
+
+    private_execution::run(policy, task, chunk.count());
+
+    return task.result();
+  }
+
+  //***************************************************************************
+  /// Sorts the range.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void sort(const etl::execution::sequenced_policy&, TIterator first, TIterator last, TCompare compare)
+  {
+    etl::sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the range.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(const etl::execution::sequenced_policy&, TIterator first, TIterator last)
+  {
+    etl::sort(first, last);
+  }
+
+  //***************************************************************************
+  /// Sorts the range, in parallel.
+  /// The chunks are sorted, then merged in place by rotation.
+  /// Supply a buffer to merge with fewer moves.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void sort(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TCompare compare)
+  {
+    private_execution::sort(policy, first, last, first, false, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the range, in parallel.
+  /// The chunks are sorted, then merged in place by rotation.
+  /// Supply a buffer to merge with fewer moves.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(const etl::execution::parallel_policy& policy, TIterator first, TIterator last)
+  {
+    etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    private_execution::sort(policy, first, last, first, false, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the range, in parallel.
+  /// The chunks are sorted, then merged through the buffer, which must hold
+  /// at least as many elements as the range.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent, typename TCompare>
+  void sort(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, etl::span<T, Extent> buffer, TCompare compare)
+  {
+    ETL_ASSERT_OR_RETURN(buffer.size() >= static_cast<size_t>(etl::distance(first, last)), ETL_ERROR(etl::execution_buffer_too_small));
+
+    private_execution::sort(policy, first, last, buffer.begin(), true, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the range, in parallel.
+  /// The chunks are sorted, then merged through the buffer, which must hold
+  /// at least as many elements as the range.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent>
+  void sort(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, etl::span<T, Extent> buffer)
+  {
+    etl::sort(policy, first, last, buffer, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+}
+
+#endif
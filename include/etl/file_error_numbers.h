@@ -111,4 +111,12 @@ SOFTWARE.
 #define ETL_SIGNAL_FILE_ID "78"
 #define ETL_FORMAT_FILE_ID "79"
 #define ETL_INPLACE_FUNCTION_FILE_ID "80"
+#define ETL_SEGMENTED_DEQUE_FILE_ID "81"
+#define ETL_SMALL_VECTOR_FILE_ID "82"
+#define ETL_BTREE_FILE_ID "83"
+#define ETL_KLL_SKETCH_FILE_ID "84"
+#define ETL_EXECUTION_FILE_ID "85"
+#define ETL_ROARING_BITMAP_FILE_ID "86"
+#define ETL_MESSAGE_ROUTER_ASYNC_FILE_ID "87"
+#define ETL_CONST_PERFECT_MAP_FILE_ID "88"
 #endif
@@ -0,0 +1,197 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIXED_SIZED_MEMORY_BLOCK_ALLOCATOR_ATOMIC_INCLUDED
+#define ETL_FIXED_SIZED_MEMORY_BLOCK_ALLOCATOR_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "alignment.h"
+#include "atomic.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //*************************************************************************
+  /// The fixed sized memory block pool, with a lock free free list.
+  /// The allocated memory blocks are all the same size.
+  /// Blocks may be allocated and released concurrently from any thread,
+  /// so a reference counted message pool using it needs no lock.
+  //*************************************************************************
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  class fixed_sized_memory_block_allocator_atomic : public imemory_block_allocator
+  {
+  public:
+
+    static ETL_CONSTANT size_t Block_Size = VBlock_Size;
+    static ETL_CONSTANT size_t Alignment  = VAlignment;
+    static ETL_CONSTANT size_t Size       = VSize;
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    fixed_sized_memory_block_allocator_atomic()
+    {
+      for (size_t i = 0UL; i < (Size - 1U); ++i)
+      {
+        next[i].store(static_cast<index_type>(i + 1U), etl::memory_order_relaxed);
+      }
+
+      next[Size - 1U].store(Null_Index, etl::memory_order_relaxed);
+
+      head.store(make_head(0U, 0U), etl::memory_order_release);
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if ((required_alignment > Alignment) || (required_size > Block_Size))
+      {
+        return ETL_NULLPTR;
+      }
+
+      head_type current = head.load(etl::memory_order_acquire);
+
+      while (get_index(current) != Null_Index)
+      {
+        const index_type index     = get_index(current);
+        const head_type  next_head = make_head(next[index].load(etl::memory_order_relaxed), get_tag(current) + 1U);
+
+        // The tag changes on every update, so a stale 'next' will not be accepted.
+        if (head.compare_exchange_weak(current, next_head, etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          return &blocks[index];
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      if (!is_owner_of_block(pblock))
+      {
+        return false;
+      }
+
+      const index_type index = static_cast<index_type>(static_cast<const block*>(pblock) - blocks);
+
+      head_type current = head.load(etl::memory_order_relaxed);
+      head_type new_head;
+
+      do
+      {
+        next[index].store(get_index(current), etl::memory_order_relaxed);
+        new_head = make_head(index, get_tag(current) + 1U);
+      } while (!head.compare_exchange_weak(current, new_head, etl::memory_order_release, etl::memory_order_relaxed));
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      const block* p = static_cast<const block*>(pblock);
+
+      return (p >= blocks) && (p < (blocks + Size));
+    }
+
+  private:
+
+    ETL_STATIC_ASSERT(VSize > 0U, "Size must be greater than zero");
+
+    /// The head of the free list holds a block index and a tag, to avoid the ABA problem.
+    /// Smaller pools use a smaller head, so that a lock free atomic is more likely.
+    typedef typename etl::conditional<(VSize < 0xFFFFU), uint16_t, uint32_t>::type index_type;
+    typedef typename etl::conditional<(VSize < 0xFFFFU), uint32_t, uint64_t>::type head_type;
+
+    static ETL_CONSTANT index_type Null_Index = etl::integral_limits<index_type>::max;
+    static ETL_CONSTANT int        Index_Bits = etl::integral_limits<index_type>::bits;
+
+    ETL_STATIC_ASSERT(VSize < Null_Index, "Size too large");
+
+    //*************************************************************************
+    static head_type make_head(index_type index, head_type tag)
+    {
+      return static_cast<head_type>((tag << Index_Bits) | index);
+    }
+
+    //*************************************************************************
+    static index_type get_index(head_type value)
+    {
+      return static_cast<index_type>(value);
+    }
+
+    //*************************************************************************
+    static head_type get_tag(head_type value)
+    {
+      return value >> Index_Bits;
+    }
+
+    /// A structure that has the size and alignment of a block.
+    typedef typename etl::aligned_storage<Block_Size, Alignment>::type block;
+
+    block                    blocks[Size];
+    etl::atomic<index_type>  next[Size];
+    etl::atomic<head_type>   head;
+  };
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t fixed_sized_memory_block_allocator_atomic<VBlock_Size, VAlignment, VSize>::Block_Size;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t fixed_sized_memory_block_allocator_atomic<VBlock_Size, VAlignment, VSize>::Alignment;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t fixed_sized_memory_block_allocator_atomic<VBlock_Size, VAlignment, VSize>::Size;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT typename fixed_sized_memory_block_allocator_atomic<VBlock_Size, VAlignment, VSize>::index_type fixed_sized_memory_block_allocator_atomic<VBlock_Size, VAlignment, VSize>::Null_Index;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT int fixed_sized_memory_block_allocator_atomic<VBlock_Size, VAlignment, VSize>::Index_Bits;
+}
+
+#endif
+#endif
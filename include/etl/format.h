@@ -48,6 +48,8 @@ SOFTWARE.
 #include "variant.h"
 #include "visitor.h"
 
+#include "private/floating_point_decimal.h"
+
 #include <cmath>
 
 #if ETL_USING_CPP11
@@ -386,6 +388,11 @@ namespace etl
     {
     }
 
+    // non-standard, for argument lists assembled at run time
+    explicit basic_format_args(etl::array_view<basic_format_arg<Context>> args): _args(args)
+    {
+    }
+
     basic_format_args(const basic_format_args<Context>& other): _args(other._args)
     {
     }
@@ -1039,33 +1046,49 @@ namespace etl
       format_plain_num(it, value, spec, width);
     }
 
+    //*************************************************************************
+    /// Passes the characters of a floating point conversion to the output.
+    //*************************************************************************
+    template<typename OutputIt>
+    class floating_sink
+    {
+    public:
+
+      explicit floating_sink(OutputIt& it_)
+      : it(it_)
+      {
+      }
+
+      void operator()(char c)
+      {
+        *it = static_cast<char_type>(c);
+        ++it;
+      }
+
+    private:
+
+      OutputIt& it;
+    };
+
+    inline size_t floating_precision(const format_spec_t& spec)
+    {
+      return spec.precision.has_value() ? spec.precision.value() : 6U; // default
+    }
+
+    // shortest representation that round trips, or general with a precision
     template<typename OutputIt, typename T>
     void format_floating_default(OutputIt& it, T value, const format_spec_t& spec)
     {
-      const size_t fractional_decimals = 6; // default
+      floating_sink<OutputIt> sink(it);
 
-      T integral;
-      T fractional = modf(value, &integral);
-      bool sign;
-      unsigned long long int fractional_int;
-      unsigned long long int integral_int;
-      if (integral < 0.0)
+      if (spec.precision.has_value())
       {
-        sign = true;
-        fractional_int = static_cast<unsigned long long int>(-fractional * pow(10., fractional_decimals));
-        integral_int = static_cast<unsigned long long int>(-integral);
+        private_floating_point_decimal::write_general(sink, value, spec.precision.value(), false, spec.hash);
       }
       else
       {
-        sign = false;
-        fractional_int = static_cast<unsigned long long int>(fractional * pow(10., fractional_decimals));
-        integral_int = static_cast<unsigned long long int>(integral);
+        private_floating_point_decimal::write_shortest(sink, value);
       }
-
-      private_format::format_sign<OutputIt, int>(it, sign ? -1 : 0, spec);
-      private_format::format_plain_num<OutputIt, unsigned long long int>(it, integral_int, spec);
-      private_format::format_sequence<OutputIt>(it, ".");
-      private_format::format_plain_num<OutputIt, unsigned long long int, 10, true>(it, fractional_int, spec, fractional_decimals);
     }
 
     // floating point in hex notation
@@ -1134,85 +1157,25 @@ namespace etl
     template<typename OutputIt, typename T>
     void format_floating_e(OutputIt& it, T value, const format_spec_t& spec)
     {
-      static const size_t fractional_decimals = 6; // default
-      static const size_t exponent_decimals = 2;
-      long long int exponent_int = 0;
-
-      bool sign;
-      unsigned long long int fractional_int;
-      unsigned long long int integral_int;
+      floating_sink<OutputIt> sink(it);
 
-      T integral;
-      T fractional = modf(value, &integral);
-
-      while (value >= 10 || value <= -10)
-      {
-        ++exponent_int;
-        value /= 10;
-        fractional = modf(value, &integral);
-      }
-
-      while ((value > 0.0000000000001 && value < 1) || (value < -0.0000000000001 && value > -1))
-      {
-        --exponent_int;
-        value *= 10;
-        fractional = modf(value, &integral);
-      }
-
-      if (integral < 0.0)
-      {
-        sign = true;
-        fractional_int = static_cast<unsigned long long int>(-fractional * pow(10., fractional_decimals));
-        integral_int = static_cast<unsigned long long int>(-integral);
-      }
-      else
-      {
-        sign = false;
-        fractional_int = static_cast<unsigned long long int>(fractional * pow(10., fractional_decimals));
-        integral_int = static_cast<unsigned long long int>(integral);
-      }
-
-      private_format::format_sign<OutputIt, int>(it, sign ? -1 : 0, spec);
-      private_format::format_plain_num<OutputIt, unsigned long long int>(it, integral_int, spec);
-      private_format::format_sequence<OutputIt>(it, ".");
-      private_format::format_plain_num<OutputIt, unsigned long long int>(it, fractional_int, spec, fractional_decimals);
-      char letter = 'e';
-      if (is_uppercase(spec.type.value()))
-      {
-        letter = 'E';
-      }
-      private_format::format_plain_char<OutputIt>(it, letter);
-      private_format::format_plain_char<OutputIt>(it, (exponent_int < 0) ? '-' : '+');
-      private_format::format_plain_num<OutputIt, long long int>(it, exponent_int, spec, exponent_decimals);
+      private_floating_point_decimal::write_scientific(sink, value, floating_precision(spec), is_uppercase(spec.type.value()), spec.hash);
     }
 
     template<typename OutputIt, typename T>
     void format_floating_f(OutputIt& it, T value, const format_spec_t& spec)
     {
-      const size_t fractional_decimals = 6; // default
+      floating_sink<OutputIt> sink(it);
 
-      T integral;
-      T fractional = modf(value, &integral);
-      bool sign;
-      unsigned long long int fractional_int;
-      unsigned long long int integral_int;
-      if (integral < 0.0)
-      {
-        sign = true;
-        fractional_int = static_cast<unsigned long long int>(-fractional * pow(10., fractional_decimals));
-        integral_int = static_cast<unsigned long long int>(-integral);
-      }
-      else
-      {
-        sign = false;
-        fractional_int = static_cast<unsigned long long int>(fractional * pow(10., fractional_decimals));
-        integral_int = static_cast<unsigned long long int>(integral);
-      }
+      private_floating_point_decimal::write_fixed(sink, value, floating_precision(spec), spec.hash);
+    }
 
-      private_format::format_sign<OutputIt, int>(it, sign ? -1 : 0, spec);
-      private_format::format_plain_num<OutputIt, unsigned long long int>(it, integral_int, spec);
-      private_format::format_sequence<OutputIt>(it, ".");
-      private_format::format_plain_num<OutputIt, unsigned long long int>(it, fractional_int, spec, fractional_decimals);
+    template<typename OutputIt, typename T>
+    void format_floating_g(OutputIt& it, T value, const format_spec_t& spec)
+    {
+      floating_sink<OutputIt> sink(it);
+
+      private_floating_point_decimal::write_general(sink, value, floating_precision(spec), is_uppercase(spec.type.value()), spec.hash);
     }
 
     class dummy_assign_to
@@ -1337,51 +1300,30 @@ namespace etl
     };
 
     template<typename OutputIt, typename T>
-    void format_floating_g(OutputIt& it, T value, const format_spec_t& spec)
+    void format_floating(OutputIt& it, T value, const format_spec_t& spec)
     {
-      private_format::counter_iterator counter_e, counter_f;
+      typedef typename private_floating_point_decimal::working_type<T>::type working_type;
 
-      format_floating_e(counter_e, value, spec);
-      format_floating_f(counter_f, value, spec);
+      const working_type working_value = static_cast<working_type>(value);
+      const bool         upper_case    = spec.type.has_value() && is_uppercase(spec.type.value());
 
-      if (counter_e.value() < counter_f.value())
-      {
-        format_floating_e(it, value, spec);
-      }
-      else
+      if (!private_floating_point_decimal::is_finite(working_value))
       {
-        format_floating_f(it, value, spec);
-      }
-    }
+        format_sign<OutputIt, int>(it, private_floating_point_decimal::is_negative(working_value) ? -1 : 0, spec);
 
-    template<typename OutputIt, typename T>
-    void format_floating(OutputIt& it, T value, const format_spec_t& spec)
-    {
-      if (isnan(value))
-      {
-        if (spec.type.has_value() && (is_uppercase(spec.type.value())))
+        if (private_floating_point_decimal::is_nan(working_value))
         {
-          format_sequence(it, "NAN");
+          format_sequence(it, upper_case ? "NAN" : "nan");
         }
         else
         {
-          format_sequence(it, "nan");
-        }
-      }
-      else if (isinf(value))
-      {
-        if (spec.type.has_value() && (is_uppercase(spec.type.value())))
-        {
-          format_sequence(it, "INF");
-        }
-        else
-        {
-          format_sequence(it, "inf");
+          format_sequence(it, upper_case ? "INF" : "inf");
         }
       }
       else if (!spec.type.has_value())
       {
-        format_floating_default(it, value, spec);
+        format_sign<OutputIt, int>(it, private_floating_point_decimal::is_negative(working_value) ? -1 : 0, spec);
+        format_floating_default(it, working_value, spec);
       }
       else
       {
@@ -1393,15 +1335,18 @@ namespace etl
             break;
           case 'e':
           case 'E':
-            format_floating_e(it, value, spec);
+            format_sign<OutputIt, int>(it, private_floating_point_decimal::is_negative(working_value) ? -1 : 0, spec);
+            format_floating_e(it, working_value, spec);
             break;
           case 'f':
           case 'F':
-            format_floating_f(it, value, spec);
+            format_sign<OutputIt, int>(it, private_floating_point_decimal::is_negative(working_value) ? -1 : 0, spec);
+            format_floating_f(it, working_value, spec);
             break;
           case 'g':
           case 'G':
-            format_floating_g(it, value, spec);
+            format_sign<OutputIt, int>(it, private_floating_point_decimal::is_negative(working_value) ? -1 : 0, spec);
+            format_floating_g(it, working_value, spec);
             break;
           default:
             // unknown presentation type
@@ -2277,6 +2222,614 @@ namespace etl
     it = format_to(it, fmt, etl::forward<Args>(args)...);
     return it.value();
   }
+
+  namespace private_format
+  {
+    //*************************************************************************
+    /// The kind of argument, for checking presentation types.
+    //*************************************************************************
+    enum class arg_category_t
+    {
+      BOOL,
+      CHAR,
+      INTEGER,
+      FLOAT,
+      STRING,
+      POINTER,
+      OTHER
+    };
+
+    template<class T, class U = etl::decay_t<etl::remove_cvref_t<T>>>
+    struct arg_category
+      : etl::integral_constant<arg_category_t,
+                               etl::is_same<U, bool>::value ? arg_category_t::BOOL :
+                               etl::is_same<U, char>::value ? arg_category_t::CHAR :
+                               etl::is_integral<U>::value ? arg_category_t::INTEGER :
+                               etl::is_floating_point<U>::value ? arg_category_t::FLOAT :
+                               (etl::is_same<U, const char*>::value || etl::is_same<U, char*>::value ||
+                                etl::is_same<U, etl::string_view>::value || etl::is_base_of<etl::istring, U>::value) ? arg_category_t::STRING :
+                               etl::is_pointer<U>::value ? arg_category_t::POINTER :
+                               arg_category_t::OTHER>
+    {
+    };
+
+    //*************************************************************************
+    /// Checks a presentation type against the kind of argument.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline bool is_valid_presentation(arg_category_t category, char type)
+    {
+      const char* valid = "";
+
+      switch (category)
+      {
+        case arg_category_t::BOOL:    valid = "sbBcdoxX";  break;
+        case arg_category_t::CHAR:    valid = "c?bBdoxX";  break;
+        case arg_category_t::INTEGER: valid = "bBcdoxX";   break;
+        case arg_category_t::FLOAT:   valid = "aAeEfFgG";  break;
+        case arg_category_t::STRING:  valid = "s?";        break;
+        case arg_category_t::POINTER: valid = "pP";        break;
+        default:                      return true;
+      }
+
+      while (*valid != 0)
+      {
+        if (*valid == type)
+        {
+          return true;
+        }
+
+        ++valid;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// A replacement field, parsed ahead of time.
+    /// A compact form of format_spec_t that can be built at compile time.
+    //*************************************************************************
+    struct compiled_spec_t
+    {
+      ETL_CONSTEXPR compiled_spec_t()
+        : index(0U)
+        , width(0U)
+        , precision(0U)
+        , align(spec_align_t::NONE)
+        , sign(spec_sign_t::MINUS)
+        , fill(' ')
+        , type(0)
+        , hash(false)
+        , zero(false)
+        , has_width(false)
+        , width_nested(false)
+        , has_precision(false)
+        , precision_nested(false)
+        , locale_specific(false)
+      {
+      }
+
+      uint_least16_t index;
+      uint_least16_t width;     // The argument index if width_nested is true.
+      uint_least16_t precision; // The argument index if precision_nested is true.
+      spec_align_t   align;
+      spec_sign_t    sign;
+      char_type      fill;
+      char_type      type;      // 0 if not specified.
+      bool           hash;
+      bool           zero;
+      bool           has_width;
+      bool           width_nested;
+      bool           has_precision;
+      bool           precision_nested;
+      bool           locale_specific;
+    };
+
+    //*************************************************************************
+    /// A literal run of the format string, optionally followed by a replacement field.
+    //*************************************************************************
+    struct compiled_segment_t
+    {
+      ETL_CONSTEXPR compiled_segment_t()
+        : literal_begin(0U)
+        , literal_length(0U)
+        , has_argument(false)
+        , spec()
+      {
+      }
+
+      uint_least16_t  literal_begin;
+      uint_least16_t  literal_length;
+      bool            has_argument;
+      compiled_spec_t spec;
+    };
+
+    //*************************************************************************
+    /// Gets the value of a nested width or precision argument.
+    //*************************************************************************
+    struct nested_value_visitor
+    {
+      template<typename T>
+      etl::enable_if_t<etl::is_integral<T>::value && etl::is_signed<T>::value, size_t> operator()(T value) const
+      {
+        ETL_ASSERT(value >= T(0), ETL_ERROR(bad_format_string_exception)/* negative width or precision */);
+        return static_cast<size_t>(value);
+      }
+
+      template<typename T>
+      etl::enable_if_t<etl::is_integral<T>::value && !etl::is_signed<T>::value, size_t> operator()(T value) const
+      {
+        return static_cast<size_t>(value);
+      }
+
+      template<typename T>
+      etl::enable_if_t<!etl::is_integral<T>::value, size_t> operator()(T) const
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(bad_format_string_exception)/* width or precision is not an integer */);
+        return 0U;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A format string that is parsed once, ahead of formatting.
+  /// The format string is split into literal runs and replacement fields, and
+  /// each field is checked against the argument types. When constructed as a
+  /// constexpr object (C++14 and above) a bad format string is a compile error.
+  /// Formatting only copies the literals and runs the argument formatters.
+  /// The format string must outlive the compiled format.
+  ///\tparam Max_Segments The maximum number of literal runs and replacement fields.
+  ///\tparam Args         The types of the arguments.
+  //***************************************************************************
+  template<size_t Max_Segments, class... Args>
+  class compiled_format
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Segments > 0U, "Max_Segments must be greater than zero");
+
+    static ETL_CONSTANT size_t MAX_SEGMENTS = Max_Segments;
+
+    //*************************************************************************
+    /// Constructs from a null terminated format string.
+    //*************************************************************************
+    ETL_CONSTEXPR14 explicit compiled_format(const char* fmt_)
+      : fmt(fmt_)
+      , length(etl::strlen(fmt_))
+      , n_segments(0U)
+      , segments()
+    {
+      compile();
+    }
+
+    //*************************************************************************
+    /// Constructs from a string view.
+    //*************************************************************************
+    ETL_CONSTEXPR14 explicit compiled_format(etl::string_view fmt_)
+      : fmt(fmt_.data())
+      , length(fmt_.size())
+      , n_segments(0U)
+      , segments()
+    {
+      compile();
+    }
+
+    //*************************************************************************
+    /// The original format string.
+    //*************************************************************************
+    ETL_CONSTEXPR etl::string_view get() const
+    {
+      return etl::string_view(fmt, length);
+    }
+
+    //*************************************************************************
+    /// The number of segments used.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return n_segments;
+    }
+
+    //*************************************************************************
+    /// Formats the arguments to the context.
+    //*************************************************************************
+    template<class OutputIt>
+    OutputIt format(OutputIt out, format_args<OutputIt> args) const
+    {
+      format_parse_context parse_context(etl::string_view(), args.size());
+      format_context<OutputIt> fmt_context(out, args);
+      private_format::format_visitor<OutputIt> v(parse_context, fmt_context);
+
+      for (size_t i = 0U; i < n_segments; ++i)
+      {
+        const private_format::compiled_segment_t& segment = segments[i];
+
+        OutputIt it = fmt_context.out();
+        const char* p_literal     = fmt + segment.literal_begin;
+        const char* p_literal_end = p_literal + segment.literal_length;
+
+        while (p_literal != p_literal_end)
+        {
+          *it = *p_literal++;
+          ++it;
+        }
+
+        fmt_context.advance_to(it);
+
+        if (segment.has_argument)
+        {
+          fmt_context.format_spec = make_format_spec(segment.spec, args);
+          format_arg<OutputIt> arg = args.get(segment.spec.index);
+          arg.template visit<void>(v);
+        }
+      }
+
+      return fmt_context.out();
+    }
+
+  private:
+
+    typedef private_format::arg_category_t     arg_category_t;
+    typedef private_format::compiled_spec_t    compiled_spec_t;
+    typedef private_format::compiled_segment_t compiled_segment_t;
+
+    static ETL_CONSTANT size_t N_Args = sizeof...(Args);
+
+    //*************************************************************************
+    /// Converts a compiled spec to the format spec used by the formatters.
+    //*************************************************************************
+    template<class OutputIt>
+    static private_format::format_spec_t make_format_spec(const compiled_spec_t& compiled, format_args<OutputIt>& args)
+    {
+      private_format::nested_value_visitor nested_visitor;
+
+      private_format::format_spec_t spec;
+
+      spec.index           = size_t(compiled.index);
+      spec.align           = compiled.align;
+      spec.fill            = compiled.fill;
+      spec.sign            = compiled.sign;
+      spec.hash            = compiled.hash;
+      spec.zero            = compiled.zero;
+      spec.locale_specific = compiled.locale_specific;
+
+      if (compiled.has_width)
+      {
+        spec.width = compiled.width_nested ? args.get(compiled.width).template visit<size_t>(nested_visitor) : size_t(compiled.width);
+      }
+
+      if (compiled.has_precision)
+      {
+        spec.precision = compiled.precision_nested ? args.get(compiled.precision).template visit<size_t>(nested_visitor) : size_t(compiled.precision);
+      }
+
+      if (compiled.type != 0)
+      {
+        spec.type = compiled.type;
+      }
+
+      return spec;
+    }
+
+    //*************************************************************************
+    /// Splits the format string into segments.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void compile()
+    {
+      ETL_ASSERT_OR_RETURN(length <= etl::integral_limits<uint_least16_t>::max, ETL_ERROR(bad_format_string_exception));
+
+      size_t position      = 0U;
+      size_t literal_begin = 0U;
+      bool   automatic     = false;
+      bool   manual        = false;
+      size_t next_index    = 0U;
+
+      while (position < length)
+      {
+        const char c = fmt[position];
+
+        if ((c == '{') || (c == '}'))
+        {
+          bool has_argument = false;
+
+          if (((position + 1U) < length) && (fmt[position + 1U] == c))
+          {
+            // An escaped brace. The literal run includes the first one.
+            ++position;
+          }
+          else
+          {
+            ETL_ASSERT_OR_RETURN(c == '{', ETL_ERROR(bad_format_string_exception)/* unmatched '}' */);
+
+            has_argument = true;
+          }
+
+          if (!add_segment(literal_begin, position - literal_begin, has_argument))
+          {
+            return;
+          }
+
+          ++position;
+
+          if (has_argument)
+          {
+            if (!parse_field(position, segments[n_segments - 1U].spec, automatic, manual, next_index))
+            {
+              return;
+            }
+          }
+
+          literal_begin = position;
+        }
+        else
+        {
+          ++position;
+        }
+      }
+
+      if (literal_begin != length)
+      {
+        add_segment(literal_begin, length - literal_begin, false);
+      }
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool add_segment(size_t literal_begin, size_t literal_length, bool has_argument)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(n_segments < Max_Segments, ETL_ERROR(bad_format_string_exception)/* too many segments */, false);
+
+      compiled_segment_t& segment = segments[n_segments++];
+
+      segment.literal_begin  = static_cast<uint_least16_t>(literal_begin);
+      segment.literal_length = static_cast<uint_least16_t>(literal_length);
+      segment.has_argument   = has_argument;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Parses a replacement field, after the opening brace.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool parse_field(size_t& position, compiled_spec_t& spec, bool& automatic, bool& manual, size_t& next_index) const
+    {
+      size_t index = 0U;
+
+      if (parse_num(position, index))
+      {
+        manual = true;
+      }
+      else
+      {
+        automatic  = true;
+        index      = next_index++;
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!(automatic && manual), ETL_ERROR(bad_format_string_exception)/* mixed automatic and manual indexing */, false);
+      ETL_ASSERT_OR_RETURN_VALUE(index < N_Args, ETL_ERROR(bad_format_string_exception)/* argument index out of range */, false);
+
+      spec.index = static_cast<uint_least16_t>(index);
+
+      if (parse_char(position, ':'))
+      {
+        // Fill and align.
+        if ((position < length) && is_align(fmt[position]))
+        {
+          spec.align = private_format::align_from_char(fmt[position++]);
+        }
+        else if (((position + 1U) < length) && (fmt[position] != '{') && (fmt[position] != '}') && is_align(fmt[position + 1U]))
+        {
+          spec.fill  = fmt[position];
+          spec.align = private_format::align_from_char(fmt[position + 1U]);
+          position  += 2U;
+        }
+
+        // Sign.
+        if (parse_char(position, '+'))
+        {
+          spec.sign = private_format::spec_sign_t::PLUS;
+        }
+        else if (parse_char(position, '-'))
+        {
+          spec.sign = private_format::spec_sign_t::MINUS;
+        }
+        else if (parse_char(position, ' '))
+        {
+          spec.sign = private_format::spec_sign_t::SPACE;
+        }
+
+        spec.hash = parse_char(position, '#');
+        spec.zero = parse_char(position, '0');
+
+        // Width.
+        size_t value = 0U;
+
+        if (!parse_width_or_precision(position, value, spec.has_width, spec.width_nested, automatic, manual, next_index))
+        {
+          return false;
+        }
+
+        spec.width = static_cast<uint_least16_t>(value);
+
+        // Precision.
+        if (parse_char(position, '.'))
+        {
+          if (!parse_width_or_precision(position, value, spec.has_precision, spec.precision_nested, automatic, manual, next_index))
+          {
+            return false;
+          }
+
+          ETL_ASSERT_OR_RETURN_VALUE(spec.has_precision, ETL_ERROR(bad_format_string_exception)/* missing precision */, false);
+          ETL_ASSERT_OR_RETURN_VALUE(!is_integer_category(category(index)) && (category(index) != arg_category_t::POINTER),
+                                     ETL_ERROR(bad_format_string_exception)/* precision not allowed for the argument */, false);
+
+          spec.precision = static_cast<uint_least16_t>(value);
+        }
+
+        spec.locale_specific = parse_char(position, 'L');
+
+        // Presentation type.
+        if ((position < length) && (fmt[position] != '}'))
+        {
+          spec.type = fmt[position++];
+
+          ETL_ASSERT_OR_RETURN_VALUE(private_format::is_valid_presentation(category(index), spec.type),
+                                     ETL_ERROR(bad_format_string_exception)/* bad presentation type for the argument */, false);
+        }
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(parse_char(position, '}'), ETL_ERROR(bad_format_string_exception)/* closing brace missing */, false);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Parses a width or precision, either a number or a nested replacement field.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool parse_width_or_precision(size_t& position, size_t& value, bool& has_value, bool& nested,
+                                                  bool& automatic, bool& manual, size_t& next_index) const
+    {
+      has_value = false;
+      nested    = false;
+      value     = 0U;
+
+      if (parse_num(position, value))
+      {
+        has_value = true;
+      }
+      else if (parse_char(position, '{'))
+      {
+        if (parse_num(position, value))
+        {
+          manual = true;
+        }
+        else
+        {
+          automatic = true;
+          value     = next_index++;
+        }
+
+        ETL_ASSERT_OR_RETURN_VALUE(!(automatic && manual), ETL_ERROR(bad_format_string_exception)/* mixed automatic and manual indexing */, false);
+        ETL_ASSERT_OR_RETURN_VALUE(value < N_Args, ETL_ERROR(bad_format_string_exception)/* argument index out of range */, false);
+        ETL_ASSERT_OR_RETURN_VALUE(is_integer_category(category(value)), ETL_ERROR(bad_format_string_exception)/* width or precision is not an integer */, false);
+        ETL_ASSERT_OR_RETURN_VALUE(parse_char(position, '}'), ETL_ERROR(bad_format_string_exception)/* bad nested replacement */, false);
+
+        has_value = true;
+        nested    = true;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool parse_num(size_t& position, size_t& value) const
+    {
+      bool found = false;
+      value = 0U;
+
+      while ((position < length) && (fmt[position] >= '0') && (fmt[position] <= '9'))
+      {
+        value = (value * 10U) + static_cast<size_t>(fmt[position] - '0');
+        found = true;
+        ++position;
+
+        ETL_ASSERT_OR_RETURN_VALUE(value <= etl::integral_limits<uint_least16_t>::max, ETL_ERROR(bad_format_string_exception)/* number too large */, true);
+      }
+
+      return found;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool parse_char(size_t& position, char c) const
+    {
+      if ((position < length) && (fmt[position] == c))
+      {
+        ++position;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR bool is_align(char c)
+    {
+      return (c == '<') || (c == '>') || (c == '^');
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR bool is_integer_category(arg_category_t category)
+    {
+      return (category == arg_category_t::INTEGER) || (category == arg_category_t::CHAR) || (category == arg_category_t::BOOL);
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR14 arg_category_t category(size_t index)
+    {
+      // One extra element, so that the array is never zero sized.
+      const arg_category_t categories[] = { private_format::arg_category<Args>::value..., arg_category_t::OTHER };
+
+      return categories[index];
+    }
+
+    const char*        fmt;
+    size_t             length;
+    size_t             n_segments;
+    compiled_segment_t segments[Max_Segments];
+  };
+
+  template<size_t Max_Segments, class... Args>
+  ETL_CONSTANT size_t compiled_format<Max_Segments, Args...>::MAX_SEGMENTS;
+
+  template<size_t Max_Segments, class... Args>
+  ETL_CONSTANT size_t compiled_format<Max_Segments, Args...>::N_Args;
+
+  //***************************************************************************
+  /// Compiles a format string literal for the argument types.
+  /// Sized for the worst case number of segments for the literal.
+  /// constexpr auto fmt = etl::compile_format<int, const char*>("{} = {}");
+  //***************************************************************************
+  template<class... Args, size_t N>
+  ETL_CONSTEXPR14 compiled_format<(N / 2U) + 1U, Args...> compile_format(const char (&fmt)[N])
+  {
+    return compiled_format<(N / 2U) + 1U, Args...>(fmt);
+  }
+
+  //***************************************************************************
+  /// Formats with a compiled format string.
+  //***************************************************************************
+  template<typename OutputIt,
+           size_t Max_Segments,
+           class... Args,
+           typename = etl::enable_if_t<!etl::is_base_of<etl::remove_reference<etl::istring>::type, OutputIt>::value>>
+  OutputIt format_to(OutputIt out, const compiled_format<Max_Segments, Args...>& fmt, const etl::type_identity_t<Args>&... args)
+  {
+    auto the_args{make_format_args<OutputIt>(args...)};
+    return fmt.format(etl::move(out), format_args<OutputIt>(the_args));
+  }
+
+  template<typename OutputIt, size_t Max_Segments, class... Args>
+  OutputIt format_to_n(OutputIt out, size_t n, const compiled_format<Max_Segments, Args...>& fmt, const etl::type_identity_t<Args>&... args)
+  {
+    using WrapperIt = private_format::limit_iterator<OutputIt>;
+
+    auto the_args{make_format_args<WrapperIt>(args...)};
+    return fmt.format(WrapperIt(out, n), format_args<WrapperIt>(the_args)).get();
+  }
+
+  template<size_t Max_Segments, class... Args>
+  etl::istring::iterator format_to(etl::istring& out, const compiled_format<Max_Segments, Args...>& fmt, const etl::type_identity_t<Args>&... args)
+  {
+    etl::istring::iterator result = format_to_n(out.begin(), out.max_size(), fmt, args...);
+    out.uninitialized_resize(result - out.begin());
+    return result;
+  }
+
+  template<size_t Max_Segments, class... Args>
+  size_t formatted_size(const compiled_format<Max_Segments, Args...>& fmt, const etl::type_identity_t<Args>&... args)
+  {
+    private_format::counter_iterator it;
+    it = format_to(it, fmt, args...);
+    return it.value();
+  }
 }
 
 #endif
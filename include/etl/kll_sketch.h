@@ -0,0 +1,639 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_KLL_SKETCH_INCLUDED
+#define ETL_KLL_SKETCH_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "random.h"
+#include "span.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for KLL sketches.
+  //***************************************************************************
+  class kll_sketch_exception : public etl::exception
+  {
+  public:
+
+    kll_sketch_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// All levels of the KLL sketch are in use.
+  //***************************************************************************
+  class kll_sketch_full : public etl::kll_sketch_exception
+  {
+  public:
+
+    kll_sketch_full(string_type file_name_, numeric_type line_number_)
+      : etl::kll_sketch_exception(ETL_ERROR_TEXT("kll_sketch:full", ETL_KLL_SKETCH_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Quantile of an empty KLL sketch.
+  //***************************************************************************
+  class kll_sketch_empty : public etl::kll_sketch_exception
+  {
+  public:
+
+    kll_sketch_empty(string_type file_name_, numeric_type line_number_)
+      : etl::kll_sketch_exception(ETL_ERROR_TEXT("kll_sketch:empty", ETL_KLL_SKETCH_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A KLL streaming quantile sketch in fixed memory.
+  /// Level h holds items that each stand for 2^h values. When the buffer is
+  /// full the lowest level at its capacity is sorted and every other item is
+  /// promoted to the level above. Capacities shrink by 2/3 for each level below
+  /// the top, so the buffer never needs more than about 3 * K items.
+  /// The rank error is roughly 1.7 / K.
+  ///\tparam T          The value type.
+  ///\tparam K          The capacity of the top level. Larger is more accurate.
+  ///\tparam Max_Levels The number of levels. Up to about K * 2^(Max_Levels - 1) values may be added.
+  ///\tparam TCompare   The ordering of values.
+  //***************************************************************************
+  template <typename T, size_t K_ = 200U, size_t Max_Levels_ = 32U, typename TCompare = etl::less<T> >
+  class kll_sketch
+  {
+  public:
+
+    typedef T        value_type;
+    typedef TCompare value_compare;
+    typedef size_t   size_type;
+
+    static ETL_CONSTANT size_t K          = K_;
+    static ETL_CONSTANT size_t Max_Levels = Max_Levels_;
+    static ETL_CONSTANT size_t Min_Width  = 8U;
+
+    /// The sum of the level capacities, however many levels are in use.
+    static ETL_CONSTANT size_t Capacity   = (3U * K) + ((Min_Width + 2U) * Max_Levels);
+
+    ETL_STATIC_ASSERT(K >= Min_Width, "K must be at least 8");
+    ETL_STATIC_ASSERT(Max_Levels >= 2U, "Max_Levels must be at least 2");
+    ETL_STATIC_ASSERT(Max_Levels <= 64U, "Max_Levels must not exceed 64");
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    kll_sketch()
+      : rng(0x4B4C4CU)
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    /// Sets the seed used to choose which half of a level is promoted.
+    //*********************************
+    explicit kll_sketch(uint32_t seed)
+      : rng(seed)
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    kll_sketch(TIterator first, TIterator last)
+      : rng(0x4B4C4CU)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(const T& value)
+    {
+      if ((levels[0] == 0U) && !compress())
+      {
+        return;
+      }
+
+      --levels[0];
+      items[levels[0]] = value;
+      update_min_max(value);
+      ++counter;
+      level_zero_sorted = false;
+    }
+
+    //*********************************
+    /// Add a span of values.
+    /// Copies directly into the free space of level 0.
+    //*********************************
+    void add(etl::span<const T> values)
+    {
+      const T* p_value   = values.data();
+      size_t   remaining = values.size();
+
+      while (remaining != 0U)
+      {
+        if ((levels[0] == 0U) && !compress())
+        {
+          return;
+        }
+
+        const size_t chunk = (remaining < levels[0]) ? remaining : levels[0];
+
+        levels[0] -= chunk;
+
+        for (size_t i = 0U; i < chunk; ++i)
+        {
+          items[levels[0] + i] = p_value[i];
+          update_min_max(p_value[i]);
+        }
+
+        counter           += chunk;
+        p_value           += chunk;
+        remaining         -= chunk;
+        level_zero_sorted  = false;
+      }
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(const T& value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Adds the values summarised by 'other'.
+    /// Each level of 'other' is added to the same level of this sketch.
+    /// Merging a sketch with itself has no effect.
+    //*********************************
+    void merge(const kll_sketch& other)
+    {
+      if ((&other == this) || (other.counter == 0U))
+      {
+        return;
+      }
+
+      for (size_t h = other.num_levels; h-- > 0U;)
+      {
+        const size_t first = other.levels[h];
+        const size_t last  = other.levels[h + 1U];
+
+        if ((first != last) && !add_to_level(h, other.items + first, last - first))
+        {
+          return;
+        }
+      }
+
+      if (counter == 0U)
+      {
+        min_item = other.min_item;
+        max_item = other.max_item;
+      }
+      else
+      {
+        update_min_max(other.min_item);
+        update_min_max(other.max_item);
+      }
+
+      counter += other.counter;
+    }
+
+    //*********************************
+    /// Gets the value at normalised rank 'q' (0 to 1).
+    /// Returns the smallest retained value whose cumulative weight reaches q * count().
+    //*********************************
+    T quantile(double q) const
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(counter != 0U, ETL_ERROR(kll_sketch_empty), T());
+
+      if (q <= 0.0)
+      {
+        return min_item;
+      }
+
+      if (q >= 1.0)
+      {
+        return max_item;
+      }
+
+      sort_level_zero();
+
+      // Walk the sorted levels as one merged sequence.
+      size_t cursor[Max_Levels];
+
+      for (size_t h = 0U; h < num_levels; ++h)
+      {
+        cursor[h] = levels[h];
+      }
+
+      const double target = q * double(counter);
+      uint64_t     weight = 0U;
+
+      while (true)
+      {
+        size_t best = num_levels;
+
+        for (size_t h = 0U; h < num_levels; ++h)
+        {
+          if ((cursor[h] != levels[h + 1U]) && ((best == num_levels) || compare(items[cursor[h]], items[cursor[best]])))
+          {
+            best = h;
+          }
+        }
+
+        if (best == num_levels)
+        {
+          break;
+        }
+
+        weight += uint64_t(1U) << best;
+
+        if (double(weight) >= target)
+        {
+          return items[cursor[best]];
+        }
+
+        ++cursor[best];
+      }
+
+      return max_item;
+    }
+
+    //*********************************
+    /// Gets the estimated fraction of values less than or equal to 'value'.
+    //*********************************
+    double rank(const T& value) const
+    {
+      if (counter == 0U)
+      {
+        return 0.0;
+      }
+
+      uint64_t weight = 0U;
+
+      for (size_t h = 0U; h < num_levels; ++h)
+      {
+        uint64_t n = 0U;
+
+        for (size_t i = levels[h]; i < levels[h + 1U]; ++i)
+        {
+          n += compare(value, items[i]) ? 0U : 1U;
+        }
+
+        weight += n << h;
+      }
+
+      return double(weight) / double(counter);
+    }
+
+    //*********************************
+    /// Gets the smallest value added.
+    //*********************************
+    const T& min_value() const
+    {
+      return min_item;
+    }
+
+    //*********************************
+    /// Gets the largest value added.
+    //*********************************
+    const T& max_value() const
+    {
+      return max_item;
+    }
+
+    //*********************************
+    /// Gets the total number of values added.
+    //*********************************
+    uint64_t count() const
+    {
+      return counter;
+    }
+
+    //*********************************
+    /// Gets the number of retained items.
+    //*********************************
+    size_t size() const
+    {
+      return Capacity - levels[0];
+    }
+
+    //*********************************
+    /// Gets the maximum number of retained items.
+    //*********************************
+    static ETL_CONSTEXPR size_t max_size()
+    {
+      return Capacity;
+    }
+
+    //*********************************
+    /// Gets the number of levels in use.
+    //*********************************
+    size_t height() const
+    {
+      return num_levels;
+    }
+
+    //*********************************
+    /// Returns true if no values have been added.
+    //*********************************
+    bool empty() const
+    {
+      return counter == 0U;
+    }
+
+    //*********************************
+    /// Clears the sketch.
+    //*********************************
+    void clear()
+    {
+      num_levels = 1U;
+
+      for (size_t h = 0U; h <= Max_Levels; ++h)
+      {
+        levels[h] = Capacity;
+      }
+
+      counter           = 0U;
+      min_item          = T();
+      max_item          = T();
+      level_zero_sorted = true;
+    }
+
+  private:
+
+    //*********************************
+    /// The capacity of level 'h' for the current height.
+    //*********************************
+    size_t level_capacity(size_t h) const
+    {
+      size_t depth    = num_levels - 1U - h;
+      size_t capacity = K;
+
+      while ((depth != 0U) && (capacity > Min_Width))
+      {
+        capacity = ((2U * capacity) + 2U) / 3U;
+        --depth;
+      }
+
+      return (capacity < Min_Width) ? Min_Width : capacity;
+    }
+
+    //*********************************
+    /// Adds an empty level at the top.
+    //*********************************
+    bool add_level()
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(num_levels < Max_Levels, ETL_ERROR(kll_sketch_full), false);
+
+      levels[num_levels + 1U] = Capacity;
+      ++num_levels;
+
+      return true;
+    }
+
+    //*********************************
+    /// Compacts the lowest level that has reached its capacity.
+    //*********************************
+    bool compress()
+    {
+      size_t h = 0U;
+
+      while ((h < num_levels) && ((levels[h + 1U] - levels[h]) < level_capacity(h)))
+      {
+        ++h;
+      }
+
+      // The buffer holds the sum of all capacities, so a full buffer always has a full level.
+      if (h == num_levels)
+      {
+        return levels[0] != 0U;
+      }
+
+      if ((h == (num_levels - 1U)) && !add_level())
+      {
+        return false;
+      }
+
+      compact_level(h);
+
+      return true;
+    }
+
+    //*********************************
+    /// Promotes every other item of level 'h' to level h + 1.
+    /// An odd item out stays in level 'h'.
+    //*********************************
+    void compact_level(size_t h)
+    {
+      const size_t first  = levels[h];
+      const size_t last   = levels[h + 1U];
+      const size_t odd    = (last - first) & 1U;
+      const size_t half   = (last - first) / 2U;
+      const size_t offset = rng() & 1U;
+
+      if (h == 0U)
+      {
+        sort_level_zero();
+      }
+
+      // Pack the promoted items against level h + 1, working down so no unread item is overwritten.
+      for (size_t i = half; i-- > 0U;)
+      {
+        items[last - half + i] = items[first + odd + offset + (2U * i)];
+      }
+
+      etl::sort(items + last - half, items + levels[h + 2U], compare);
+
+      if (odd != 0U)
+      {
+        items[last - half - 1U] = items[first];
+      }
+
+      // Move the levels below up into the space released.
+      for (size_t i = first; i-- > levels[0];)
+      {
+        items[i + half] = items[i];
+      }
+
+      for (size_t i = 0U; i <= h; ++i)
+      {
+        levels[i] += half;
+      }
+
+      levels[h + 1U] = last - half;
+    }
+
+    //*********************************
+    /// Adds 'n' items to level 'h', making room below as needed.
+    //*********************************
+    bool add_to_level(size_t h, const T* p_item, size_t n)
+    {
+      while (h >= num_levels)
+      {
+        if (!add_level())
+        {
+          return false;
+        }
+      }
+
+      while (n != 0U)
+      {
+        if ((levels[0] == 0U) && !compress())
+        {
+          return false;
+        }
+
+        const size_t chunk = (n < levels[0]) ? n : levels[0];
+
+        // Move the levels below 'h' down to open a gap at the start of level 'h'.
+        for (size_t i = levels[0]; i < levels[h]; ++i)
+        {
+          items[i - chunk] = items[i];
+        }
+
+        for (size_t i = 0U; i <= h; ++i)
+        {
+          levels[i] -= chunk;
+        }
+
+        for (size_t i = 0U; i < chunk; ++i)
+        {
+          items[levels[h] + i] = p_item[i];
+        }
+
+        if (h == 0U)
+        {
+          level_zero_sorted = false;
+        }
+        else
+        {
+          etl::sort(items + levels[h], items + levels[h + 1U], compare);
+        }
+
+        p_item += chunk;
+        n      -= chunk;
+      }
+
+      return true;
+    }
+
+    //*********************************
+    /// Level 0 is kept unsorted until a compaction or query needs it.
+    //*********************************
+    void sort_level_zero() const
+    {
+      if (!level_zero_sorted)
+      {
+        etl::sort(items + levels[0], items + levels[1], compare);
+        level_zero_sorted = true;
+      }
+    }
+
+    //*********************************
+    void update_min_max(const T& value)
+    {
+      if ((counter == 0U) || compare(value, min_item))
+      {
+        min_item = value;
+      }
+
+      if ((counter == 0U) || compare(max_item, value))
+      {
+        max_item = value;
+      }
+    }
+
+    /// Level 0 may be sorted by const queries.
+    mutable T            items[Capacity];
+    size_t               levels[Max_Levels + 1U];
+    size_t               num_levels;
+    uint64_t             counter;
+    T                    min_item;
+    T                    max_item;
+    mutable bool         level_zero_sorted;
+    etl::random_xorshift rng;
+    TCompare             compare;
+  };
+
+  template <typename T, size_t K_, size_t Max_Levels_, typename TCompare>
+  ETL_CONSTANT size_t kll_sketch<T, K_, Max_Levels_, TCompare>::K;
+
+  template <typename T, size_t K_, size_t Max_Levels_, typename TCompare>
+  ETL_CONSTANT size_t kll_sketch<T, K_, Max_Levels_, TCompare>::Max_Levels;
+
+  template <typename T, size_t K_, size_t Max_Levels_, typename TCompare>
+  ETL_CONSTANT size_t kll_sketch<T, K_, Max_Levels_, TCompare>::Min_Width;
+
+  template <typename T, size_t K_, size_t Max_Levels_, typename TCompare>
+  ETL_CONSTANT size_t kll_sketch<T, K_, Max_Levels_, TCompare>::Capacity;
+}
+
+#endif
@@ -0,0 +1,458 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LOG_LINEAR_HISTOGRAM_INCLUDED
+#define ETL_LOG_LINEAR_HISTOGRAM_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "bit.h"
+#include "smallest.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_log_linear_histogram
+  {
+    //***************************************************************************
+    /// A bucket counter.
+    /// Relaxed atomic when the platform supports atomics, so that several
+    /// threads may record into the same histogram.
+    //***************************************************************************
+    template <typename TCount>
+    class counter
+    {
+    public:
+
+      TCount load() const
+      {
+#if ETL_HAS_ATOMIC
+        return value.load(etl::memory_order_relaxed);
+#else
+        return value;
+#endif
+      }
+
+      void store(TCount n)
+      {
+#if ETL_HAS_ATOMIC
+        value.store(n, etl::memory_order_relaxed);
+#else
+        value = n;
+#endif
+      }
+
+      void add(TCount n)
+      {
+#if ETL_HAS_ATOMIC
+        value.fetch_add(n, etl::memory_order_relaxed);
+#else
+        value += n;
+#endif
+      }
+
+      TCount exchange(TCount n)
+      {
+#if ETL_HAS_ATOMIC
+        return value.exchange(n, etl::memory_order_relaxed);
+#else
+        TCount old = value;
+        value = n;
+        return old;
+#endif
+      }
+
+    private:
+
+#if ETL_HAS_ATOMIC
+      etl::atomic<TCount> value;
+#else
+      TCount value;
+#endif
+    };
+  }
+
+  //***************************************************************************
+  /// A log-linear (HDR style) histogram.
+  /// Values below 2^Sub_Bucket_Bits are counted exactly. Above that, each power
+  /// of two range is split into 2^(Sub_Bucket_Bits - 1) equal buckets, so the
+  /// relative error of any reported value is at most 2^-(Sub_Bucket_Bits - 1).
+  /// Values up to 2^Max_Exponent - 1 are tracked. Larger values are counted in
+  /// the last bucket.
+  ///\tparam Sub_Bucket_Bits The number of significant bits kept for each value.
+  ///\tparam Max_Exponent    The bit width of the largest trackable value.
+  ///\tparam TCount          The bucket count type.
+  //***************************************************************************
+  template <size_t Sub_Bucket_Bits_, size_t Max_Exponent_, typename TCount = uint32_t>
+  class log_linear_histogram
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<TCount>::value && etl::is_unsigned<TCount>::value, "Only unsigned integral count allowed");
+    ETL_STATIC_ASSERT(Sub_Bucket_Bits_ >= 1U, "Sub_Bucket_Bits must be at least 1");
+    ETL_STATIC_ASSERT(Sub_Bucket_Bits_ <= Max_Exponent_, "Sub_Bucket_Bits must not exceed Max_Exponent");
+    ETL_STATIC_ASSERT(Max_Exponent_ <= 64U, "Max_Exponent must not exceed 64");
+
+    typedef typename etl::smallest_uint_for_bits<Max_Exponent_>::type value_type;
+    typedef TCount                                                    count_type;
+    typedef size_t                                                    size_type;
+
+    static ETL_CONSTANT size_t Sub_Bucket_Bits = Sub_Bucket_Bits_;
+    static ETL_CONSTANT size_t Max_Exponent    = Max_Exponent_;
+    static ETL_CONSTANT size_t Half_Bucket     = size_t(1U) << (Sub_Bucket_Bits - 1U);
+    static ETL_CONSTANT size_t Bucket_Count    = (Max_Exponent - Sub_Bucket_Bits + 2U) * Half_Bucket;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    log_linear_histogram()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Copy constructor.
+    /// Not atomic with respect to concurrent records into 'other'.
+    //*********************************
+    log_linear_histogram(const log_linear_histogram& other)
+    {
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        buckets[i].store(other.buckets[i].load());
+      }
+    }
+
+    //*********************************
+    /// Assignment operator.
+    /// Not atomic with respect to concurrent records into 'other'.
+    //*********************************
+    log_linear_histogram& operator =(const log_linear_histogram& other)
+    {
+      if (&other != this)
+      {
+        for (size_t i = 0U; i < Bucket_Count; ++i)
+        {
+          buckets[i].store(other.buckets[i].load());
+        }
+      }
+
+      return *this;
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(value_type value)
+    {
+      buckets[index_of(value)].add(count_type(1));
+    }
+
+    //*********************************
+    /// Add a value 'n' times.
+    //*********************************
+    void add(value_type value, count_type n)
+    {
+      buckets[index_of(value)].add(n);
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(value_type value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Gets the count of the bucket that holds 'value'.
+    //*********************************
+    count_type count(value_type value) const
+    {
+      return buckets[index_of(value)].load();
+    }
+
+    //*********************************
+    /// Gets the count of the bucket at 'index'.
+    //*********************************
+    count_type count_at_index(size_t index) const
+    {
+      return buckets[index].load();
+    }
+
+    //*********************************
+    /// Gets the total number of recorded values.
+    /// O(buckets), so that recording only touches one counter.
+    //*********************************
+    uint64_t total_count() const
+    {
+      uint64_t total = 0U;
+
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        total += buckets[i].load();
+      }
+
+      return total;
+    }
+
+    //*********************************
+    /// Returns true if no values have been recorded.
+    //*********************************
+    bool empty() const
+    {
+      return total_count() == 0U;
+    }
+
+    //*********************************
+    /// Gets the value at percentile 'p' (0 to 100).
+    /// Returns the highest value equivalent to the bucket that holds the
+    /// percentile, or 0 if the histogram is empty.
+    //*********************************
+    value_type percentile(double p) const
+    {
+      const uint64_t total = total_count();
+
+      if (total == 0U)
+      {
+        return value_type(0);
+      }
+
+      p = (p < 0.0) ? 0.0 : ((p > 100.0) ? 100.0 : p);
+
+      // The rank of the requested value, rounded up and at least 1.
+      const double   exact = (p / 100.0) * double(total);
+      uint64_t       rank  = uint64_t(exact);
+      rank += (double(rank) < exact) ? 1U : 0U;
+      rank  = (rank == 0U) ? 1U : ((rank > total) ? total : rank);
+
+      uint64_t cumulative = 0U;
+
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        cumulative += buckets[i].load();
+
+        if (cumulative >= rank)
+        {
+          return highest_value_at_index(i);
+        }
+      }
+
+      return highest_value_at_index(Bucket_Count - 1U);
+    }
+
+    //*********************************
+    /// Gets the mean of the recorded values.
+    /// Each bucket contributes its mid point.
+    //*********************************
+    double mean() const
+    {
+      uint64_t total = 0U;
+      double   sum   = 0.0;
+
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        const count_type n = buckets[i].load();
+
+        if (n != 0U)
+        {
+          const value_type lowest  = lowest_value_at_index(i);
+          const value_type highest = highest_value_at_index(i);
+
+          total += n;
+          sum   += double(n) * (double(lowest) + (double(highest - lowest) / 2.0));
+        }
+      }
+
+      return (total == 0U) ? 0.0 : sum / double(total);
+    }
+
+    //*********************************
+    /// Adds the counts of 'other' to this histogram.
+    //*********************************
+    void merge(const log_linear_histogram& other)
+    {
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        const count_type n = other.buckets[i].load();
+
+        if (n != 0U)
+        {
+          buckets[i].add(n);
+        }
+      }
+    }
+
+    //*********************************
+    /// Moves the recorded counts into 'snapshot' and resets this histogram.
+    /// Each bucket is exchanged atomically, so a value recorded concurrently
+    /// lands either in the snapshot or in the next interval, never in neither.
+    //*********************************
+    void reset_and_swap(log_linear_histogram& snapshot)
+    {
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        snapshot.buckets[i].store(buckets[i].exchange(count_type(0)));
+      }
+    }
+
+    //*********************************
+    /// Clears the histogram.
+    //*********************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        buckets[i].store(count_type(0));
+      }
+    }
+
+    //*********************************
+    /// Gets the bucket index for 'value'.
+    //*********************************
+    static size_t index_of(value_type value)
+    {
+      value = (value > max_value()) ? max_value() : value;
+
+      const int    width = etl::integral_limits<value_type>::bits - etl::countl_zero(value);
+      const size_t shift = (size_t(width) > Sub_Bucket_Bits) ? size_t(width) - Sub_Bucket_Bits : 0U;
+
+      return (shift << (Sub_Bucket_Bits - 1U)) + size_t(value >> shift);
+    }
+
+    //*********************************
+    /// Gets the lowest value counted by the bucket at 'index'.
+    //*********************************
+    static value_type lowest_value_at_index(size_t index)
+    {
+      const size_t shift = shift_at_index(index);
+
+      return value_type(index - (shift << (Sub_Bucket_Bits - 1U))) << shift;
+    }
+
+    //*********************************
+    /// Gets the highest value counted by the bucket at 'index'.
+    //*********************************
+    static value_type highest_value_at_index(size_t index)
+    {
+      const size_t shift = shift_at_index(index);
+
+      return lowest_value_at_index(index) + ((value_type(1) << shift) - 1U);
+    }
+
+    //*********************************
+    /// Gets the lowest value equivalent to 'value'.
+    //*********************************
+    static value_type lowest_equivalent_value(value_type value)
+    {
+      return lowest_value_at_index(index_of(value));
+    }
+
+    //*********************************
+    /// Gets the highest value equivalent to 'value'.
+    //*********************************
+    static value_type highest_equivalent_value(value_type value)
+    {
+      return highest_value_at_index(index_of(value));
+    }
+
+    //*********************************
+    /// Gets the largest trackable value.
+    //*********************************
+    static ETL_CONSTEXPR value_type max_value()
+    {
+      return value_type(etl::integral_limits<value_type>::max >> (etl::integral_limits<value_type>::bits - Max_Exponent));
+    }
+
+    //*********************************
+    /// Gets the number of buckets.
+    //*********************************
+    static ETL_CONSTEXPR size_t size()
+    {
+      return Bucket_Count;
+    }
+
+  private:
+
+    //*********************************
+    /// Gets the shift applied to values in the bucket at 'index'.
+    //*********************************
+    static size_t shift_at_index(size_t index)
+    {
+      const size_t group = index >> (Sub_Bucket_Bits - 1U);
+
+      return (group == 0U) ? 0U : group - 1U;
+    }
+
+    private_log_linear_histogram::counter<count_type> buckets[Bucket_Count];
+  };
+
+  template <size_t Sub_Bucket_Bits_, size_t Max_Exponent_, typename TCount>
+  ETL_CONSTANT size_t log_linear_histogram<Sub_Bucket_Bits_, Max_Exponent_, TCount>::Sub_Bucket_Bits;
+
+  template <size_t Sub_Bucket_Bits_, size_t Max_Exponent_, typename TCount>
+  ETL_CONSTANT size_t log_linear_histogram<Sub_Bucket_Bits_, Max_Exponent_, TCount>::Max_Exponent;
+
+  template <size_t Sub_Bucket_Bits_, size_t Max_Exponent_, typename TCount>
+  ETL_CONSTANT size_t log_linear_histogram<Sub_Bucket_Bits_, Max_Exponent_, TCount>::Half_Bucket;
+
+  template <size_t Sub_Bucket_Bits_, size_t Max_Exponent_, typename TCount>
+  ETL_CONSTANT size_t log_linear_histogram<Sub_Bucket_Bits_, Max_Exponent_, TCount>::Bucket_Count;
+}
+
+#endif
@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/statistics_sums.h"
 
 //#include <math.h>
 #include <stdint.h>
@@ -125,6 +127,28 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a span of values.
+    //*********************************
+    void add(etl::span<const TInput> values)
+    {
+      typedef typename private_statistics::bulk_sum_type<calc_t>::type sum_t;
+
+      sum += calc_t(private_statistics::lane_sum<sum_t>(values.data(), values.size()));
+      counter += uint32_t(values.size());
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Adds the partial result of another mean.
+    //*********************************
+    void merge(const mean& other)
+    {
+      sum     += other.sum;
+      counter += other.counter;
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
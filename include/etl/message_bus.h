@@ -104,6 +104,7 @@ namespace etl
                                                              compare_router_id());
 
           router_list.insert(irouter, &router);
+          reset_dispatch_index();
         }
       }
 
@@ -127,6 +128,7 @@ namespace etl
                                                                                                     compare_router_id());
 
         router_list.erase(range.first, range.second);
+        reset_dispatch_index();
       }
     }
 
@@ -140,6 +142,7 @@ namespace etl
       if (irouter != router_list.end())
       {
         router_list.erase(irouter);
+        reset_dispatch_index();
       }
     }
 
@@ -165,6 +168,12 @@ namespace etl
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
         {
+          if (p_dispatch_entries != ETL_NULLPTR)
+          {
+            broadcast_indexed(message.get_message_id(), message);
+            break;
+          }
+
           router_list_t::iterator irouter = router_list.begin();
 
           // Broadcast to everyone.
@@ -244,6 +253,12 @@ namespace etl
         // Broadcast to all routers.
       case etl::imessage_router::ALL_MESSAGE_ROUTERS:
       {
+        if (p_dispatch_entries != ETL_NULLPTR)
+        {
+          broadcast_indexed(shared_msg.get_message().get_message_id(), shared_msg);
+          break;
+        }
+
         router_list_t::iterator irouter = router_list.begin();
 
         // Broadcast to everyone.
@@ -356,6 +371,32 @@ namespace etl
     void clear()
     {
       router_list.clear();
+      reset_dispatch_index();
+    }
+
+    //*******************************************
+    /// Clears the broadcast dispatch index, if the bus has one.
+    /// The index is rebuilt as messages are received.
+    /// Must be called if a subscribed router's successor is changed.
+    /// Message brokers, and routers that had a successor when the index was
+    /// built, are always asked again, so their changes need no reset.
+    /// If called during a broadcast, the index is cleared when the broadcast ends.
+    //*******************************************
+    void reset_dispatch_index()
+    {
+      if (p_dispatch_entries != ETL_NULLPTR)
+      {
+        if (broadcast_depth == 0U)
+        {
+          p_dispatch_entries->clear();
+          p_dispatch_routers->clear();
+          dispatch_reset_pending = false;
+        }
+        else
+        {
+          dispatch_reset_pending = true;
+        }
+      }
     }
 
     //********************************************
@@ -383,7 +424,11 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& list)
       : imessage_router(etl::imessage_router::MESSAGE_BUS),
-        router_list(list)
+        router_list(list),
+        p_dispatch_entries(ETL_NULLPTR),
+        p_dispatch_routers(ETL_NULLPTR),
+        broadcast_depth(0U),
+        dispatch_reset_pending(false)
     {
     }
 
@@ -392,12 +437,208 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& router_list_, etl::imessage_router& successor_)
       : imessage_router(etl::imessage_router::MESSAGE_BUS, successor_),
-      router_list(router_list_)
+      router_list(router_list_),
+      p_dispatch_entries(ETL_NULLPTR),
+      p_dispatch_routers(ETL_NULLPTR),
+      broadcast_depth(0U),
+      dispatch_reset_pending(false)
+    {
+    }
+
+    //*******************************************
+    /// An entry in the broadcast dispatch index.
+    /// Refers to the routers that accept the message id, and to the routers
+    /// whose answer may change, which are asked again on each broadcast.
+    //*******************************************
+    struct dispatch_entry
+    {
+      etl::message_id_t id;
+      size_t            first;
+      size_t            count;
+    };
+
+    typedef etl::ivector<dispatch_entry> dispatch_entry_list_t;
+    typedef etl::ivector<etl::imessage_router*> dispatch_router_list_t;
+
+    //*******************************************
+    /// Constructor for a bus with a broadcast dispatch index.
+    //*******************************************
+    imessage_bus(router_list_t& router_list_, dispatch_entry_list_t& dispatch_entries_, dispatch_router_list_t& dispatch_routers_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS),
+      router_list(router_list_),
+      p_dispatch_entries(&dispatch_entries_),
+      p_dispatch_routers(&dispatch_routers_),
+      broadcast_depth(0U),
+      dispatch_reset_pending(false)
+    {
+    }
+
+    //*******************************************
+    /// Constructor for a bus with a broadcast dispatch index.
+    //*******************************************
+    imessage_bus(router_list_t& router_list_, dispatch_entry_list_t& dispatch_entries_, dispatch_router_list_t& dispatch_routers_, etl::imessage_router& successor_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS, successor_),
+      router_list(router_list_),
+      p_dispatch_entries(&dispatch_entries_),
+      p_dispatch_routers(&dispatch_routers_),
+      broadcast_depth(0U),
+      dispatch_reset_pending(false)
     {
     }
 
   private:
 
+    //*******************************************
+    // How to compare dispatch entries to message ids.
+    //*******************************************
+    struct compare_dispatch_id
+    {
+      bool operator()(const dispatch_entry& entry, etl::message_id_t id) const
+      {
+        return entry.id < id;
+      }
+    };
+
+    //*******************************************
+    /// Broadcasts using the dispatch index.
+    /// Only the routers that accept the message are called.
+    /// Message buses are always called, as their subscriptions may change.
+    /// The index entry holds the routers themselves, so a broadcast completes
+    /// even if a router subscribes or unsubscribes while handling the message.
+    //*******************************************
+    template <typename TMessage>
+    void broadcast_indexed(etl::message_id_t id, TMessage& message)
+    {
+      // Message buses are always at the end of the list.
+      router_list_t::iterator ibus = etl::lower_bound(router_list.begin(),
+                                                      router_list.end(),
+                                                      etl::imessage_bus::MESSAGE_BUS,
+                                                      compare_router_id());
+
+      // An index reset is pending if a router has changed the subscriptions during a broadcast.
+      const dispatch_entry* p_entry = ETL_NULLPTR;
+
+      if (!dispatch_reset_pending)
+      {
+        p_entry = find_dispatch_entry(id, static_cast<size_t>(etl::distance(router_list.begin(), ibus)));
+      }
+
+      ++broadcast_depth;
+
+      if (p_entry != ETL_NULLPTR)
+      {
+        // Nested broadcasts only append to the index, so the range stays valid.
+        const size_t first = p_entry->first;
+        const size_t last  = first + p_entry->count;
+
+        for (size_t i = first; i < last; ++i)
+        {
+          etl::imessage_router& router = *(*p_dispatch_routers)[i];
+
+          if (!is_dynamic_router(router) || router.accepts(id))
+          {
+            router.receive(message);
+          }
+        }
+      }
+      else
+      {
+        // Not indexed, so check every router.
+        router_list_t::iterator irouter = router_list.begin();
+
+        while ((irouter != router_list.end()) && ((*irouter)->get_message_router_id() < etl::imessage_bus::MESSAGE_BUS))
+        {
+          if ((*irouter)->accepts(id))
+          {
+            (*irouter)->receive(message);
+          }
+
+          ++irouter;
+        }
+      }
+
+      ibus = etl::lower_bound(router_list.begin(),
+                              router_list.end(),
+                              etl::imessage_bus::MESSAGE_BUS,
+                              compare_router_id());
+
+      while (ibus != router_list.end())
+      {
+        if ((*ibus)->accepts(id))
+        {
+          (*ibus)->receive(message);
+        }
+
+        ++ibus;
+      }
+
+      --broadcast_depth;
+
+      if ((broadcast_depth == 0U) && dispatch_reset_pending)
+      {
+        reset_dispatch_index();
+      }
+    }
+
+    //*******************************************
+    /// Can the messages that the router accepts change without a resubscription?
+    /// Message brokers accept what their current subscribers accept.
+    /// A router with a successor accepts what the successor chain accepts.
+    //*******************************************
+    static bool is_dynamic_router(const etl::imessage_router& router)
+    {
+      return (router.get_message_router_id() > etl::imessage_router::MAX_MESSAGE_ROUTER) || router.has_successor();
+    }
+
+    //*******************************************
+    /// Finds the dispatch entry for the message id.
+    /// If not found, then one is added by asking each router if it accepts the id.
+    /// Dynamic routers are always added, as they are asked again on each broadcast.
+    /// Returns ETL_NULLPTR if there is no room in the index.
+    //*******************************************
+    const dispatch_entry* find_dispatch_entry(etl::message_id_t id, size_t n_routers)
+    {
+      dispatch_entry_list_t::iterator ientry = etl::lower_bound(p_dispatch_entries->begin(),
+                                                                p_dispatch_entries->end(),
+                                                                id,
+                                                                compare_dispatch_id());
+
+      if ((ientry != p_dispatch_entries->end()) && (ientry->id == id))
+      {
+        return &*ientry;
+      }
+
+      if (p_dispatch_entries->full())
+      {
+        return ETL_NULLPTR;
+      }
+
+      dispatch_entry entry;
+      entry.id    = id;
+      entry.first = p_dispatch_routers->size();
+      entry.count = 0U;
+
+      for (size_t i = 0U; i < n_routers; ++i)
+      {
+        etl::imessage_router* p_router = router_list[i];
+
+        if (is_dynamic_router(*p_router) || p_router->accepts(id))
+        {
+          if (p_dispatch_routers->full())
+          {
+            // No room, so undo.
+            p_dispatch_routers->resize(entry.first);
+            return ETL_NULLPTR;
+          }
+
+          p_dispatch_routers->push_back(p_router);
+          ++entry.count;
+        }
+      }
+
+      return &*p_dispatch_entries->insert(ientry, entry);
+    }
+
     //*******************************************
     // How to compare routers to router ids.
     //*******************************************
@@ -414,7 +655,11 @@ namespace etl
       }
     };
 
-    router_list_t& router_list;
+    router_list_t&          router_list;
+    dispatch_entry_list_t*  p_dispatch_entries;
+    dispatch_router_list_t* p_dispatch_routers;
+    size_t                  broadcast_depth;
+    bool                    dispatch_reset_pending;
   };
 
   //***************************************************************************
@@ -445,6 +690,45 @@ namespace etl
 
     etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
   };
+
+  //***************************************************************************
+  /// The message bus, with an index for broadcast messages.
+  /// The routers that accept a message id are found the first time that the
+  /// id is broadcast, and only those routers are called from then on.
+  /// Message brokers and routers with successors are asked again on each broadcast.
+  /// The index is reset when routers subscribe or unsubscribe.
+  /// If the index is full, then broadcasts of unindexed ids ask every router.
+  ///\tparam MAX_ROUTERS_        The maximum number of subscribed routers.
+  ///\tparam MAX_MESSAGE_IDS_    The maximum number of message ids in the index.
+  ///\tparam MAX_INDEX_ROUTERS_  The maximum number of router references in the index.
+  //***************************************************************************
+  template <uint_least8_t MAX_ROUTERS_, size_t MAX_MESSAGE_IDS_, size_t MAX_INDEX_ROUTERS_ = MAX_ROUTERS_ * MAX_MESSAGE_IDS_>
+  class message_bus_indexed : public etl::imessage_bus
+  {
+  public:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_bus_indexed()
+      : imessage_bus(router_list, dispatch_entries, dispatch_routers)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_bus_indexed(etl::imessage_router& successor_)
+      : imessage_bus(router_list, dispatch_entries, dispatch_routers, successor_)
+    {
+    }
+
+  private:
+
+    etl::vector<etl::imessage_router*, MAX_ROUTERS_>                      router_list;
+    etl::vector<imessage_bus::dispatch_entry, MAX_MESSAGE_IDS_>           dispatch_entries;
+    etl::vector<etl::imessage_router*, MAX_INDEX_ROUTERS_>                dispatch_routers;
+  };
 }
 
 #endif
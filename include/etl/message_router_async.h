@@ -0,0 +1,290 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_ROUTER_ASYNC_INCLUDED
+#define ETL_MESSAGE_ROUTER_ASYNC_INCLUDED
+
+#include "platform.h"
+#include "message.h"
+#include "message_types.h"
+#include "message_router.h"
+#include "shared_message.h"
+#include "queue_spsc_atomic.h"
+#include "delegate.h"
+#include "atomic.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for message_router_async.
+  //***************************************************************************
+  class message_router_async_exception : public etl::exception
+  {
+  public:
+
+    message_router_async_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A message that is not shared cannot be queued.
+  //***************************************************************************
+  class message_router_async_not_shared : public etl::message_router_async_exception
+  {
+  public:
+
+    message_router_async_not_shared(string_type file_name_, numeric_type line_number_)
+      : message_router_async_exception(ETL_ERROR_TEXT("message router async:not shared", ETL_MESSAGE_ROUTER_ASYNC_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// An asynchronous adaptor for a message router.
+  /// Shared messages received by the adaptor are queued in a fixed capacity,
+  /// lock free inbox and passed to the destination router when the inbox is processed.
+  /// Producers do not wait for the destination to handle the message.
+  /// The inbox supports one thread receiving messages and one thread processing them.
+  /// Messages that are not shared cannot be queued, so are rejected.
+  ///\tparam Max_Messages_ The maximum number of messages in the inbox.
+  //***************************************************************************
+  template <size_t Max_Messages_>
+  class message_router_async : public etl::imessage_router
+  {
+  public:
+
+    static ETL_CONSTANT size_t Max_Messages = Max_Messages_;
+
+    typedef etl::delegate<void(const etl::shared_message&)> overflow_callback_type;
+    typedef etl::delegate<void(size_t)>                      high_water_callback_type;
+
+    //********************************************
+    /// Constructor.
+    /// The adaptor takes the id of the destination router.
+    //********************************************
+    message_router_async(etl::imessage_router& destination_)
+      : imessage_router(destination_.get_message_router_id())
+      , destination(destination_)
+      , overflow_callback()
+      , high_water_callback()
+      , high_water_level(Max_Messages_)
+      , above_high_water(false)
+      , overflow_count(0U)
+    {
+    }
+
+    using etl::imessage_router::receive;
+    using etl::imessage_router::accepts;
+
+    //********************************************
+    /// Messages that are not shared cannot be queued.
+    /// Passing them to the destination from this thread would race with process_queue(),
+    /// so they are dropped and message_router_async_not_shared is emitted.
+    //********************************************
+    void receive(const etl::imessage&) ETL_OVERRIDE
+    {
+      ETL_ASSERT_FAIL(ETL_ERROR(etl::message_router_async_not_shared));
+    }
+
+    //********************************************
+    /// Queues the shared message in the inbox.
+    /// If the inbox is full then the message is dropped and the overflow callback is called.
+    //********************************************
+    void receive(etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+      // The consumer may remove messages at any time, so test for the level being crossed, not equalled.
+      const size_t size_before = inbox.size();
+
+      if (inbox.push(shared_msg))
+      {
+        const size_t size = inbox.size();
+
+        if (size >= high_water_level)
+        {
+          if ((size_before < high_water_level) || !above_high_water)
+          {
+            if (high_water_callback.is_valid())
+            {
+              high_water_callback(size);
+            }
+          }
+
+          above_high_water = true;
+        }
+        else
+        {
+          above_high_water = false;
+        }
+      }
+      else
+      {
+        overflow_count.fetch_add(1U, etl::memory_order_relaxed);
+
+        if (overflow_callback.is_valid())
+        {
+          overflow_callback(shared_msg);
+        }
+      }
+    }
+
+    //********************************************
+    /// Passes up to max_messages queued messages to the destination, in the order they were received.
+    /// Returns the number of messages processed.
+    //********************************************
+    size_t process_queue(size_t max_messages)
+    {
+      size_t count = 0U;
+
+      while ((count < max_messages) && !inbox.empty())
+      {
+        // The message stays in the inbox until it has been handled.
+        destination.receive(inbox.front());
+        inbox.pop();
+
+        ++count;
+      }
+
+      return count;
+    }
+
+    //********************************************
+    /// Passes all of the queued messages to the destination.
+    /// Returns the number of messages processed.
+    //********************************************
+    size_t process_queue()
+    {
+      return process_queue(Max_Messages_);
+    }
+
+    //********************************************
+    /// Sets the callback that is called when a message is dropped because the inbox is full.
+    /// Called from the thread that received the message.
+    //********************************************
+    void set_overflow_callback(overflow_callback_type callback)
+    {
+      overflow_callback = callback;
+    }
+
+    //********************************************
+    /// Sets the callback that is called when the number of queued messages reaches or passes the level.
+    /// It is called again only after the number has fallen below the level.
+    /// Called from the thread that received the message.
+    //********************************************
+    void set_high_water_callback(high_water_callback_type callback, size_t level)
+    {
+      high_water_callback = callback;
+      high_water_level    = level;
+      above_high_water    = false;
+    }
+
+    //********************************************
+    /// The number of messages dropped because the inbox was full.
+    //********************************************
+    size_t get_overflow_count() const
+    {
+      return overflow_count.load(etl::memory_order_relaxed);
+    }
+
+    //********************************************
+    /// The number of messages in the inbox.
+    /// Due to concurrency, this is a guess.
+    //********************************************
+    size_t size() const
+    {
+      return inbox.size();
+    }
+
+    //********************************************
+    /// Is the inbox empty?
+    //********************************************
+    bool empty() const
+    {
+      return inbox.empty();
+    }
+
+    //********************************************
+    /// The destination router.
+    //********************************************
+    etl::imessage_router& get_destination() const
+    {
+      return destination;
+    }
+
+    //********************************************
+    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      return destination.accepts(id);
+    }
+
+    //********************************************
+    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //********************************************
+    bool is_producer() const ETL_OVERRIDE
+    {
+      return destination.is_producer();
+    }
+
+    //********************************************
+    bool is_consumer() const ETL_OVERRIDE
+    {
+      return destination.is_consumer();
+    }
+
+  private:
+
+    etl::imessage_router&                                    destination;
+    etl::queue_spsc_atomic<etl::shared_message, Max_Messages_> inbox;
+    overflow_callback_type                                   overflow_callback;
+    high_water_callback_type                                 high_water_callback;
+    size_t                                                   high_water_level;
+    bool                                                     above_high_water; // Only used by the receiving thread.
+    etl::atomic<size_t>                                      overflow_count;
+  };
+
+  template <size_t Max_Messages_>
+  ETL_CONSTANT size_t message_router_async<Max_Messages_>::Max_Messages;
+}
+
+#endif
+#endif
@@ -291,6 +291,14 @@ SOFTWARE.
   #define ETL_HAS_MUTABLE_ARRAY_VIEW 0
 #endif
 
+//*************************************
+// Option to disable the block kernels that algorithms use for contiguous arithmetic ranges.
+#if defined(ETL_NO_ALGORITHM_BLOCK_KERNELS)
+  #define ETL_HAS_ALGORITHM_BLOCK_KERNELS 0
+#else
+  #define ETL_HAS_ALGORITHM_BLOCK_KERNELS 1
+#endif
+
 //*************************************
 // Indicate if etl::imassage is to be non-virtual.
 #if defined(ETL_MESSAGES_ARE_NOT_VIRTUAL)
@@ -670,6 +678,7 @@ namespace etl
     static ETL_CONSTANT bool has_ivector_repair               = (ETL_HAS_IVECTOR_REPAIR == 1);
     static ETL_CONSTANT bool has_icircular_buffer_repair      = (ETL_HAS_ICIRCULAR_BUFFER_REPAIR == 1);
     static ETL_CONSTANT bool has_mutable_array_view           = (ETL_HAS_MUTABLE_ARRAY_VIEW == 1);
+    static ETL_CONSTANT bool has_algorithm_block_kernels      = (ETL_HAS_ALGORITHM_BLOCK_KERNELS == 1);
     static ETL_CONSTANT bool has_ideque_repair                = (ETL_HAS_IDEQUE_REPAIR == 1);
     static ETL_CONSTANT bool has_virtual_messages             = (ETL_HAS_VIRTUAL_MESSAGES == 1);
     static ETL_CONSTANT bool has_packed                       = (ETL_HAS_PACKED == 1);
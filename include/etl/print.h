@@ -34,19 +34,118 @@ SOFTWARE.
 #include "platform.h"
 
 #include "format.h"
+#include "static_assert.h"
 
 #if ETL_USING_CPP11
 
+#if defined(ETL_PRINT_BUFFER_SIZE)
+// ETL_PRINT_BUFFER_SIZE and ETL_PRINT_BUFFER_SINGLE_THREAD change the layout of the inline buffer,
+// so they must be defined the same in every translation unit, for example in etl_profile.h
+// to be implemented in a concrete project, typically writing to a serial console or stdout
+// called with the buffered characters when the buffer is full or etl::print_flush() is called
+extern "C" void etl_write(const char* data, size_t length);
+#else
 // to be implemented in a concrete project, typically printing to a serial console
 // type int here is the convention from putchar(), actually storing char
 extern "C" void etl_putchar(int c);
+#endif
 
 namespace etl
 {
+#if defined(ETL_PRINT_BUFFER_SIZE)
+  // Keeps the buffered definitions distinct from the unbuffered ones.
+  inline namespace print_buffered
+  {
+#endif
+
   namespace private_print
   {
     using char_type = etl::private_format::char_type;
 
+#if defined(ETL_PRINT_BUFFER_SIZE)
+    ETL_STATIC_ASSERT(ETL_PRINT_BUFFER_SIZE > 0, "ETL_PRINT_BUFFER_SIZE must be greater than zero");
+
+    // Characters waiting to be passed to etl_write
+    struct print_buffer
+    {
+      char_type buffer[ETL_PRINT_BUFFER_SIZE];
+      size_t    size;
+    };
+
+    // One buffer per thread, so that threads printing at the same time cannot overrun it
+    // For targets without thread_local, define ETL_PRINT_BUFFER_SINGLE_THREAD to use one buffer per program
+    // There is no lock, so etl::print and etl::print_flush must then only be called from one thread
+    // A thread's unflushed output is lost when the thread ends, so call etl::print_flush before then
+    inline print_buffer& get_print_buffer()
+    {
+  #if defined(ETL_PRINT_BUFFER_SINGLE_THREAD)
+      static print_buffer buffer;
+  #else
+      static thread_local print_buffer buffer;
+  #endif
+      return buffer;
+    }
+
+    inline void flush(print_buffer& buffer)
+    {
+      if (buffer.size != 0U)
+      {
+        etl_write(buffer.buffer, buffer.size);
+        buffer.size = 0U;
+      }
+    }
+
+    // Iterator that appends all assignments to the print buffer, passing it to etl_write when full
+    class print_iterator
+    {
+    public:
+      class print_to
+      {
+      public:
+        explicit print_to(print_buffer& buffer_)
+        : buffer(buffer_)
+        {
+        }
+
+        print_to& operator=(char_type c)
+        {
+          if (buffer.size == ETL_PRINT_BUFFER_SIZE)
+          {
+            flush(buffer);
+          }
+
+          buffer.buffer[buffer.size++] = c;
+          return *this;
+        }
+
+      private:
+        print_buffer& buffer;
+      };
+
+      print_iterator()
+      : buffer(&get_print_buffer())
+      {
+      }
+
+      print_to operator*()
+      {
+        return print_to(*buffer);
+      }
+
+      print_iterator& operator++()
+      {
+        return *this;
+      }
+
+      print_iterator operator++(int)
+      {
+        return *this;
+      }
+
+    private:
+      print_buffer* buffer;
+    };
+#else
     // No-op iterator that forwards all assignments to etl_putchar
     class print_iterator
     {
@@ -89,8 +188,18 @@ namespace etl
         return *this;
       }
     };
+#endif
   }  // namespace private_print
 
+  // Passes any buffered output to etl_write
+  // Does nothing if ETL_PRINT_BUFFER_SIZE is not defined, as output is not buffered
+  inline void print_flush()
+  {
+#if defined(ETL_PRINT_BUFFER_SIZE)
+    private_print::flush(private_print::get_print_buffer());
+#endif
+  }
+
   template <class... Args>
   void print(etl::format_string<Args...> fmt, Args&&... args)
   {
@@ -100,7 +209,8 @@ namespace etl
 
   inline void println()
   {
-    etl_putchar(static_cast<int>('\n'));
+    private_print::print_iterator it;
+    *it = '\n';
   }
 
   template <class... Args>
@@ -110,6 +220,25 @@ namespace etl
     (void)format_to(it, etl::move(fmt), etl::forward<Args>(args)...);
     println();
   }
+
+  template <size_t Max_Segments, class... Args>
+  void print(const etl::compiled_format<Max_Segments, Args...>& fmt, const etl::type_identity_t<Args>&... args)
+  {
+    private_print::print_iterator it;
+    (void)format_to(it, fmt, args...);
+  }
+
+  template <size_t Max_Segments, class... Args>
+  void println(const etl::compiled_format<Max_Segments, Args...>& fmt, const etl::type_identity_t<Args>&... args)
+  {
+    private_print::print_iterator it;
+    (void)format_to(it, fmt, args...);
+    println();
+  }
+
+#if defined(ETL_PRINT_BUFFER_SIZE)
+  }  // namespace print_buffered
+#endif
 }  // namespace etl
 
 #endif
@@ -683,26 +683,19 @@ namespace etl
     {
       if (position < active_bits)
       {
-        // Where to start.
-        size_t bit = position;
+        // Searching for clear bits is searching for set bits in the inverse.
+        element_type value = state ? *pbuffer : element_type(~*pbuffer);
 
-        element_type mask = 1U << position;
+        // Ignore the bits below the start position.
+        value = element_type(value & element_type(All_Set_Element << position));
 
-        // Needs checking?
-        if ((state && (*pbuffer != All_Clear_Element)) || (!state && (*pbuffer != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while (bit < active_bits)
+          position = etl::count_trailing_zeros(value);
+
+          if (position < active_bits)
           {
-            // Equal to the required state?
-            if (((*pbuffer & mask) != 0) == state)
-            {
-              return bit;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++bit;
+            return position;
           }
         }
       }
@@ -710,6 +703,35 @@ namespace etl
       return npos;
     }
 
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending order.
+    //*************************************************************************
+    template <typename TFunction>
+    static
+    ETL_CONSTEXPR14
+    void for_each_set_bit(const_pointer pbuffer,
+                          size_t        /*number_of_elements*/,
+                          size_t        active_bits,
+                          TFunction&    function)
+    {
+      element_type value = *pbuffer;
+
+      while (value != All_Clear_Element)
+      {
+        const size_t position = etl::count_trailing_zeros(value);
+
+        if (position >= active_bits)
+        {
+          return;
+        }
+
+        function(position);
+
+        // Clear the lowest set bit.
+        value = element_type(value & (value - 1U));
+      }
+    }
+
     //*************************************************************************
     /// operator assignment
     /// Assigns rhs to lhs
@@ -911,6 +933,15 @@ namespace etl
     {
       size_t count = 0;
 
+      // Whole words.
+      while (number_of_elements >= Elements_Per_Word)
+      {
+        count += etl::count_bits(load_word(pbuffer));
+        pbuffer += Elements_Per_Word;
+        number_of_elements -= Elements_Per_Word;
+      }
+
+      // Remaining elements.
       while (number_of_elements-- != 0)
       {
         count += etl::count_bits(*pbuffer++);
@@ -1474,49 +1505,108 @@ namespace etl
                      bool          state, 
                      size_t        position) ETL_NOEXCEPT
     {
+      if (position >= total_bits)
+      {
+        return npos;
+      }
+
+      // Searching for clear bits is searching for set bits in the inverse.
+      const element_type invert      = state ? All_Clear_Element : All_Set_Element;
+      const word_type    word_invert = state ? word_type(0) : word_type(~word_type(0));
+
       // Where to start.
-      size_t index = position >> log2<Bits_Per_Element>::value;
-      size_t bit   = position & (Bits_Per_Element - 1);
+      size_t index = position >> etl::log2<Bits_Per_Element>::value;
 
-      element_type mask = 1 << bit;
+      // Ignore the bits below the start position.
+      element_type value = element_type(pbuffer[index] ^ invert);
+      value = element_type(value & element_type(All_Set_Element << (position & (Bits_Per_Element - 1))));
 
-      // For each element in the bitset...
-      while (index < number_of_elements)
+      while (value == All_Clear_Element)
       {
-        element_type value = pbuffer[index];
+        ++index;
 
-        // Needs checking?
-        if ((state && (value != All_Clear_Element)) ||
-            (!state && (value != All_Set_Element)))
+        // Skip whole words with no bits in the required state.
+        while (((index + Elements_Per_Word) <= number_of_elements) && (load_word(pbuffer + index) == word_invert))
         {
-          // For each bit in the element...
-          while ((bit < Bits_Per_Element) && (position < total_bits))
+          index += Elements_Per_Word;
+        }
+
+        if (index >= number_of_elements)
+        {
+          return npos;
+        }
+
+        value = element_type(pbuffer[index] ^ invert);
+      }
+
+      position = (index << etl::log2<Bits_Per_Element>::value) + etl::count_trailing_zeros(value);
+
+      // The unused bits of the last element are clear, so may be found when searching for clear bits.
+      return (position < total_bits) ? position : npos;
+    }
+
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending order.
+    //*************************************************************************
+    template <typename TFunction>
+    static
+    ETL_CONSTEXPR14
+    void for_each_set_bit(const_pointer pbuffer,
+                          size_t        number_of_elements,
+                          size_t        total_bits,
+                          TFunction&    function)
+    {
+      size_t index = 0U;
+
+      // Whole words.
+      while ((index + Elements_Per_Word) <= number_of_elements)
+      {
+        word_type word = load_word(pbuffer + index);
+
+        const size_t base = index << etl::log2<Bits_Per_Element>::value;
+
+        while (word != 0U)
+        {
+          const size_t position = base + etl::count_trailing_zeros(word);
+
+          if (position >= total_bits)
           {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
+            return;
           }
+
+          function(position);
+
+          // Clear the lowest set bit.
+          word = word_type(word & (word - 1U));
         }
-        else
+
+        index += Elements_Per_Word;
+      }
+
+      // Remaining elements.
+      while (index < number_of_elements)
+      {
+        element_type value = pbuffer[index];
+
+        const size_t base = index << etl::log2<Bits_Per_Element>::value;
+
+        while (value != All_Clear_Element)
         {
-          position += (Bits_Per_Element - bit);
-        }
+          const size_t position = base + etl::count_trailing_zeros(value);
+
+          if (position >= total_bits)
+          {
+            return;
+          }
 
-        // Start at the beginning for all other elements.
-        bit = 0;
-        mask = 1;
+          function(position);
+
+          // Clear the lowest set bit.
+          value = element_type(value & (value - 1U));
+        }
 
         ++index;
       }
-
-      return npos;
     }
 
     //*************************************************************************
@@ -1571,6 +1661,16 @@ namespace etl
                       const_pointer rhs_pbuffer, 
                       size_t        number_of_elements) ETL_NOEXCEPT
     {
+      // Whole words.
+      while (number_of_elements >= Elements_Per_Word)
+      {
+        store_word(lhs_pbuffer, word_type(load_word(lhs_pbuffer) & load_word(rhs_pbuffer)));
+        lhs_pbuffer += Elements_Per_Word;
+        rhs_pbuffer += Elements_Per_Word;
+        number_of_elements -= Elements_Per_Word;
+      }
+
+      // Remaining elements.
       while (number_of_elements-- != 0)
       {
         *lhs_pbuffer &= *rhs_pbuffer;
@@ -1588,6 +1688,16 @@ namespace etl
                      const_pointer rhs_pbuffer, 
                      size_t        number_of_elements) ETL_NOEXCEPT
     {
+      // Whole words.
+      while (number_of_elements >= Elements_Per_Word)
+      {
+        store_word(lhs_pbuffer, word_type(load_word(lhs_pbuffer) | load_word(rhs_pbuffer)));
+        lhs_pbuffer += Elements_Per_Word;
+        rhs_pbuffer += Elements_Per_Word;
+        number_of_elements -= Elements_Per_Word;
+      }
+
+      // Remaining elements.
       while (number_of_elements-- != 0)
       {
         *lhs_pbuffer |= *rhs_pbuffer;
@@ -1605,6 +1715,16 @@ namespace etl
                       const_pointer rhs_pbuffer, 
                       size_t        number_of_elements) ETL_NOEXCEPT
     {
+      // Whole words.
+      while (number_of_elements >= Elements_Per_Word)
+      {
+        store_word(lhs_pbuffer, word_type(load_word(lhs_pbuffer) ^ load_word(rhs_pbuffer)));
+        lhs_pbuffer += Elements_Per_Word;
+        rhs_pbuffer += Elements_Per_Word;
+        number_of_elements -= Elements_Per_Word;
+      }
+
+      // Remaining elements.
       while (number_of_elements-- != 0)
       {
         *lhs_pbuffer ^= *rhs_pbuffer;
@@ -1835,8 +1955,128 @@ namespace etl
     {
       etl::swap_ranges(pbuffer1, pbuffer1 + number_of_elements, pbuffer2);
     }
+
+  private:
+
+    //*************************************************************************
+    /// Bulk operations on narrow elements process a word of elements at a time.
+    //*************************************************************************
+#if ETL_USING_64BIT_TYPES
+    typedef typename etl::conditional<(sizeof(element_type) < sizeof(uint64_t)), uint64_t, element_type>::type word_type;
+#else
+    typedef typename etl::conditional<(sizeof(element_type) < sizeof(uint32_t)), uint32_t, element_type>::type word_type;
+#endif
+
+    static ETL_CONSTANT size_t Elements_Per_Word = sizeof(word_type) / sizeof(element_type);
+
+    typedef etl::integral_constant<size_t, Elements_Per_Word> elements_per_word_t;
+
+    //*************************************************************************
+    /// Gets a word of elements. The first element is the least significant.
+    //*************************************************************************
+    static
+    ETL_CONSTEXPR14
+    word_type load_word(const_pointer pbuffer) ETL_NOEXCEPT
+    {
+      return load_word(pbuffer, elements_per_word_t());
+    }
+
+    //*************************************************************************
+    /// Sets a word of elements. The first element is the least significant.
+    //*************************************************************************
+    static
+    ETL_CONSTEXPR14
+    void store_word(pointer pbuffer, word_type word) ETL_NOEXCEPT
+    {
+      store_word(pbuffer, word, elements_per_word_t());
+    }
+
+    //*************************************************************************
+    /// The words are assembled explicitly, so that the compiler may replace
+    /// them with single loads and stores.
+    //*************************************************************************
+    static
+    ETL_CONSTEXPR14
+    word_type load_word(const_pointer pbuffer, etl::integral_constant<size_t, 1U>) ETL_NOEXCEPT
+    {
+      return word_type(pbuffer[0]);
+    }
+
+    static
+    ETL_CONSTEXPR14
+    word_type load_word(const_pointer pbuffer, etl::integral_constant<size_t, 2U>) ETL_NOEXCEPT
+    {
+      return word_type(word_type(pbuffer[0]) | 
+                       (word_type(pbuffer[1]) << Bits_Per_Element));
+    }
+
+    static
+    ETL_CONSTEXPR14
+    word_type load_word(const_pointer pbuffer, etl::integral_constant<size_t, 4U>) ETL_NOEXCEPT
+    {
+      return word_type(word_type(pbuffer[0]) | 
+                       (word_type(pbuffer[1]) << Bits_Per_Element) | 
+                       (word_type(pbuffer[2]) << (2U * Bits_Per_Element)) | 
+                       (word_type(pbuffer[3]) << (3U * Bits_Per_Element)));
+    }
+
+    static
+    ETL_CONSTEXPR14
+    word_type load_word(const_pointer pbuffer, etl::integral_constant<size_t, 8U>) ETL_NOEXCEPT
+    {
+      return word_type(word_type(pbuffer[0]) | 
+                       (word_type(pbuffer[1]) << Bits_Per_Element) | 
+                       (word_type(pbuffer[2]) << (2U * Bits_Per_Element)) | 
+                       (word_type(pbuffer[3]) << (3U * Bits_Per_Element)) | 
+                       (word_type(pbuffer[4]) << (4U * Bits_Per_Element)) | 
+                       (word_type(pbuffer[5]) << (5U * Bits_Per_Element)) | 
+                       (word_type(pbuffer[6]) << (6U * Bits_Per_Element)) | 
+                       (word_type(pbuffer[7]) << (7U * Bits_Per_Element)));
+    }
+
+    static
+    ETL_CONSTEXPR14
+    void store_word(pointer pbuffer, word_type word, etl::integral_constant<size_t, 1U>) ETL_NOEXCEPT
+    {
+      pbuffer[0] = element_type(word);
+    }
+
+    static
+    ETL_CONSTEXPR14
+    void store_word(pointer pbuffer, word_type word, etl::integral_constant<size_t, 2U>) ETL_NOEXCEPT
+    {
+      pbuffer[0] = element_type(word);
+      pbuffer[1] = element_type(word >> Bits_Per_Element);
+    }
+
+    static
+    ETL_CONSTEXPR14
+    void store_word(pointer pbuffer, word_type word, etl::integral_constant<size_t, 4U>) ETL_NOEXCEPT
+    {
+      pbuffer[0] = element_type(word);
+      pbuffer[1] = element_type(word >> Bits_Per_Element);
+      pbuffer[2] = element_type(word >> (2U * Bits_Per_Element));
+      pbuffer[3] = element_type(word >> (3U * Bits_Per_Element));
+    }
+
+    static
+    ETL_CONSTEXPR14
+    void store_word(pointer pbuffer, word_type word, etl::integral_constant<size_t, 8U>) ETL_NOEXCEPT
+    {
+      pbuffer[0] = element_type(word);
+      pbuffer[1] = element_type(word >> Bits_Per_Element);
+      pbuffer[2] = element_type(word >> (2U * Bits_Per_Element));
+      pbuffer[3] = element_type(word >> (3U * Bits_Per_Element));
+      pbuffer[4] = element_type(word >> (4U * Bits_Per_Element));
+      pbuffer[5] = element_type(word >> (5U * Bits_Per_Element));
+      pbuffer[6] = element_type(word >> (6U * Bits_Per_Element));
+      pbuffer[7] = element_type(word >> (7U * Bits_Per_Element));
+    }
   };
 
+  template <typename TElement>
+  ETL_CONSTANT size_t bitset_impl<TElement, etl::bitset_storage_model::Multi>::Elements_Per_Word;
+
   namespace private_bitset
   {
     //***************************************************************************
@@ -2135,6 +2375,21 @@ namespace etl
       return *this;
     }
 
+    //*************************************************************************
+    /// Set the bits at the positions.
+    //*************************************************************************
+    bitset<Active_Bits, TElement>& set(etl::span<const size_t> positions, bool value = true)
+    {
+      for (size_t i = 0U; i < positions.size(); ++i)
+      {
+        ETL_ASSERT_OR_RETURN_VALUE(positions[i] < Active_Bits, ETL_ERROR(bitset_overflow), *this);
+
+        implementation::set_position(buffer, positions[i], value);
+      }
+
+      return *this;
+    }
+
     //*************************************************************************
     /// Set the bit at the position.
     //*************************************************************************
@@ -2568,6 +2823,18 @@ namespace etl
       return implementation::find_next(buffer, Number_Of_Elements, Active_Bits, state, position);
     }
 
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending order.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 TFunction for_each_set_bit(TFunction function) const
+    {
+      implementation::for_each_set_bit(buffer, Number_Of_Elements, Active_Bits, function);
+
+      return function;
+    }
+
     //*************************************************************************
     /// operator &
     //*************************************************************************
@@ -3138,6 +3405,21 @@ namespace etl
       return *this;
     }
 
+    //*************************************************************************
+    /// Set the bits at the positions.
+    //*************************************************************************
+    bitset_ext<Active_Bits, TElement>& set(etl::span<const size_t> positions, bool value = true)
+    {
+      for (size_t i = 0U; i < positions.size(); ++i)
+      {
+        ETL_ASSERT_OR_RETURN_VALUE(positions[i] < Active_Bits, ETL_ERROR(bitset_overflow), *this);
+
+        implementation::set_position(pbuffer, positions[i], value);
+      }
+
+      return *this;
+    }
+
     //*************************************************************************
     /// Set the bit at the position.
     //*************************************************************************
@@ -3570,6 +3852,18 @@ namespace etl
       return implementation::find_next(pbuffer, Number_Of_Elements, Active_Bits, state, position);
     }
 
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending order.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 TFunction for_each_set_bit(TFunction function) const
+    {
+      implementation::for_each_set_bit(pbuffer, Number_Of_Elements, Active_Bits, function);
+
+      return function;
+    }
+
     //*************************************************************************
     /// operator &=
     //*************************************************************************
@@ -0,0 +1,1701 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#if !defined(ETL_IN_BTREE_MAP_H) && !defined(ETL_IN_BTREE_SET_H)
+#error This header is a private element of etl::btree_map & etl::btree_set
+#endif
+
+#ifndef ETL_BTREE_BASE_INCLUDED
+#define ETL_BTREE_BASE_INCLUDED
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../iterator.h"
+#include "../utility.h"
+#include "../memory.h"
+#include "../pool.h"
+#include "../exception.h"
+#include "../error_handler.h"
+#include "../type_traits.h"
+#include "../placement_new.h"
+#include "../static_assert.h"
+#include "../file_error_numbers.h"
+#include "comparator_is_transparent.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for B+ trees.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_exception : public etl::exception
+  {
+  public:
+
+    btree_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// B+ tree full exception.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_full : public etl::btree_exception
+  {
+  public:
+
+    btree_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_exception(ETL_ERROR_TEXT("btree:full", ETL_BTREE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// B+ tree out of bounds exception.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_out_of_bounds : public etl::btree_exception
+  {
+  public:
+
+    btree_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::btree_exception(ETL_ERROR_TEXT("btree:bounds", ETL_BTREE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The B+ tree shared by etl::btree_map and etl::btree_set.
+  /// Leaves hold up to Fanout values in a contiguous array and are linked in
+  /// order. Internal nodes hold up to Fanout children and Fanout - 1
+  /// separator keys in a contiguous array. Every node apart from the root is
+  /// kept at least half full. Searches within a node are branchless binary
+  /// searches.
+  /// Inserting or erasing may move values between nodes, so iterators and
+  /// references are invalidated by any modification.
+  ///\tparam TValue      The stored value type.
+  ///\tparam TKey        The key type.
+  ///\tparam TKeyOf      Provides 'static const TKey& get(const TValue&)'.
+  ///\tparam TKeyCompare The key comparison type.
+  ///\tparam Fanout_     The maximum number of children or values in a node.
+  ///\ingroup btree
+  //***************************************************************************
+  template <typename TValue, typename TKey, typename TKeyOf, typename TKeyCompare, const size_t Fanout_>
+  class btree_base
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Fanout_ >= 4U, "Fanout must be at least 4");
+
+    typedef TKey              key_type;
+    typedef TValue            value_type;
+    typedef TKeyCompare       key_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+    typedef const key_type&   const_key_reference;
+
+    static ETL_CONSTANT size_t Fanout       = Fanout_;
+    static ETL_CONSTANT size_t Min_Values   = Fanout_ / 2U;
+    static ETL_CONSTANT size_t Min_Children = (Fanout_ + 1U) / 2U;
+
+  protected:
+
+    struct Internal_Node;
+
+    //*************************************************************************
+    /// The common part of leaf and internal nodes.
+    //*************************************************************************
+    struct Node
+    {
+      Internal_Node* parent;
+      size_type      count; ///< The number of values in a leaf or children in an internal node.
+      bool           is_leaf;
+    };
+
+    //*************************************************************************
+    /// A leaf holds the values.
+    //*************************************************************************
+    struct Leaf_Node : public Node
+    {
+      value_type* values()
+      {
+        return reinterpret_cast<value_type*>(&storage);
+      }
+
+      const value_type* values() const
+      {
+        return reinterpret_cast<const value_type*>(&storage);
+      }
+
+      Leaf_Node* previous;
+      Leaf_Node* next;
+      typename etl::aligned_storage<sizeof(value_type) * Fanout_, etl::alignment_of<value_type>::value>::type storage;
+    };
+
+    //*************************************************************************
+    /// An internal node holds the separator keys and child pointers.
+    /// Every key in children[i] is less than keys()[i], which is less than or
+    /// equal to every key in children[i + 1].
+    //*************************************************************************
+    struct Internal_Node : public Node
+    {
+      key_type* keys()
+      {
+        return reinterpret_cast<key_type*>(&storage);
+      }
+
+      const key_type* keys() const
+      {
+        return reinterpret_cast<const key_type*>(&storage);
+      }
+
+      Node* children[Fanout_];
+      typename etl::aligned_storage<sizeof(key_type) * (Fanout_ - 1U), etl::alignment_of<key_type>::value>::type storage;
+    };
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class btree_base;
+      friend class const_iterator;
+
+      iterator()
+        : p_tree(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        btree_base::increment(p_leaf, index);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        btree_base::increment(p_leaf, index);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        p_tree->decrement(p_leaf, index);
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        p_tree->decrement(p_leaf, index);
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return p_leaf->values()[index];
+      }
+
+      pointer operator &() const
+      {
+        return &(p_leaf->values()[index]);
+      }
+
+      pointer operator ->() const
+      {
+        return &(p_leaf->values()[index]);
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(const btree_base* p_tree_, Leaf_Node* p_leaf_, size_type index_)
+        : p_tree(p_tree_)
+        , p_leaf(p_leaf_)
+        , index(index_)
+      {
+      }
+
+      const btree_base* p_tree;
+      Leaf_Node*        p_leaf;
+      size_type         index;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class btree_base;
+
+      const_iterator()
+        : p_tree(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      const_iterator(const typename btree_base::iterator& other)
+        : p_tree(other.p_tree)
+        , p_leaf(other.p_leaf)
+        , index(other.index)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        btree_base::increment(p_leaf, index);
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        btree_base::increment(p_leaf, index);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        p_tree->decrement(p_leaf, index);
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        p_tree->decrement(p_leaf, index);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return p_leaf->values()[index];
+      }
+
+      const_pointer operator &() const
+      {
+        return &(p_leaf->values()[index]);
+      }
+
+      const_pointer operator ->() const
+      {
+        return &(p_leaf->values()[index]);
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const btree_base* p_tree_, const Leaf_Node* p_leaf_, size_type index_)
+        : p_tree(p_tree_)
+        , p_leaf(const_cast<Leaf_Node*>(p_leaf_))
+        , index(index_)
+      {
+      }
+
+      const btree_base* p_tree;
+      Leaf_Node*        p_leaf;
+      size_type         index;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(this, p_first_leaf, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, p_first_leaf, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, p_first_leaf, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(this, ETL_NULLPTR, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, ETL_NULLPTR, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(this, ETL_NULLPTR, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*********************************************************************
+    /// Inserts a value.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the value with the key and a flag that is true if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      Leaf_Node* p_leaf;
+      size_type  index;
+
+      if (locate_insert(TKeyOf::get(value), p_leaf, index))
+      {
+        return ETL_OR_STD::make_pair(iterator(this, p_leaf, index), false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(btree_full), ETL_OR_STD::make_pair(end(), false));
+
+      Leaf_Node*  p_new_leaf;
+      value_type* p_value = make_room(p_leaf, index, p_new_leaf);
+      ::new (p_value) value_type(value);
+      complete_split(p_new_leaf);
+
+      return ETL_OR_STD::make_pair(iterator(this, p_leaf, index), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the value with the key and a flag that is true if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      Leaf_Node* p_leaf;
+      size_type  index;
+
+      if (locate_insert(TKeyOf::get(value), p_leaf, index))
+      {
+        return ETL_OR_STD::make_pair(iterator(this, p_leaf, index), false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(btree_full), ETL_OR_STD::make_pair(end(), false));
+
+      Leaf_Node*  p_new_leaf;
+      value_type* p_value = make_room(p_leaf, index, p_new_leaf);
+      ::new (p_value) value_type(ETL_MOVE(value));
+      complete_split(p_new_leaf);
+
+      return ETL_OR_STD::make_pair(iterator(this, p_leaf, index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value. The hint is ignored.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree is already full.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value. The hint is ignored.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree is already full.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      return insert(ETL_MOVE(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree does not have enough free space.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Constructs a value and inserts it if the key is not already present.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree is already full.
+    //*********************************************************************
+    template <typename ... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(Args && ... args)
+    {
+      return insert(value_type(etl::forward<Args>(args)...));
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns a range of values.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Erases the value at the position.
+    ///\return An iterator to the following value.
+    //*********************************************************************
+    iterator erase(const_iterator position)
+    {
+      Leaf_Node* p_leaf = position.p_leaf;
+      size_type  index  = position.index;
+
+      if ((p_leaf->parent == ETL_NULLPTR) && (p_leaf->count == 1U))
+      {
+        // The last value.
+        erase_value(p_leaf, index);
+        return end();
+      }
+      else if ((p_leaf->parent == ETL_NULLPTR) || (p_leaf->count > Min_Values))
+      {
+        // The leaf will not be rebalanced, so the following value does not move.
+        erase_value(p_leaf, index);
+
+        iterator itr(this, p_leaf, index);
+        normalise(itr.p_leaf, itr.index);
+        return itr;
+      }
+      else
+      {
+        key_type key(TKeyOf::get(*position));
+        erase_value(p_leaf, index);
+        return lower_bound(key);
+      }
+    }
+
+    //*********************************************************************
+    /// Erases a range of values.
+    ///\return An iterator to the value following the range.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      if (last == cend())
+      {
+        while (first != cend())
+        {
+          first = erase(first);
+        }
+
+        return end();
+      }
+
+      // Erasing may move the values, so track the end of the range by its key.
+      key_type last_key(TKeyOf::get(*last));
+      iterator itr = iterator(this, first.p_leaf, first.index);
+
+      while ((itr != end()) && compare(TKeyOf::get(*itr), last_key))
+      {
+        itr = erase(itr);
+      }
+
+      return itr;
+    }
+
+    //*********************************************************************
+    /// Erases the value with the key.
+    ///\return The number of values erased, 0 or 1.
+    //*********************************************************************
+    size_type erase(const_key_reference key)
+    {
+      return erase_key(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type erase(K&& key)
+    {
+      return erase_key(key);
+    }
+#endif
+
+    //*************************************************************************
+    /// Clears the tree and returns all nodes to the pools.
+    //*************************************************************************
+    void clear()
+    {
+      if (p_root != ETL_NULLPTR)
+      {
+        if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<value_type>::value && etl::is_trivially_destructible<key_type>::value)
+        {
+          p_leaf_pool->release_all();
+          p_internal_pool->release_all();
+        }
+        else
+        {
+          destroy(p_root);
+        }
+      }
+
+      p_root       = ETL_NULLPTR;
+      p_first_leaf = ETL_NULLPTR;
+      p_last_leaf  = ETL_NULLPTR;
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Finds the value with the key.
+    ///\return An iterator to the value, or end() if not found.
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      return find_key(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return find_key(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the value with the key.
+    ///\return An iterator to the value, or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return const_cast<btree_base*>(this)->find_key(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return const_cast<btree_base*>(this)->find_key(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts the values with the key.
+    ///\return 0 or 1.
+    //*********************************************************************
+    size_type count(const_key_reference key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type count(const K& key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the tree contains the key.
+    //*********************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find(key) != end();
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the first value whose key is not less than the key.
+    //*********************************************************************
+    iterator lower_bound(const_key_reference key)
+    {
+      return lower_bound_key(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return lower_bound_key(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the first value whose key is not less than the key.
+    //*********************************************************************
+    const_iterator lower_bound(const_key_reference key) const
+    {
+      return const_cast<btree_base*>(this)->lower_bound_key(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return const_cast<btree_base*>(this)->lower_bound_key(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the first value whose key is greater than the key.
+    //*********************************************************************
+    iterator upper_bound(const_key_reference key)
+    {
+      return upper_bound_key(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return upper_bound_key(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the first value whose key is greater than the key.
+    //*********************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      return const_cast<btree_base*>(this)->upper_bound_key(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return const_cast<btree_base*>(this)->upper_bound_key(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of values with the key.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of values with the key.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the size of the tree.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the tree is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the tree is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the tree.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the tree.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of levels in the tree.
+    //*************************************************************************
+    size_type height() const
+    {
+      size_type levels = 0U;
+      const Node* p_node = p_root;
+
+      while (p_node != ETL_NULLPTR)
+      {
+        ++levels;
+        p_node = p_node->is_leaf ? ETL_NULLPTR : static_cast<const Internal_Node*>(p_node)->children[0];
+      }
+
+      return levels;
+    }
+
+    //*************************************************************************
+    /// Gets the key comparison function.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    btree_base(etl::ipool& leaf_pool, etl::ipool& internal_pool, size_type max_size_)
+      : p_leaf_pool(&leaf_pool)
+      , p_internal_pool(&internal_pool)
+      , p_root(ETL_NULLPTR)
+      , p_first_leaf(ETL_NULLPTR)
+      , p_last_leaf(ETL_NULLPTR)
+      , current_size(0U)
+      , CAPACITY(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_base()
+    {
+    }
+
+    //*************************************************************************
+    /// Finds the leaf and position for the key.
+    /// Returns true if the key is already present.
+    //*************************************************************************
+    template <typename TK>
+    bool locate_insert(const TK& key, Leaf_Node*& p_leaf, size_type& index)
+    {
+      if (p_root == ETL_NULLPTR)
+      {
+        p_leaf = ETL_NULLPTR;
+        index  = 0U;
+        return false;
+      }
+
+      p_leaf = find_leaf(key);
+      index  = leaf_lower_bound(*p_leaf, key);
+
+      return (index < p_leaf->count) && !compare(key, TKeyOf::get(p_leaf->values()[index]));
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Moves a value to uninitialised memory and ends the lifetime of the original.
+    //*************************************************************************
+    template <typename T>
+    static void relocate(T* p_from, T* p_to)
+    {
+      ::new (p_to) T(ETL_MOVE(*p_from));
+      p_from->~T();
+    }
+
+    //*************************************************************************
+    /// Moves 'n' items up one place, starting from the top.
+    //*************************************************************************
+    template <typename T>
+    static void shift_up(T* p_first, size_type n)
+    {
+      for (size_type i = n; i > 0U; --i)
+      {
+        relocate(p_first + i - 1U, p_first + i);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves 'n' items down one place, into uninitialised memory at p_first - 1.
+    //*************************************************************************
+    template <typename T>
+    static void shift_down(T* p_first, size_type n)
+    {
+      for (size_type i = 0U; i < n; ++i)
+      {
+        relocate(p_first + i, p_first + i - 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Branchless search for the first value in the leaf not less than the key.
+    //*************************************************************************
+    template <typename TK>
+    size_type leaf_lower_bound(const Leaf_Node& leaf, const TK& key) const
+    {
+      const value_type* const p_first = leaf.values();
+      const value_type*       p_base  = p_first;
+      size_type               n       = leaf.count;
+
+      if (n == 0U)
+      {
+        return 0U;
+      }
+
+      while (n > 1U)
+      {
+        const size_type half = n / 2U;
+        p_base = compare(TKeyOf::get(p_base[half]), key) ? p_base + half : p_base;
+        n -= half;
+      }
+
+      return static_cast<size_type>(p_base - p_first) + (compare(TKeyOf::get(*p_base), key) ? 1U : 0U);
+    }
+
+    //*************************************************************************
+    /// Branchless search for the first value in the leaf greater than the key.
+    //*************************************************************************
+    template <typename TK>
+    size_type leaf_upper_bound(const Leaf_Node& leaf, const TK& key) const
+    {
+      const value_type* const p_first = leaf.values();
+      const value_type*       p_base  = p_first;
+      size_type               n       = leaf.count;
+
+      if (n == 0U)
+      {
+        return 0U;
+      }
+
+      while (n > 1U)
+      {
+        const size_type half = n / 2U;
+        p_base = !compare(key, TKeyOf::get(p_base[half])) ? p_base + half : p_base;
+        n -= half;
+      }
+
+      return static_cast<size_type>(p_base - p_first) + (!compare(key, TKeyOf::get(*p_base)) ? 1U : 0U);
+    }
+
+    //*************************************************************************
+    /// Branchless search for the child of an internal node that may hold the key.
+    /// This is the number of separators not greater than the key.
+    //*************************************************************************
+    template <typename TK>
+    size_type child_for(const Internal_Node& node, const TK& key) const
+    {
+      const key_type* const p_first = node.keys();
+      const key_type*       p_base  = p_first;
+      size_type             n       = node.count - 1U;
+
+      while (n > 1U)
+      {
+        const size_type half = n / 2U;
+        p_base = !compare(key, p_base[half]) ? p_base + half : p_base;
+        n -= half;
+      }
+
+      return static_cast<size_type>(p_base - p_first) + (!compare(key, *p_base) ? 1U : 0U);
+    }
+
+    //*************************************************************************
+    /// Descends to the leaf that may hold the key.
+    //*************************************************************************
+    template <typename TK>
+    Leaf_Node* find_leaf(const TK& key) const
+    {
+      Node* p_node = p_root;
+
+      while (!p_node->is_leaf)
+      {
+        const Internal_Node* p_internal = static_cast<const Internal_Node*>(p_node);
+        p_node = p_internal->children[child_for(*p_internal, key)];
+      }
+
+      return static_cast<Leaf_Node*>(p_node);
+    }
+
+    //*************************************************************************
+    template <typename TK>
+    iterator lower_bound_key(const TK& key)
+    {
+      if (p_root == ETL_NULLPTR)
+      {
+        return end();
+      }
+
+      Leaf_Node* p_leaf = find_leaf(key);
+      size_type  index  = leaf_lower_bound(*p_leaf, key);
+
+      normalise(p_leaf, index);
+
+      return iterator(this, p_leaf, index);
+    }
+
+    //*************************************************************************
+    template <typename TK>
+    iterator upper_bound_key(const TK& key)
+    {
+      if (p_root == ETL_NULLPTR)
+      {
+        return end();
+      }
+
+      Leaf_Node* p_leaf = find_leaf(key);
+      size_type  index  = leaf_upper_bound(*p_leaf, key);
+
+      normalise(p_leaf, index);
+
+      return iterator(this, p_leaf, index);
+    }
+
+    //*************************************************************************
+    template <typename TK>
+    iterator find_key(const TK& key)
+    {
+      Leaf_Node* p_leaf;
+      size_type  index;
+
+      if (locate_insert(key, p_leaf, index))
+      {
+        return iterator(this, p_leaf, index);
+      }
+
+      return end();
+    }
+
+    //*************************************************************************
+    template <typename TK>
+    size_type erase_key(const TK& key)
+    {
+      Leaf_Node* p_leaf;
+      size_type  index;
+
+      if (locate_insert(key, p_leaf, index))
+      {
+        erase_value(p_leaf, index);
+        return 1U;
+      }
+
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// Moves a position past the end of a leaf to the start of the next.
+    //*************************************************************************
+    static void normalise(Leaf_Node*& p_leaf, size_type& index)
+    {
+      if (index == p_leaf->count)
+      {
+        p_leaf = p_leaf->next;
+        index  = 0U;
+      }
+    }
+
+    //*************************************************************************
+    static void increment(Leaf_Node*& p_leaf, size_type& index)
+    {
+      ++index;
+      normalise(p_leaf, index);
+    }
+
+    //*************************************************************************
+    void decrement(Leaf_Node*& p_leaf, size_type& index) const
+    {
+      if (p_leaf == ETL_NULLPTR)
+      {
+        p_leaf = p_last_leaf;
+        index  = p_leaf->count - 1U;
+      }
+      else if (index == 0U)
+      {
+        p_leaf = p_leaf->previous;
+        index  = p_leaf->count - 1U;
+      }
+      else
+      {
+        --index;
+      }
+    }
+
+    //*************************************************************************
+    Leaf_Node* allocate_leaf()
+    {
+      Leaf_Node* p_leaf = p_leaf_pool->template allocate<Leaf_Node>();
+
+      p_leaf->parent   = ETL_NULLPTR;
+      p_leaf->count    = 0U;
+      p_leaf->is_leaf  = true;
+      p_leaf->previous = ETL_NULLPTR;
+      p_leaf->next     = ETL_NULLPTR;
+
+      return p_leaf;
+    }
+
+    //*************************************************************************
+    Internal_Node* allocate_internal()
+    {
+      Internal_Node* p_node = p_internal_pool->template allocate<Internal_Node>();
+
+      p_node->parent  = ETL_NULLPTR;
+      p_node->count   = 0U;
+      p_node->is_leaf = false;
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// Makes room for a value at the position, splitting the leaf if it is full.
+    /// Updates the leaf and index to where the value must be constructed.
+    /// If the leaf was split, p_new_leaf is set to the new right hand leaf,
+    /// which must be passed to complete_split once the value is constructed.
+    //*************************************************************************
+    value_type* make_room(Leaf_Node*& p_leaf, size_type& index, Leaf_Node*& p_new_leaf)
+    {
+      p_new_leaf = ETL_NULLPTR;
+
+      ++current_size;
+
+      if (p_leaf == ETL_NULLPTR)
+      {
+        p_leaf       = allocate_leaf();
+        p_root       = p_leaf;
+        p_first_leaf = p_leaf;
+        p_last_leaf  = p_leaf;
+      }
+
+      if (p_leaf->count < Fanout)
+      {
+        shift_up(p_leaf->values() + index, p_leaf->count - index);
+        ++p_leaf->count;
+
+        return p_leaf->values() + index;
+      }
+
+      // Split the full leaf. With the new value, the left keeps Split values.
+      const size_type Split = (Fanout + 2U) / 2U;
+
+      Leaf_Node* p_right = allocate_leaf();
+
+      const size_type first_moved = (index < Split) ? Split - 1U : Split;
+
+      for (size_type i = first_moved; i < Fanout; ++i)
+      {
+        relocate(p_leaf->values() + i, p_right->values() + (i - first_moved));
+      }
+
+      p_right->count = Fanout - first_moved;
+      p_leaf->count  = first_moved;
+
+      p_right->previous = p_leaf;
+      p_right->next     = p_leaf->next;
+
+      if (p_leaf->next != ETL_NULLPTR)
+      {
+        p_leaf->next->previous = p_right;
+      }
+      else
+      {
+        p_last_leaf = p_right;
+      }
+
+      p_leaf->next = p_right;
+
+      Leaf_Node* p_target = p_leaf;
+
+      if (index >= Split)
+      {
+        p_target = p_right;
+        index   -= Split;
+      }
+
+      shift_up(p_target->values() + index, p_target->count - index);
+      ++p_target->count;
+
+      p_new_leaf = p_right;
+      p_leaf     = p_target;
+
+      return p_target->values() + index;
+    }
+
+    //*************************************************************************
+    /// Adds a new leaf to the parent of the leaf it was split from.
+    /// This is done after the new value is in place, as the first value of
+    /// the new leaf becomes the separator and may be the new value.
+    //*************************************************************************
+    void complete_split(Leaf_Node* p_new_leaf)
+    {
+      if (p_new_leaf != ETL_NULLPTR)
+      {
+        key_type separator(TKeyOf::get(p_new_leaf->values()[0]));
+        insert_into_parent(p_new_leaf->previous, separator, p_new_leaf);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a separator and a new right hand node to the parent of the left node.
+    //*************************************************************************
+    void insert_into_parent(Node* p_left, key_type& key, Node* p_right)
+    {
+      Internal_Node* p_parent = p_left->parent;
+
+      if (p_parent == ETL_NULLPTR)
+      {
+        Internal_Node* p_new_root = allocate_internal();
+
+        ::new (p_new_root->keys()) key_type(ETL_MOVE(key));
+        p_new_root->children[0] = p_left;
+        p_new_root->children[1] = p_right;
+        p_new_root->count       = 2U;
+
+        p_left->parent  = p_new_root;
+        p_right->parent = p_new_root;
+        p_root          = p_new_root;
+
+        return;
+      }
+
+      const size_type index = child_index(*p_parent, p_left);
+
+      if (p_parent->count < Fanout)
+      {
+        shift_up(p_parent->keys() + index, p_parent->count - 1U - index);
+        ::new (p_parent->keys() + index) key_type(ETL_MOVE(key));
+
+        for (size_type i = p_parent->count; i > (index + 1U); --i)
+        {
+          p_parent->children[i] = p_parent->children[i - 1U];
+        }
+
+        p_parent->children[index + 1U] = p_right;
+        ++p_parent->count;
+        p_right->parent = p_parent;
+      }
+      else
+      {
+        split_internal(p_parent, index, key, p_right);
+      }
+    }
+
+    //*************************************************************************
+    /// Splits a full internal node while adding a separator and child after
+    /// the child at 'index'.
+    //*************************************************************************
+    void split_internal(Internal_Node* p_node, size_type index, key_type& key, Node* p_child)
+    {
+      // Gather the Fanout keys and Fanout + 1 children in order.
+      typename etl::aligned_storage<sizeof(key_type) * Fanout_, etl::alignment_of<key_type>::value>::type key_buffer;
+      key_type* keys = reinterpret_cast<key_type*>(&key_buffer);
+      Node* children[Fanout_ + 1U];
+
+      for (size_type i = 0U; i < index; ++i)
+      {
+        relocate(p_node->keys() + i, keys + i);
+      }
+
+      ::new (keys + index) key_type(ETL_MOVE(key));
+
+      for (size_type i = index; i < (Fanout - 1U); ++i)
+      {
+        relocate(p_node->keys() + i, keys + i + 1U);
+      }
+
+      for (size_type i = 0U; i <= index; ++i)
+      {
+        children[i] = p_node->children[i];
+      }
+
+      children[index + 1U] = p_child;
+
+      for (size_type i = index + 1U; i < Fanout; ++i)
+      {
+        children[i + 1U] = p_node->children[i];
+      }
+
+      // Distribute them between this node and a new right hand node.
+      const size_type left_count  = (Fanout + 2U) / 2U;
+      const size_type right_count = (Fanout + 1U) - left_count;
+
+      Internal_Node* p_right = allocate_internal();
+
+      for (size_type i = 0U; i < (left_count - 1U); ++i)
+      {
+        relocate(keys + i, p_node->keys() + i);
+      }
+
+      for (size_type i = 0U; i < left_count; ++i)
+      {
+        p_node->children[i] = children[i];
+        children[i]->parent = p_node;
+      }
+
+      p_node->count = left_count;
+
+      key_type promoted(ETL_MOVE(keys[left_count - 1U]));
+      keys[left_count - 1U].~key_type();
+
+      for (size_type i = 0U; i < (right_count - 1U); ++i)
+      {
+        relocate(keys + left_count + i, p_right->keys() + i);
+      }
+
+      for (size_type i = 0U; i < right_count; ++i)
+      {
+        p_right->children[i] = children[left_count + i];
+        children[left_count + i]->parent = p_right;
+      }
+
+      p_right->count = right_count;
+
+      insert_into_parent(p_node, promoted, p_right);
+    }
+
+    //*************************************************************************
+    /// Finds the position of a child in its parent.
+    //*************************************************************************
+    static size_type child_index(const Internal_Node& parent, const Node* p_child)
+    {
+      size_type index = 0U;
+
+      while (parent.children[index] != p_child)
+      {
+        ++index;
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Removes the separator at 'key_index' and the child to its right.
+    //*************************************************************************
+    static void remove_separator(Internal_Node* p_node, size_type key_index)
+    {
+      p_node->keys()[key_index].~key_type();
+      shift_down(p_node->keys() + key_index + 1U, p_node->count - 2U - key_index);
+
+      for (size_type i = key_index + 1U; i < (p_node->count - 1U); ++i)
+      {
+        p_node->children[i] = p_node->children[i + 1U];
+      }
+
+      --p_node->count;
+    }
+
+    //*************************************************************************
+    /// Erases a value and rebalances the tree.
+    //*************************************************************************
+    void erase_value(Leaf_Node* p_leaf, size_type index)
+    {
+      p_leaf->values()[index].~value_type();
+      shift_down(p_leaf->values() + index + 1U, p_leaf->count - 1U - index);
+      --p_leaf->count;
+      --current_size;
+
+      if (p_leaf->parent == ETL_NULLPTR)
+      {
+        if (p_leaf->count == 0U)
+        {
+          p_leaf_pool->release(p_leaf);
+          p_root       = ETL_NULLPTR;
+          p_first_leaf = ETL_NULLPTR;
+          p_last_leaf  = ETL_NULLPTR;
+        }
+      }
+      else if (p_leaf->count < Min_Values)
+      {
+        rebalance_leaf(p_leaf);
+      }
+    }
+
+    //*************************************************************************
+    /// Refills a leaf that has fallen below the minimum from a sibling, or
+    /// merges it with one.
+    //*************************************************************************
+    void rebalance_leaf(Leaf_Node* p_leaf)
+    {
+      Internal_Node*  p_parent = p_leaf->parent;
+      const size_type index    = child_index(*p_parent, p_leaf);
+
+      Leaf_Node* p_left  = (index > 0U)                      ? static_cast<Leaf_Node*>(p_parent->children[index - 1U]) : ETL_NULLPTR;
+      Leaf_Node* p_right = ((index + 1U) < p_parent->count) ? static_cast<Leaf_Node*>(p_parent->children[index + 1U]) : ETL_NULLPTR;
+
+      if ((p_left != ETL_NULLPTR) && (p_left->count > Min_Values))
+      {
+        // Borrow the last value of the left sibling.
+        shift_up(p_leaf->values(), p_leaf->count);
+        relocate(p_left->values() + p_left->count - 1U, p_leaf->values());
+        --p_left->count;
+        ++p_leaf->count;
+
+        p_parent->keys()[index - 1U] = TKeyOf::get(p_leaf->values()[0]);
+      }
+      else if ((p_right != ETL_NULLPTR) && (p_right->count > Min_Values))
+      {
+        // Borrow the first value of the right sibling.
+        relocate(p_right->values(), p_leaf->values() + p_leaf->count);
+        shift_down(p_right->values() + 1U, p_right->count - 1U);
+        --p_right->count;
+        ++p_leaf->count;
+
+        p_parent->keys()[index] = TKeyOf::get(p_right->values()[0]);
+      }
+      else if (p_left != ETL_NULLPTR)
+      {
+        merge_leaves(p_left, p_leaf);
+        remove_separator(p_parent, index - 1U);
+        rebalance_internal(p_parent);
+      }
+      else
+      {
+        merge_leaves(p_leaf, p_right);
+        remove_separator(p_parent, index);
+        rebalance_internal(p_parent);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves all of the values of the right leaf to the left and releases it.
+    //*************************************************************************
+    void merge_leaves(Leaf_Node* p_left, Leaf_Node* p_right)
+    {
+      for (size_type i = 0U; i < p_right->count; ++i)
+      {
+        relocate(p_right->values() + i, p_left->values() + p_left->count + i);
+      }
+
+      p_left->count += p_right->count;
+      p_left->next   = p_right->next;
+
+      if (p_right->next != ETL_NULLPTR)
+      {
+        p_right->next->previous = p_left;
+      }
+      else
+      {
+        p_last_leaf = p_left;
+      }
+
+      p_leaf_pool->release(p_right);
+    }
+
+    //*************************************************************************
+    /// Refills an internal node that has fallen below the minimum from a
+    /// sibling, or merges it with one.
+    //*************************************************************************
+    void rebalance_internal(Internal_Node* p_node)
+    {
+      if (p_node->parent == ETL_NULLPTR)
+      {
+        // A root with one child is removed.
+        if (p_node->count == 1U)
+        {
+          p_root = p_node->children[0];
+          p_root->parent = ETL_NULLPTR;
+          p_internal_pool->release(p_node);
+        }
+
+        return;
+      }
+
+      if (p_node->count >= Min_Children)
+      {
+        return;
+      }
+
+      Internal_Node*  p_parent = p_node->parent;
+      const size_type index    = child_index(*p_parent, p_node);
+
+      Internal_Node* p_left  = (index > 0U)                      ? static_cast<Internal_Node*>(p_parent->children[index - 1U]) : ETL_NULLPTR;
+      Internal_Node* p_right = ((index + 1U) < p_parent->count) ? static_cast<Internal_Node*>(p_parent->children[index + 1U]) : ETL_NULLPTR;
+
+      if ((p_left != ETL_NULLPTR) && (p_left->count > Min_Children))
+      {
+        // Rotate the last child of the left sibling through the parent.
+        shift_up(p_node->keys(), p_node->count - 1U);
+
+        for (size_type i = p_node->count; i > 0U; --i)
+        {
+          p_node->children[i] = p_node->children[i - 1U];
+        }
+
+        ::new (p_node->keys()) key_type(ETL_MOVE(p_parent->keys()[index - 1U]));
+        p_node->children[0] = p_left->children[p_left->count - 1U];
+        p_node->children[0]->parent = p_node;
+        ++p_node->count;
+
+        key_type* p_last_key = p_left->keys() + p_left->count - 2U;
+        p_parent->keys()[index - 1U] = ETL_MOVE(*p_last_key);
+        p_last_key->~key_type();
+        --p_left->count;
+      }
+      else if ((p_right != ETL_NULLPTR) && (p_right->count > Min_Children))
+      {
+        // Rotate the first child of the right sibling through the parent.
+        ::new (p_node->keys() + p_node->count - 1U) key_type(ETL_MOVE(p_parent->keys()[index]));
+        p_node->children[p_node->count] = p_right->children[0];
+        p_node->children[p_node->count]->parent = p_node;
+        ++p_node->count;
+
+        p_parent->keys()[index] = ETL_MOVE(p_right->keys()[0]);
+        p_right->keys()[0].~key_type();
+        shift_down(p_right->keys() + 1U, p_right->count - 2U);
+
+        for (size_type i = 0U; i < (p_right->count - 1U); ++i)
+        {
+          p_right->children[i] = p_right->children[i + 1U];
+        }
+
+        --p_right->count;
+      }
+      else if (p_left != ETL_NULLPTR)
+      {
+        merge_internal(p_left, p_node, p_parent, index - 1U);
+      }
+      else
+      {
+        merge_internal(p_node, p_right, p_parent, index);
+      }
+    }
+
+    //*************************************************************************
+    /// Merges the right internal node and the separator between them into the
+    /// left, then rebalances the parent.
+    //*************************************************************************
+    void merge_internal(Internal_Node* p_left, Internal_Node* p_right, Internal_Node* p_parent, size_type key_index)
+    {
+      ::new (p_left->keys() + p_left->count - 1U) key_type(ETL_MOVE(p_parent->keys()[key_index]));
+
+      for (size_type i = 0U; i < (p_right->count - 1U); ++i)
+      {
+        relocate(p_right->keys() + i, p_left->keys() + p_left->count + i);
+      }
+
+      for (size_type i = 0U; i < p_right->count; ++i)
+      {
+        p_left->children[p_left->count + i] = p_right->children[i];
+        p_right->children[i]->parent = p_left;
+      }
+
+      p_left->count += p_right->count;
+      p_internal_pool->release(p_right);
+
+      remove_separator(p_parent, key_index);
+      rebalance_internal(p_parent);
+    }
+
+    //*************************************************************************
+    /// Destroys a sub-tree and returns its nodes to the pools.
+    //*************************************************************************
+    void destroy(Node* p_node)
+    {
+      if (p_node->is_leaf)
+      {
+        Leaf_Node* p_leaf = static_cast<Leaf_Node*>(p_node);
+        etl::destroy(p_leaf->values(), p_leaf->values() + p_leaf->count);
+        p_leaf_pool->release(p_leaf);
+      }
+      else
+      {
+        Internal_Node* p_internal = static_cast<Internal_Node*>(p_node);
+
+        for (size_type i = 0U; i < p_internal->count; ++i)
+        {
+          destroy(p_internal->children[i]);
+        }
+
+        etl::destroy(p_internal->keys(), p_internal->keys() + p_internal->count - 1U);
+        p_internal_pool->release(p_internal);
+      }
+    }
+
+    // Disable copy construction.
+    btree_base(const btree_base&) ETL_DELETE;
+
+    etl::ipool* p_leaf_pool;     ///< The pool of leaf nodes.
+    etl::ipool* p_internal_pool; ///< The pool of internal nodes.
+    Node*       p_root;          ///< The root, or null if empty.
+    Leaf_Node*  p_first_leaf;    ///< The leftmost leaf.
+    Leaf_Node*  p_last_leaf;     ///< The rightmost leaf.
+    size_type   current_size;    ///< The number of values.
+    const size_type CAPACITY;    ///< The maximum number of values.
+
+  protected:
+
+    key_compare compare;
+  };
+}
+
+#endif
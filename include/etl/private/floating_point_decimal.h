@@ -0,0 +1,1551 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLOATING_POINT_DECIMAL_INCLUDED
+#define ETL_FLOATING_POINT_DECIMAL_INCLUDED
+
+///\ingroup private
+
+#include "../platform.h"
+#include "../bit.h"
+#include "../type_traits.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+//*****************************************************************************
+// Exact conversion of IEEE-754 binary floating point values to decimal text,
+// without using the floating point library.
+//
+// Shortest round trip digits are found with the Ryu algorithm (Ulf Adams,
+// 'Ryu: fast float-to-string conversion', PLDI 2018), using the compact
+// 128 bit power of five tables.
+// Fixed precision digits are generated exactly from the binary value with
+// a small fixed capacity big integer, and are rounded half to even.
+// long double values are converted through double.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_floating_point_decimal
+  {
+    //*************************************************************************
+    /// A decimal value, significand * 10^exponent.
+    //*************************************************************************
+    struct decimal_t
+    {
+      uint64_t significand;
+      int      exponent;
+    };
+
+    //*************************************************************************
+    /// The IEEE-754 layout of the supported types.
+    //*************************************************************************
+    template <typename T>
+    struct ieee_traits;
+
+    template <>
+    struct ieee_traits<float>
+    {
+      typedef uint32_t bits_type;
+
+      static ETL_CONSTANT int    Mantissa_Bits = 23;
+      static ETL_CONSTANT int    Exponent_Bits = 8;
+      static ETL_CONSTANT int    Bias          = 127;
+      static ETL_CONSTANT size_t Bignum_Limbs  = 7U;
+    };
+
+    template <>
+    struct ieee_traits<double>
+    {
+      typedef uint64_t bits_type;
+
+      static ETL_CONSTANT int    Mantissa_Bits = 52;
+      static ETL_CONSTANT int    Exponent_Bits = 11;
+      static ETL_CONSTANT int    Bias          = 1023;
+      static ETL_CONSTANT size_t Bignum_Limbs  = 36U;
+    };
+
+    //*************************************************************************
+    /// The type used to convert a floating point type.
+    //*************************************************************************
+    template <typename T>
+    struct working_type
+    {
+      typedef double type;
+    };
+
+    template <>
+    struct working_type<float>
+    {
+      typedef float type;
+    };
+
+    //*************************************************************************
+    /// The raw fields of an IEEE-754 value.
+    //*************************************************************************
+    struct ieee_fields_t
+    {
+      uint64_t mantissa;
+      uint32_t exponent;
+      bool     negative;
+    };
+
+    template <typename T>
+    ieee_fields_t get_fields(T value)
+    {
+      typedef ieee_traits<T>                traits;
+      typedef typename traits::bits_type bits_type;
+
+      const bits_type bits = etl::bit_cast<bits_type>(value);
+
+      ieee_fields_t fields;
+      fields.mantissa = static_cast<uint64_t>(bits & ((bits_type(1U) << traits::Mantissa_Bits) - 1U));
+      fields.exponent = static_cast<uint32_t>((bits >> traits::Mantissa_Bits) & ((bits_type(1U) << traits::Exponent_Bits) - 1U));
+      fields.negative = ((bits >> (traits::Mantissa_Bits + traits::Exponent_Bits)) != 0U);
+
+      return fields;
+    }
+
+    //*************************************************************************
+    /// Returns true if the sign bit is set.
+    //*************************************************************************
+    template <typename T>
+    bool is_negative(T value)
+    {
+      return get_fields(value).negative;
+    }
+
+    //*************************************************************************
+    /// Returns true if the value is positive or negative zero.
+    //*************************************************************************
+    template <typename T>
+    bool is_zero(T value)
+    {
+      const ieee_fields_t fields = get_fields(value);
+
+      return (fields.exponent == 0U) && (fields.mantissa == 0U);
+    }
+
+    //*************************************************************************
+    /// Returns true if the value is not an infinity or a NaN.
+    //*************************************************************************
+    template <typename T>
+    bool is_finite(T value)
+    {
+      return get_fields(value).exponent != ((1U << ieee_traits<T>::Exponent_Bits) - 1U);
+    }
+
+    //*************************************************************************
+    /// Returns true if the value is a NaN.
+    //*************************************************************************
+    template <typename T>
+    bool is_nan(T value)
+    {
+      const ieee_fields_t fields = get_fields(value);
+
+      return (fields.exponent == ((1U << ieee_traits<T>::Exponent_Bits) - 1U)) && (fields.mantissa != 0U);
+    }
+
+    //*************************************************************************
+    /// Ryu power of five tables.
+    /// The full 128 bit multipliers are rebuilt from every 26th entry.
+    //*************************************************************************
+    template <typename T = void>
+    struct ryu_tables
+    {
+      static const uint64_t pow5_split[13][2];
+      static const uint64_t pow5_inv_split[15][2];
+      static const uint32_t pow5_offsets[21];
+      static const uint32_t pow5_inv_offsets[22];
+      static const uint64_t pow5[26];
+    };
+
+    template <typename T>
+    const uint64_t ryu_tables<T>::pow5_split[13][2] =
+    {
+      { 0x0000000000000000ULL, 0x1000000000000000ULL },
+      { 0x0000000000000000ULL, 0x14ADF4B7320334B9ULL },
+      { 0x0E549208B31ADB10ULL, 0x1ABA4714957D300DULL },
+      { 0x6DC6AD264D8F0866ULL, 0x1145B7E285BF98F5ULL },
+      { 0xEB1DBD923D8596CAULL, 0x1652EFDC6018A1FCULL },
+      { 0xB4C1B80B22AE923CULL, 0x1CDA62055B2D9D83ULL },
+      { 0x5BB28B4E8F7E4C30ULL, 0x12A5568B9F52F416ULL },
+      { 0xF08AED437682D4FBULL, 0x1819651531F9E78FULL },
+      { 0xB4EE134AD99BF150ULL, 0x1F25C186A6F04C28ULL },
+      { 0x16499ECB70C25F03ULL, 0x1420EB449C8842E6ULL },
+      { 0x85A56EAD360865B0ULL, 0x1A03FDE214CAF085ULL },
+      { 0x093DB1D57999890BULL, 0x10CFEB353A97DAD8ULL },
+      { 0xCF38BB735E3F36ACULL, 0x15BAAF44FA52673EULL }
+    };
+
+    template <typename T>
+    const uint64_t ryu_tables<T>::pow5_inv_split[15][2] =
+    {
+      { 0x0000000000000001ULL, 0x2000000000000000ULL },
+      { 0x52A6C95FC0655034ULL, 0x18C240C4AECB13BBULL },
+      { 0x7CA8D50071DFC806ULL, 0x1327FC58DA0F6FF5ULL },
+      { 0x6520247D3556476EULL, 0x1DA48CE468E7C702ULL },
+      { 0x6139CDD76802E6E9ULL, 0x16EF5B40C2FC7779ULL },
+      { 0xF951A7FF43DE8C79ULL, 0x11BEBDF578B2F391ULL },
+      { 0x7BE8BEE8D6E957E8ULL, 0x1B758D848FAC54B0ULL },
+      { 0x8BD3F9E999A423EAULL, 0x153EDA614071A3B7ULL },
+      { 0x0848F973CB3EE3CEULL, 0x10701BD527B4978CULL },
+      { 0x153285EBB9EFBFA2ULL, 0x196FBB9BB44DB44DULL },
+      { 0xADEEE7F86C07B696ULL, 0x13AE3591F5B4D936ULL },
+      { 0x4D686A4EAF182222ULL, 0x1E74404F3DAADA91ULL },
+      { 0x98C0A106E09EBD9FULL, 0x17900EA4FDA7C257ULL },
+      { 0x8F20E37371497D0EULL, 0x123B140576D820B2ULL },
+      { 0xB043138134743D85ULL, 0x1C35F4275F7A29ADULL }
+    };
+
+    template <typename T>
+    const uint32_t ryu_tables<T>::pow5_offsets[21] =
+    {
+      0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+      0x40000000UL, 0x59695995UL, 0x55545555UL, 0x56555515UL,
+      0x41150504UL, 0x40555410UL, 0x44555145UL, 0x44504540UL,
+      0x45555550UL, 0x40004000UL, 0x96440440UL, 0x55565565UL,
+      0x54454045UL, 0x40154151UL, 0x55559155UL, 0x51405555UL,
+      0x00000105UL
+    };
+
+    template <typename T>
+    const uint32_t ryu_tables<T>::pow5_inv_offsets[22] =
+    {
+      0x54544554UL, 0x04055545UL, 0x10041000UL, 0x00400414UL,
+      0x40010000UL, 0x41155555UL, 0x00000454UL, 0x00010044UL,
+      0x40000000UL, 0x44000041UL, 0x50454450UL, 0x55550054UL,
+      0x51655554UL, 0x40004000UL, 0x01000001UL, 0x00010500UL,
+      0x51515411UL, 0x05555554UL, 0x50411500UL, 0x40040000UL,
+      0x05040110UL, 0x00000000UL
+    };
+
+    template <typename T>
+    const uint64_t ryu_tables<T>::pow5[26] =
+    {
+      1ULL, 5ULL, 25ULL, 125ULL,
+      625ULL, 3125ULL, 15625ULL, 78125ULL,
+      390625ULL, 1953125ULL, 9765625ULL, 48828125ULL,
+      244140625ULL, 1220703125ULL, 6103515625ULL, 30517578125ULL,
+      152587890625ULL, 762939453125ULL, 3814697265625ULL, 19073486328125ULL,
+      95367431640625ULL, 476837158203125ULL, 2384185791015625ULL, 11920928955078125ULL,
+      59604644775390625ULL, 298023223876953125ULL
+    };
+
+    //*************************************************************************
+    /// Ryu helper functions.
+    //*************************************************************************
+    namespace ryu
+    {
+      // The number of bits in 5^e, for 0 <= e <= 3528.
+      inline int pow5_bits(int e)
+      {
+        return static_cast<int>((static_cast<uint32_t>(e) * 1217359U) >> 19) + 1;
+      }
+
+      // floor(log10(2^e)), for 0 <= e <= 1650.
+      inline uint32_t log10_pow2(int e)
+      {
+        return (static_cast<uint32_t>(e) * 78913U) >> 18;
+      }
+
+      // floor(log10(5^e)), for 0 <= e <= 2620.
+      inline uint32_t log10_pow5(int e)
+      {
+        return (static_cast<uint32_t>(e) * 732923U) >> 20;
+      }
+
+      inline uint32_t pow5_factor(uint64_t value)
+      {
+        uint32_t count = 0U;
+
+        while ((value % 5U) == 0U)
+        {
+          value /= 5U;
+          ++count;
+        }
+
+        return count;
+      }
+
+      inline bool is_multiple_of_pow5(uint64_t value, uint32_t p)
+      {
+        return pow5_factor(value) >= p;
+      }
+
+      inline bool is_multiple_of_pow2(uint64_t value, uint32_t p)
+      {
+        return (value & ((uint64_t(1U) << p) - 1U)) == 0U;
+      }
+
+      // The 128 bit product of a and b.
+      inline uint64_t multiply_128(uint64_t a, uint64_t b, uint64_t& high)
+      {
+        const uint64_t a_low  = static_cast<uint32_t>(a);
+        const uint64_t a_high = a >> 32;
+        const uint64_t b_low  = static_cast<uint32_t>(b);
+        const uint64_t b_high = b >> 32;
+
+        const uint64_t b00 = a_low  * b_low;
+        const uint64_t b01 = a_low  * b_high;
+        const uint64_t b10 = a_high * b_low;
+        const uint64_t b11 = a_high * b_high;
+
+        const uint64_t mid1 = b10 + (b00 >> 32);
+        const uint64_t mid2 = b01 + static_cast<uint32_t>(mid1);
+
+        high = b11 + (mid1 >> 32) + (mid2 >> 32);
+
+        return (mid2 << 32) | static_cast<uint32_t>(b00);
+      }
+
+      // The low 64 bits of the 128 bit value shifted right, for 0 < distance < 64.
+      inline uint64_t shift_right_128(uint64_t low, uint64_t high, int distance)
+      {
+        return (high << (64 - distance)) | (low >> distance);
+      }
+
+      // 5^i as a 125 bit value.
+      inline void compute_pow5(int i, uint64_t (&result)[2])
+      {
+        typedef ryu_tables<> tables;
+
+        const int base   = i / 26;
+        const int base2  = base * 26;
+        const int offset = i - base2;
+
+        const uint64_t* mul = tables::pow5_split[base];
+
+        if (offset == 0)
+        {
+          result[0] = mul[0];
+          result[1] = mul[1];
+        }
+        else
+        {
+          const uint64_t m = tables::pow5[offset];
+
+          uint64_t high1;
+          const uint64_t low1 = multiply_128(m, mul[1], high1);
+          uint64_t high0;
+          const uint64_t low0 = multiply_128(m, mul[0], high0);
+
+          const uint64_t sum = high0 + low1;
+
+          if (sum < high0)
+          {
+            ++high1;
+          }
+
+          const int      delta      = pow5_bits(i) - pow5_bits(base2);
+          const uint64_t correction = (tables::pow5_offsets[i / 16] >> ((i % 16) << 1)) & 3U;
+
+          result[0] = shift_right_128(low0, sum, delta) + correction;
+          result[1] = shift_right_128(sum, high1, delta) + ((result[0] < correction) ? 1U : 0U);
+        }
+      }
+
+      // 2^k / 5^i as a 125 bit value, rounded up.
+      inline void compute_inv_pow5(int i, uint64_t (&result)[2])
+      {
+        typedef ryu_tables<> tables;
+
+        const int base   = (i + 25) / 26;
+        const int base2  = base * 26;
+        const int offset = base2 - i;
+
+        const uint64_t* mul = tables::pow5_inv_split[base];
+
+        if (offset == 0)
+        {
+          result[0] = mul[0];
+          result[1] = mul[1];
+        }
+        else
+        {
+          const uint64_t m = tables::pow5[offset];
+
+          uint64_t high1;
+          const uint64_t low1 = multiply_128(m, mul[1], high1);
+          uint64_t high0;
+          const uint64_t low0 = multiply_128(m, mul[0] - 1U, high0);
+
+          const uint64_t sum = high0 + low1;
+
+          if (sum < high0)
+          {
+            ++high1;
+          }
+
+          const int      delta      = pow5_bits(base2) - pow5_bits(i);
+          const uint64_t correction = ((tables::pow5_inv_offsets[i / 16] >> ((i % 16) << 1)) & 3U) + 1U;
+
+          result[0] = shift_right_128(low0, sum, delta) + correction;
+          result[1] = shift_right_128(sum, high1, delta) + ((result[0] < correction) ? 1U : 0U);
+        }
+      }
+
+      // (m * mul) >> j, for 64 < j < 128.
+      inline uint64_t multiply_shift_64(uint64_t m, const uint64_t (&mul)[2], int j)
+      {
+        uint64_t high1;
+        const uint64_t low1 = multiply_128(m, mul[1], high1);
+        uint64_t high0;
+        multiply_128(m, mul[0], high0);
+
+        const uint64_t sum = high0 + low1;
+
+        if (sum < high0)
+        {
+          ++high1;
+        }
+
+        return shift_right_128(sum, high1, j - 64);
+      }
+
+      // (m * factor) >> shift, for 32 < shift.
+      inline uint32_t multiply_shift_32(uint32_t m, uint64_t factor, int shift)
+      {
+        const uint64_t bits0 = uint64_t(m) * static_cast<uint32_t>(factor);
+        const uint64_t bits1 = uint64_t(m) * static_cast<uint32_t>(factor >> 32);
+
+        return static_cast<uint32_t>(((bits0 >> 32) + bits1) >> (shift - 32));
+      }
+
+      inline uint32_t multiply_pow5_inv_div_pow2(uint32_t m, uint32_t q, int j)
+      {
+        uint64_t pow5[2];
+        compute_inv_pow5(static_cast<int>(q), pow5);
+
+        return multiply_shift_32(m, pow5[1] + 1U, j);
+      }
+
+      inline uint32_t multiply_pow5_div_pow2(uint32_t m, uint32_t i, int j)
+      {
+        uint64_t pow5[2];
+        compute_pow5(static_cast<int>(i), pow5);
+
+        return multiply_shift_32(m, pow5[1], j);
+      }
+    }
+
+    //*************************************************************************
+    /// The shortest decimal that rounds to the finite, non-zero double.
+    //*************************************************************************
+    inline decimal_t shortest_decimal(double value)
+    {
+      static ETL_CONSTANT int Mantissa_Bits   = ieee_traits<double>::Mantissa_Bits;
+      static ETL_CONSTANT int Bias            = ieee_traits<double>::Bias;
+      static ETL_CONSTANT int Pow5_Inv_Bits   = 125;
+      static ETL_CONSTANT int Pow5_Bits       = 125;
+
+      const ieee_fields_t fields = get_fields(value);
+
+      int      e2;
+      uint64_t m2;
+
+      if (fields.exponent == 0U)
+      {
+        e2 = 1 - Bias - Mantissa_Bits - 2;
+        m2 = fields.mantissa;
+      }
+      else
+      {
+        e2 = static_cast<int>(fields.exponent) - Bias - Mantissa_Bits - 2;
+        m2 = (uint64_t(1U) << Mantissa_Bits) | fields.mantissa;
+      }
+
+      const bool accept_bounds = ((m2 & 1U) == 0U);
+
+      // The interval of valid decimal representations.
+      const uint64_t mv       = 4U * m2;
+      const uint32_t mm_shift = ((fields.mantissa != 0U) || (fields.exponent <= 1U)) ? 1U : 0U;
+
+      // Convert to a decimal power base.
+      uint64_t vr;
+      uint64_t vp;
+      uint64_t vm;
+      int      e10;
+      bool     vm_is_trailing_zeros = false;
+      bool     vr_is_trailing_zeros = false;
+
+      if (e2 >= 0)
+      {
+        const uint32_t q = ryu::log10_pow2(e2) - ((e2 > 3) ? 1U : 0U);
+        e10 = static_cast<int>(q);
+        const int k = Pow5_Inv_Bits + ryu::pow5_bits(static_cast<int>(q)) - 1;
+        const int i = -e2 + static_cast<int>(q) + k;
+
+        uint64_t pow5[2];
+        ryu::compute_inv_pow5(static_cast<int>(q), pow5);
+
+        vr = ryu::multiply_shift_64(4U * m2, pow5, i);
+        vp = ryu::multiply_shift_64(4U * m2 + 2U, pow5, i);
+        vm = ryu::multiply_shift_64(4U * m2 - 1U - mm_shift, pow5, i);
+
+        if (q <= 21U)
+        {
+          // Only one of mp, mv and mm can be a multiple of 5, if any.
+          if ((mv % 5U) == 0U)
+          {
+            vr_is_trailing_zeros = ryu::is_multiple_of_pow5(mv, q);
+          }
+          else if (accept_bounds)
+          {
+            vm_is_trailing_zeros = ryu::is_multiple_of_pow5(mv - 1U - mm_shift, q);
+          }
+          else
+          {
+            vp -= ryu::is_multiple_of_pow5(mv + 2U, q) ? 1U : 0U;
+          }
+        }
+      }
+      else
+      {
+        const uint32_t q = ryu::log10_pow5(-e2) - ((-e2 > 1) ? 1U : 0U);
+        e10 = static_cast<int>(q) + e2;
+        const int i = -e2 - static_cast<int>(q);
+        const int k = ryu::pow5_bits(i) - Pow5_Bits;
+        const int j = static_cast<int>(q) - k;
+
+        uint64_t pow5[2];
+        ryu::compute_pow5(i, pow5);
+
+        vr = ryu::multiply_shift_64(4U * m2, pow5, j);
+        vp = ryu::multiply_shift_64(4U * m2 + 2U, pow5, j);
+        vm = ryu::multiply_shift_64(4U * m2 - 1U - mm_shift, pow5, j);
+
+        if (q <= 1U)
+        {
+          // mv = 4 * m2, so it always has at least two trailing zero bits.
+          vr_is_trailing_zeros = true;
+
+          if (accept_bounds)
+          {
+            // mm = mv - 1 - mm_shift, so it has one trailing zero bit if mm_shift == 1.
+            vm_is_trailing_zeros = (mm_shift == 1U);
+          }
+          else
+          {
+            // mp = mv + 2, so it always has at least one trailing zero bit.
+            --vp;
+          }
+        }
+        else if (q < 63U)
+        {
+          vr_is_trailing_zeros = ryu::is_multiple_of_pow2(mv, q);
+        }
+      }
+
+      // Find the shortest decimal representation in the interval.
+      int      removed             = 0;
+      uint32_t last_removed_digit  = 0U;
+      uint64_t output;
+
+      if (vm_is_trailing_zeros || vr_is_trailing_zeros)
+      {
+        // The general case, which is rare.
+        while ((vp / 10U) > (vm / 10U))
+        {
+          vm_is_trailing_zeros &= ((vm % 10U) == 0U);
+          vr_is_trailing_zeros &= (last_removed_digit == 0U);
+          last_removed_digit = static_cast<uint32_t>(vr % 10U);
+          vr /= 10U;
+          vp /= 10U;
+          vm /= 10U;
+          ++removed;
+        }
+
+        if (vm_is_trailing_zeros)
+        {
+          while ((vm % 10U) == 0U)
+          {
+            vr_is_trailing_zeros &= (last_removed_digit == 0U);
+            last_removed_digit = static_cast<uint32_t>(vr % 10U);
+            vr /= 10U;
+            vp /= 10U;
+            vm /= 10U;
+            ++removed;
+          }
+        }
+
+        if (vr_is_trailing_zeros && (last_removed_digit == 5U) && ((vr % 2U) == 0U))
+        {
+          // Round to even if the exact value is .....50..0.
+          last_removed_digit = 4U;
+        }
+
+        // Take vr + 1 if vr is outside the bounds, or rounding is needed.
+        output = vr + ((((vr == vm) && (!accept_bounds || !vm_is_trailing_zeros)) || (last_removed_digit >= 5U)) ? 1U : 0U);
+      }
+      else
+      {
+        // The common case.
+        bool round_up = false;
+
+        if ((vp / 100U) > (vm / 100U))
+        {
+          // Remove two digits at a time.
+          round_up = ((vr % 100U) >= 50U);
+          vr /= 100U;
+          vp /= 100U;
+          vm /= 100U;
+          removed += 2;
+        }
+
+        while ((vp / 10U) > (vm / 10U))
+        {
+          round_up = ((vr % 10U) >= 5U);
+          vr /= 10U;
+          vp /= 10U;
+          vm /= 10U;
+          ++removed;
+        }
+
+        // Take vr + 1 if vr is outside the bounds, or rounding is needed.
+        output = vr + (((vr == vm) || round_up) ? 1U : 0U);
+      }
+
+      decimal_t result;
+      result.significand = output;
+      result.exponent    = e10 + removed;
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The shortest decimal that rounds to the finite, non-zero float.
+    //*************************************************************************
+    inline decimal_t shortest_decimal(float value)
+    {
+      static ETL_CONSTANT int Mantissa_Bits   = ieee_traits<float>::Mantissa_Bits;
+      static ETL_CONSTANT int Bias            = ieee_traits<float>::Bias;
+      static ETL_CONSTANT int Pow5_Inv_Bits   = 125 - 64;
+      static ETL_CONSTANT int Pow5_Bits       = 125 - 64;
+
+      const ieee_fields_t fields = get_fields(value);
+
+      int      e2;
+      uint32_t m2;
+
+      if (fields.exponent == 0U)
+      {
+        e2 = 1 - Bias - Mantissa_Bits - 2;
+        m2 = static_cast<uint32_t>(fields.mantissa);
+      }
+      else
+      {
+        e2 = static_cast<int>(fields.exponent) - Bias - Mantissa_Bits - 2;
+        m2 = (uint32_t(1U) << Mantissa_Bits) | static_cast<uint32_t>(fields.mantissa);
+      }
+
+      const bool accept_bounds = ((m2 & 1U) == 0U);
+
+      // The interval of valid decimal representations.
+      const uint32_t mv       = 4U * m2;
+      const uint32_t mp       = 4U * m2 + 2U;
+      const uint32_t mm_shift = ((fields.mantissa != 0U) || (fields.exponent <= 1U)) ? 1U : 0U;
+      const uint32_t mm       = 4U * m2 - 1U - mm_shift;
+
+      // Convert to a decimal power base.
+      uint32_t vr;
+      uint32_t vp;
+      uint32_t vm;
+      int      e10;
+      bool     vm_is_trailing_zeros = false;
+      bool     vr_is_trailing_zeros = false;
+      uint32_t last_removed_digit   = 0U;
+
+      if (e2 >= 0)
+      {
+        const uint32_t q = ryu::log10_pow2(e2);
+        e10 = static_cast<int>(q);
+        const int k = Pow5_Inv_Bits + ryu::pow5_bits(static_cast<int>(q)) - 1;
+        const int i = -e2 + static_cast<int>(q) + k;
+
+        vr = ryu::multiply_pow5_inv_div_pow2(mv, q, i);
+        vp = ryu::multiply_pow5_inv_div_pow2(mp, q, i);
+        vm = ryu::multiply_pow5_inv_div_pow2(mm, q, i);
+
+        if ((q != 0U) && (((vp - 1U) / 10U) <= (vm / 10U)))
+        {
+          // One removed digit is needed, even if the loop below is not entered.
+          const int l = Pow5_Inv_Bits + ryu::pow5_bits(static_cast<int>(q - 1U)) - 1;
+          last_removed_digit = ryu::multiply_pow5_inv_div_pow2(mv, q - 1U, -e2 + static_cast<int>(q) - 1 + l) % 10U;
+        }
+
+        if (q <= 9U)
+        {
+          // Only one of mp, mv and mm can be a multiple of 5, if any.
+          if ((mv % 5U) == 0U)
+          {
+            vr_is_trailing_zeros = ryu::is_multiple_of_pow5(mv, q);
+          }
+          else if (accept_bounds)
+          {
+            vm_is_trailing_zeros = ryu::is_multiple_of_pow5(mm, q);
+          }
+          else
+          {
+            vp -= ryu::is_multiple_of_pow5(mp, q) ? 1U : 0U;
+          }
+        }
+      }
+      else
+      {
+        const uint32_t q = ryu::log10_pow5(-e2);
+        e10 = static_cast<int>(q) + e2;
+        const int i = -e2 - static_cast<int>(q);
+        const int k = ryu::pow5_bits(i) - Pow5_Bits;
+        int       j = static_cast<int>(q) - k;
+
+        vr = ryu::multiply_pow5_div_pow2(mv, static_cast<uint32_t>(i), j);
+        vp = ryu::multiply_pow5_div_pow2(mp, static_cast<uint32_t>(i), j);
+        vm = ryu::multiply_pow5_div_pow2(mm, static_cast<uint32_t>(i), j);
+
+        if ((q != 0U) && (((vp - 1U) / 10U) <= (vm / 10U)))
+        {
+          j = static_cast<int>(q) - 1 - (ryu::pow5_bits(i + 1) - Pow5_Bits);
+          last_removed_digit = ryu::multiply_pow5_div_pow2(mv, static_cast<uint32_t>(i + 1), j) % 10U;
+        }
+
+        if (q <= 1U)
+        {
+          // mv = 4 * m2, so it always has at least two trailing zero bits.
+          vr_is_trailing_zeros = true;
+
+          if (accept_bounds)
+          {
+            // mm = mv - 1 - mm_shift, so it has one trailing zero bit if mm_shift == 1.
+            vm_is_trailing_zeros = (mm_shift == 1U);
+          }
+          else
+          {
+            // mp = mv + 2, so it always has at least one trailing zero bit.
+            --vp;
+          }
+        }
+        else if (q < 31U)
+        {
+          vr_is_trailing_zeros = ryu::is_multiple_of_pow2(mv, q - 1U);
+        }
+      }
+
+      // Find the shortest decimal representation in the interval.
+      int      removed = 0;
+      uint32_t output;
+
+      if (vm_is_trailing_zeros || vr_is_trailing_zeros)
+      {
+        // The general case, which is rare.
+        while ((vp / 10U) > (vm / 10U))
+        {
+          vm_is_trailing_zeros &= ((vm % 10U) == 0U);
+          vr_is_trailing_zeros &= (last_removed_digit == 0U);
+          last_removed_digit = vr % 10U;
+          vr /= 10U;
+          vp /= 10U;
+          vm /= 10U;
+          ++removed;
+        }
+
+        if (vm_is_trailing_zeros)
+        {
+          while ((vm % 10U) == 0U)
+          {
+            vr_is_trailing_zeros &= (last_removed_digit == 0U);
+            last_removed_digit = vr % 10U;
+            vr /= 10U;
+            vp /= 10U;
+            vm /= 10U;
+            ++removed;
+          }
+        }
+
+        if (vr_is_trailing_zeros && (last_removed_digit == 5U) && ((vr % 2U) == 0U))
+        {
+          // Round to even if the exact value is .....50..0.
+          last_removed_digit = 4U;
+        }
+
+        // Take vr + 1 if vr is outside the bounds, or rounding is needed.
+        output = vr + ((((vr == vm) && (!accept_bounds || !vm_is_trailing_zeros)) || (last_removed_digit >= 5U)) ? 1U : 0U);
+      }
+      else
+      {
+        // The common case.
+        while ((vp / 10U) > (vm / 10U))
+        {
+          last_removed_digit = vr % 10U;
+          vr /= 10U;
+          vp /= 10U;
+          vm /= 10U;
+          ++removed;
+        }
+
+        // Take vr + 1 if vr is outside the bounds, or rounding is needed.
+        output = vr + (((vr == vm) || (last_removed_digit >= 5U)) ? 1U : 0U);
+      }
+
+      decimal_t result;
+      result.significand = output;
+      result.exponent    = e10 + removed;
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// A fixed capacity unsigned big integer, with just the operations needed
+    /// for exact digit generation.
+    //*************************************************************************
+    template <size_t Limbs>
+    class bignum
+    {
+    public:
+
+      bignum()
+        : length(0U)
+      {
+      }
+
+      void assign(uint64_t value)
+      {
+        length = 0U;
+
+        while (value != 0U)
+        {
+          limbs[length++] = static_cast<uint32_t>(value);
+          value >>= 32;
+        }
+      }
+
+      bool is_zero() const
+      {
+        return length == 0U;
+      }
+
+      void multiply(uint32_t factor)
+      {
+        uint64_t carry = 0U;
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          carry += uint64_t(limbs[i]) * factor;
+          limbs[i] = static_cast<uint32_t>(carry);
+          carry >>= 32;
+        }
+
+        if (carry != 0U)
+        {
+          limbs[length++] = static_cast<uint32_t>(carry);
+        }
+      }
+
+      void multiply_pow10(int n)
+      {
+        static const uint32_t powers[9] = { 1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U };
+
+        while (n >= 9)
+        {
+          multiply(1000000000U);
+          n -= 9;
+        }
+
+        if (n > 0)
+        {
+          multiply(powers[n]);
+        }
+      }
+
+      void shift_left(int n)
+      {
+        if (length == 0U)
+        {
+          return;
+        }
+
+        const size_t   words = static_cast<size_t>(n) / 32U;
+        const uint32_t bits  = static_cast<uint32_t>(n) % 32U;
+
+        if (bits != 0U)
+        {
+          uint32_t carry = 0U;
+
+          for (size_t i = 0U; i < length; ++i)
+          {
+            const uint32_t limb = limbs[i];
+            limbs[i] = (limb << bits) | carry;
+            carry    = limb >> (32U - bits);
+          }
+
+          if (carry != 0U)
+          {
+            limbs[length++] = carry;
+          }
+        }
+
+        if (words != 0U)
+        {
+          for (size_t i = length; i-- > 0U;)
+          {
+            limbs[i + words] = limbs[i];
+          }
+
+          for (size_t i = 0U; i < words; ++i)
+          {
+            limbs[i] = 0U;
+          }
+
+          length += words;
+        }
+      }
+
+      int compare(const bignum& other) const
+      {
+        if (length != other.length)
+        {
+          return (length < other.length) ? -1 : 1;
+        }
+
+        for (size_t i = length; i-- > 0U;)
+        {
+          if (limbs[i] != other.limbs[i])
+          {
+            return (limbs[i] < other.limbs[i]) ? -1 : 1;
+          }
+        }
+
+        return 0;
+      }
+
+      /// Subtracts other, which must not be greater than this.
+      void subtract(const bignum& other)
+      {
+        uint32_t borrow = 0U;
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          const uint64_t rhs        = uint64_t((i < other.length) ? other.limbs[i] : 0U) + borrow;
+          const uint32_t limb       = limbs[i];
+          limbs[i] = static_cast<uint32_t>(limb - rhs);
+          borrow   = (limb < rhs) ? 1U : 0U;
+        }
+
+        while ((length != 0U) && (limbs[length - 1U] == 0U))
+        {
+          --length;
+        }
+      }
+
+    private:
+
+      uint32_t limbs[Limbs];
+      size_t   length;
+    };
+
+    //*************************************************************************
+    /// Generates the exact decimal digits of a finite, non-zero value, most
+    /// significant first. Digits past the end of the expansion are zero.
+    //*************************************************************************
+    template <typename T>
+    class exact_digits
+    {
+    public:
+
+      explicit exact_digits(T value)
+      {
+        typedef ieee_traits<T> traits;
+
+        const ieee_fields_t fields = get_fields(value);
+
+        uint64_t mantissa;
+        int      exponent;
+
+        if (fields.exponent == 0U)
+        {
+          mantissa = fields.mantissa;
+          exponent = 1 - traits::Bias - traits::Mantissa_Bits;
+        }
+        else
+        {
+          mantissa = (uint64_t(1U) << traits::Mantissa_Bits) | fields.mantissa;
+          exponent = static_cast<int>(fields.exponent) - traits::Bias - traits::Mantissa_Bits;
+        }
+
+        // value = remainder / scale.
+        remainder.assign(mantissa);
+        scale.assign(1U);
+
+        if (exponent >= 0)
+        {
+          remainder.shift_left(exponent);
+        }
+        else
+        {
+          scale.shift_left(-exponent);
+        }
+
+        // Estimate k, where 10^(k - 1) <= value < 10^k, from the binary exponent.
+        int log2_value = exponent;
+
+        while (mantissa > 1U)
+        {
+          mantissa >>= 1;
+          ++log2_value;
+        }
+
+        k = floor_log10_pow2(log2_value) + 1;
+
+        if (k >= 0)
+        {
+          scale.multiply_pow10(k);
+        }
+        else
+        {
+          remainder.multiply_pow10(-k);
+        }
+
+        // The estimate may be one out either way.
+        if (remainder.compare(scale) >= 0)
+        {
+          scale.multiply(10U);
+          ++k;
+        }
+        else
+        {
+          bignum_type scaled = remainder;
+          scaled.multiply(10U);
+
+          if (scaled.compare(scale) < 0)
+          {
+            remainder = scaled;
+            --k;
+          }
+        }
+      }
+
+      /// The decimal exponent of the first digit.
+      int exponent() const
+      {
+        return k - 1;
+      }
+
+      /// Gets the next digit.
+      uint32_t next()
+      {
+        uint32_t digit = 0U;
+
+        if (!remainder.is_zero())
+        {
+          remainder.multiply(10U);
+
+          while (remainder.compare(scale) >= 0)
+          {
+            remainder.subtract(scale);
+            ++digit;
+          }
+        }
+
+        return digit;
+      }
+
+      /// Compares the rest of the digits with one half of the last digit.
+      int compare_half() const
+      {
+        bignum_type doubled = remainder;
+        doubled.shift_left(1);
+
+        return doubled.compare(scale);
+      }
+
+    private:
+
+      typedef bignum<ieee_traits<T>::Bignum_Limbs> bignum_type;
+
+      // floor(e * log10(2)), or one more when e is negative.
+      static int floor_log10_pow2(int e)
+      {
+        return (e >= 0) ? static_cast<int>(ryu::log10_pow2(e)) : -static_cast<int>(ryu::log10_pow2(-e));
+      }
+
+      bignum_type remainder;
+      bignum_type scale;
+      int         k;
+    };
+
+    //*************************************************************************
+    /// Writes 'count' digits from the generator, rounded half to even.
+    /// Returns true, without writing anything, if the rounding carried out of
+    /// the leading digit. The rounded value is then 10^(exponent + 1).
+    //*************************************************************************
+    template <typename TGenerator, typename TSink>
+    bool write_rounded_digits(TGenerator& generator, int count, TSink& sink)
+    {
+      // The last digit that is not a nine, and the count of nines after it.
+      int pending = -1;
+      int nines   = 0;
+
+      for (int i = 0; i < count; ++i)
+      {
+        const uint32_t digit = generator.next();
+
+        if (digit == 9U)
+        {
+          ++nines;
+        }
+        else
+        {
+          if (pending >= 0)
+          {
+            sink(static_cast<char>('0' + pending));
+          }
+
+          for (; nines > 0; --nines)
+          {
+            sink('9');
+          }
+
+          pending = static_cast<int>(digit);
+        }
+      }
+
+      const int  last     = (nines > 0) ? 9 : pending;
+      const int  half     = generator.compare_half();
+      const bool round_up = (half > 0) || ((half == 0) && (last > 0) && ((last % 2) != 0));
+
+      if (round_up && (pending < 0))
+      {
+        return true;
+      }
+
+      if (pending >= 0)
+      {
+        sink(static_cast<char>('0' + pending + (round_up ? 1 : 0)));
+      }
+
+      for (; nines > 0; --nines)
+      {
+        sink(round_up ? '0' : '9');
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Writes the digits as d.ddd, with the decimal point after the first
+    /// 'integral' digits.
+    //*************************************************************************
+    template <typename TSink>
+    class point_sink
+    {
+    public:
+
+      point_sink(TSink& sink_, int integral_, bool point_)
+        : sink(sink_)
+        , integral(integral_)
+        , point(point_)
+        , written(0)
+      {
+      }
+
+      void operator()(char c)
+      {
+        sink(c);
+
+        if ((++written == integral) && point)
+        {
+          sink('.');
+        }
+      }
+
+    private:
+
+      TSink& sink;
+      int    integral;
+      bool   point;
+      int    written;
+    };
+
+    //*************************************************************************
+    /// Writes digits in fixed notation, starting at the 10^exponent position
+    /// and ending at the 10^-precision position.
+    //*************************************************************************
+    template <typename TSink>
+    class fixed_sink
+    {
+    public:
+
+      fixed_sink(TSink& sink_, int exponent, int precision_, bool point_)
+        : sink(sink_)
+        , position(exponent)
+        , precision(precision_)
+        , point(point_)
+        , started(false)
+      {
+      }
+
+      void operator()(char c)
+      {
+        start();
+        write(c);
+      }
+
+      /// Pads with zeros to the last position.
+      void finish()
+      {
+        start();
+
+        while (position >= -precision)
+        {
+          write('0');
+        }
+      }
+
+    private:
+
+      void start()
+      {
+        if (!started)
+        {
+          started = true;
+
+          if (position < 0)
+          {
+            // Leading zeros.
+            const int first = position;
+            position = 0;
+            write('0');
+
+            while (position > first)
+            {
+              write('0');
+            }
+          }
+        }
+      }
+
+      void write(char c)
+      {
+        sink(c);
+
+        if ((position == 0) && point)
+        {
+          sink('.');
+        }
+
+        --position;
+      }
+
+      TSink& sink;
+      int    position;
+      int    precision;
+      bool   point;
+      bool   started;
+    };
+
+    //*************************************************************************
+    /// Writes the exponent of the scientific notation.
+    //*************************************************************************
+    template <typename TSink>
+    void write_exponent(TSink& sink, int exponent, bool upper_case)
+    {
+      sink(upper_case ? 'E' : 'e');
+
+      if (exponent < 0)
+      {
+        sink('-');
+        exponent = -exponent;
+      }
+      else
+      {
+        sink('+');
+      }
+
+      if (exponent >= 100)
+      {
+        sink(static_cast<char>('0' + (exponent / 100)));
+        exponent %= 100;
+      }
+
+      sink(static_cast<char>('0' + (exponent / 10)));
+      sink(static_cast<char>('0' + (exponent % 10)));
+    }
+
+    //*************************************************************************
+    /// Writes zeros.
+    //*************************************************************************
+    template <typename TSink>
+    void write_zeros(TSink& sink, size_t count)
+    {
+      while (count-- != 0U)
+      {
+        sink('0');
+      }
+    }
+
+    //*************************************************************************
+    /// Writes the magnitude of a finite value in scientific notation,
+    /// d.ddde+dd, with 'precision' digits after the point.
+    //*************************************************************************
+    template <typename TSink, typename T>
+    void write_scientific(TSink& sink, T value, size_t precision, bool upper_case, bool alternate)
+    {
+      const bool point = (precision > 0U) || alternate;
+
+      point_sink<TSink> scientific(sink, 1, point);
+
+      int exponent = 0;
+
+      if (is_zero(value))
+      {
+        scientific('0');
+        write_zeros(scientific, precision);
+      }
+      else
+      {
+        exact_digits<T> generator(value);
+        exponent = generator.exponent();
+
+        if (write_rounded_digits(generator, static_cast<int>(precision) + 1, scientific))
+        {
+          ++exponent;
+          scientific('1');
+          write_zeros(scientific, precision);
+        }
+      }
+
+      write_exponent(sink, exponent, upper_case);
+    }
+
+    //*************************************************************************
+    /// Writes the magnitude of a finite value in fixed notation, with
+    /// 'precision' digits after the point.
+    //*************************************************************************
+    template <typename TSink, typename T>
+    void write_fixed(TSink& sink, T value, size_t precision, bool alternate)
+    {
+      const bool point = (precision > 0U) || alternate;
+      const int  last  = static_cast<int>(precision);
+
+      if (is_zero(value))
+      {
+        fixed_sink<TSink> fixed(sink, 0, last, point);
+        fixed.finish();
+      }
+      else
+      {
+        exact_digits<T> generator(value);
+        const int exponent = generator.exponent();
+        const int count    = exponent + 1 + last;
+
+        if (count < 0)
+        {
+          // Far less than half of the last digit.
+          fixed_sink<TSink> fixed(sink, 0, last, point);
+          fixed.finish();
+        }
+        else
+        {
+          fixed_sink<TSink> fixed(sink, exponent, last, point);
+
+          if (write_rounded_digits(generator, count, fixed))
+          {
+            fixed_sink<TSink> carried(sink, exponent + 1, last, point);
+            carried('1');
+            carried.finish();
+          }
+          else
+          {
+            fixed.finish();
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Writes the magnitude of a finite value with the fewest digits that
+    /// round trip, in fixed or scientific notation, whichever is shorter.
+    //*************************************************************************
+    template <typename TSink, typename T>
+    void write_shortest(TSink& sink, T value)
+    {
+      if (is_zero(value))
+      {
+        sink('0');
+        return;
+      }
+
+      const decimal_t decimal = shortest_decimal(value);
+
+      // Extract the digits.
+      char     digits[20];
+      int      length      = 0;
+      uint64_t significand = decimal.significand;
+
+      do
+      {
+        digits[19 - length] = static_cast<char>('0' + (significand % 10U));
+        significand /= 10U;
+        ++length;
+      } while (significand != 0U);
+
+      const char* first = digits + 20 - length;
+
+      const int exponent            = decimal.exponent;
+      const int scientific_exponent = exponent + length - 1;
+
+      const int scientific_length = length + ((length > 1) ? 1 : 0) + (((scientific_exponent >= 100) || (scientific_exponent <= -100)) ? 5 : 4);
+      int       fixed_length;
+
+      if (exponent >= 0)
+      {
+        fixed_length = length + exponent;
+      }
+      else if (scientific_exponent >= 0)
+      {
+        fixed_length = length + 1;
+      }
+      else
+      {
+        fixed_length = length + 1 - scientific_exponent;
+      }
+
+      if (fixed_length <= scientific_length)
+      {
+        if (exponent >= 0)
+        {
+          // An integer is written with all of its exact digits.
+          write_fixed(sink, value, 0U, false);
+        }
+        else
+        {
+          fixed_sink<TSink> fixed(sink, scientific_exponent, -exponent, true);
+
+          for (int i = 0; i < length; ++i)
+          {
+            fixed(first[i]);
+          }
+        }
+      }
+      else
+      {
+        point_sink<TSink> scientific(sink, 1, length > 1);
+
+        for (int i = 0; i < length; ++i)
+        {
+          scientific(first[i]);
+        }
+
+        write_exponent(sink, scientific_exponent, false);
+      }
+    }
+
+    //*************************************************************************
+    /// Counts digits, and finds the last that is not zero.
+    //*************************************************************************
+    class digit_counter
+    {
+    public:
+
+      digit_counter()
+        : count(0)
+        , significant(0)
+      {
+      }
+
+      void operator()(char c)
+      {
+        ++count;
+
+        if (c != '0')
+        {
+          significant = count;
+        }
+      }
+
+      int count;
+      int significant;
+    };
+
+    //*************************************************************************
+    /// Writes the magnitude of a finite value with 'precision' significant
+    /// digits, in fixed or scientific notation depending on the exponent.
+    /// Trailing zeros are removed, unless 'alternate' is set.
+    //*************************************************************************
+    template <typename TSink, typename T>
+    void write_general(TSink& sink, T value, size_t precision, bool upper_case, bool alternate)
+    {
+      if (precision == 0U)
+      {
+        precision = 1U;
+      }
+
+      const int digits = static_cast<int>(precision);
+      int       exponent    = 0;
+      int       significant = 1;
+
+      if (!is_zero(value))
+      {
+        exact_digits<T> generator(value);
+        digit_counter   counter;
+
+        exponent = generator.exponent();
+
+        if (write_rounded_digits(generator, digits, counter))
+        {
+          ++exponent;
+        }
+        else if (counter.significant > 0)
+        {
+          significant = counter.significant;
+        }
+      }
+
+      if (alternate)
+      {
+        significant = digits;
+      }
+
+      if ((digits > exponent) && (exponent >= -4))
+      {
+        const int decimals = significant - 1 - exponent;
+
+        write_fixed(sink, value, static_cast<size_t>((decimals > 0) ? decimals : 0), alternate);
+      }
+      else
+      {
+        write_scientific(sink, value, static_cast<size_t>(significant - 1), upper_case, alternate);
+      }
+    }
+  }
+}
+
+#endif
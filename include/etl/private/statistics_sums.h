@@ -0,0 +1,614 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATISTICS_SUMS_INCLUDED
+#define ETL_STATISTICS_SUMS_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_statistics
+  {
+    //***************************************************************************
+    /// Sums for the bulk add paths of the statistics classes.
+    /// Each sum is spread over four independent lanes. This removes the loop
+    /// carried dependency, so the compiler is free to vectorise, and the lanes
+    /// are combined pairwise, which reduces rounding error for floating point.
+    /// Terms are formed exactly as the single value add() functions form them,
+    /// with the values converted to TCalc before they are multiplied.
+    //***************************************************************************
+    static ETL_CONSTANT size_t Lanes = 4U;
+
+    //***************************************************************************
+    /// The type that a bulk sum is accumulated in.
+    /// Float sums use double, so long spans lose little precision.
+    //***************************************************************************
+    template <typename TCalc>
+    struct bulk_sum_type
+    {
+      typedef typename etl::conditional<etl::is_same<TCalc, float>::value, double, TCalc>::type type;
+    };
+
+    //***************************************************************************
+    /// The number of values in each block of a floating point bulk add.
+    /// Blocks are short enough for their sums to be accurate in double.
+    //***************************************************************************
+    static ETL_CONSTANT size_t Block_Size = 64U;
+
+    //***************************************************************************
+    /// Sum of values.
+    //***************************************************************************
+    template <typename TCalc, typename TInput>
+    TCalc lane_sum(const TInput* p, size_t n)
+    {
+      TCalc s0 = TCalc(0);
+      TCalc s1 = TCalc(0);
+      TCalc s2 = TCalc(0);
+      TCalc s3 = TCalc(0);
+
+      size_t i = 0U;
+
+      for (; (i + Lanes) <= n; i += Lanes)
+      {
+        s0 += TCalc(p[i]);
+        s1 += TCalc(p[i + 1U]);
+        s2 += TCalc(p[i + 2U]);
+        s3 += TCalc(p[i + 3U]);
+      }
+
+      for (; i < n; ++i)
+      {
+        s0 += TCalc(p[i]);
+      }
+
+      return (s0 + s1) + (s2 + s3);
+    }
+
+    //***************************************************************************
+    /// Sum of squares.
+    //***************************************************************************
+    template <typename TCalc, typename TInput>
+    TCalc lane_sum_of_squares(const TInput* p, size_t n)
+    {
+      TCalc s0 = TCalc(0);
+      TCalc s1 = TCalc(0);
+      TCalc s2 = TCalc(0);
+      TCalc s3 = TCalc(0);
+
+      size_t i = 0U;
+
+      for (; (i + Lanes) <= n; i += Lanes)
+      {
+        s0 += TCalc(p[i]) * TCalc(p[i]);
+        s1 += TCalc(p[i + 1U]) * TCalc(p[i + 1U]);
+        s2 += TCalc(p[i + 2U]) * TCalc(p[i + 2U]);
+        s3 += TCalc(p[i + 3U]) * TCalc(p[i + 3U]);
+      }
+
+      for (; i < n; ++i)
+      {
+        s0 += TCalc(p[i]) * TCalc(p[i]);
+      }
+
+      return (s0 + s1) + (s2 + s3);
+    }
+
+    //***************************************************************************
+    /// Sum of values and sum of squares in one pass.
+    //***************************************************************************
+    template <typename TCalc, typename TInput>
+    void lane_sums(const TInput* p, size_t n, TCalc& sum, TCalc& sum_of_squares)
+    {
+      TCalc s0 = TCalc(0);
+      TCalc s1 = TCalc(0);
+      TCalc s2 = TCalc(0);
+      TCalc s3 = TCalc(0);
+      TCalc q0 = TCalc(0);
+      TCalc q1 = TCalc(0);
+      TCalc q2 = TCalc(0);
+      TCalc q3 = TCalc(0);
+
+      size_t i = 0U;
+
+      for (; (i + Lanes) <= n; i += Lanes)
+      {
+        s0 += TCalc(p[i]);
+        s1 += TCalc(p[i + 1U]);
+        s2 += TCalc(p[i + 2U]);
+        s3 += TCalc(p[i + 3U]);
+        q0 += TCalc(p[i]) * TCalc(p[i]);
+        q1 += TCalc(p[i + 1U]) * TCalc(p[i + 1U]);
+        q2 += TCalc(p[i + 2U]) * TCalc(p[i + 2U]);
+        q3 += TCalc(p[i + 3U]) * TCalc(p[i + 3U]);
+      }
+
+      for (; i < n; ++i)
+      {
+        s0 += TCalc(p[i]);
+        q0 += TCalc(p[i]) * TCalc(p[i]);
+      }
+
+      sum            += (s0 + s1) + (s2 + s3);
+      sum_of_squares += (q0 + q1) + (q2 + q3);
+    }
+
+    //***************************************************************************
+    /// Sum of the products of two sequences.
+    //***************************************************************************
+    template <typename TCalc, typename TInput>
+    TCalc lane_inner_product(const TInput* p1, const TInput* p2, size_t n)
+    {
+      TCalc s0 = TCalc(0);
+      TCalc s1 = TCalc(0);
+      TCalc s2 = TCalc(0);
+      TCalc s3 = TCalc(0);
+
+      size_t i = 0U;
+
+      for (; (i + Lanes) <= n; i += Lanes)
+      {
+        s0 += TCalc(p1[i]) * TCalc(p2[i]);
+        s1 += TCalc(p1[i + 1U]) * TCalc(p2[i + 1U]);
+        s2 += TCalc(p1[i + 2U]) * TCalc(p2[i + 2U]);
+        s3 += TCalc(p1[i + 3U]) * TCalc(p2[i + 3U]);
+      }
+
+      for (; i < n; ++i)
+      {
+        s0 += TCalc(p1[i]) * TCalc(p2[i]);
+      }
+
+      return (s0 + s1) + (s2 + s3);
+    }
+
+    //***************************************************************************
+    /// Sum of the products of the deviations of two sequences from their centres.
+    /// Pass the same sequence twice for the sum of squared deviations.
+    //***************************************************************************
+    template <typename TCalc, typename TInput>
+    TCalc lane_deviation_product(const TInput* p1, TCalc centre1, const TInput* p2, TCalc centre2, size_t n)
+    {
+      TCalc s0 = TCalc(0);
+      TCalc s1 = TCalc(0);
+      TCalc s2 = TCalc(0);
+      TCalc s3 = TCalc(0);
+
+      size_t i = 0U;
+
+      for (; (i + Lanes) <= n; i += Lanes)
+      {
+        s0 += (TCalc(p1[i]) - centre1) * (TCalc(p2[i]) - centre2);
+        s1 += (TCalc(p1[i + 1U]) - centre1) * (TCalc(p2[i + 1U]) - centre2);
+        s2 += (TCalc(p1[i + 2U]) - centre1) * (TCalc(p2[i + 2U]) - centre2);
+        s3 += (TCalc(p1[i + 3U]) - centre1) * (TCalc(p2[i + 3U]) - centre2);
+      }
+
+      for (; i < n; ++i)
+      {
+        s0 += (TCalc(p1[i]) - centre1) * (TCalc(p2[i]) - centre2);
+      }
+
+      return (s0 + s1) + (s2 + s3);
+    }
+
+    //***************************************************************************
+    /// The count, mean and sum of squared deviations (M2) of a sequence.
+    /// Integral calculation types keep exact sums of values and squares.
+    /// Floating point types keep the mean and M2 in double. Single values use
+    /// Welford's update. Bulk adds take each block's mean and M2 in two passes,
+    /// then combine them with Chan's formula, as do merges. This avoids the
+    /// cancellation in n * sum of squares - sum * sum when the mean is large
+    /// compared to the spread.
+    //***************************************************************************
+    template <typename TCalc, bool Is_Floating_Point = etl::is_floating_point<TCalc>::value>
+    class moments;
+
+    //***************************************************************************
+    /// Integral moments.
+    //***************************************************************************
+    template <typename TCalc>
+    class moments<TCalc, false>
+    {
+    public:
+
+      moments()
+      {
+        clear();
+      }
+
+      template <typename TInput>
+      void add(TInput value)
+      {
+        sum_of_squares += TCalc(value) * TCalc(value);
+        sum            += TCalc(value);
+        ++counter;
+      }
+
+      template <typename TInput>
+      void add(const TInput* p, size_t n)
+      {
+        lane_sums<TCalc>(p, n, sum, sum_of_squares);
+        counter += uint32_t(n);
+      }
+
+      void merge(const moments& other)
+      {
+        sum_of_squares += other.sum_of_squares;
+        sum            += other.sum;
+        counter        += other.counter;
+      }
+
+      uint32_t count() const
+      {
+        return counter;
+      }
+
+      double m2() const
+      {
+        double n = double(counter);
+
+        double square_of_sum = (sum * sum);
+
+        return ((n * sum_of_squares) - square_of_sum) / n;
+      }
+
+      void clear()
+      {
+        sum_of_squares = TCalc(0);
+        sum            = TCalc(0);
+        counter        = 0U;
+      }
+
+    private:
+
+      TCalc    sum_of_squares;
+      TCalc    sum;
+      uint32_t counter;
+    };
+
+    //***************************************************************************
+    /// Floating point moments.
+    //***************************************************************************
+    template <typename TCalc>
+    class moments<TCalc, true>
+    {
+    public:
+
+      moments()
+      {
+        clear();
+      }
+
+      template <typename TInput>
+      void add(TInput value)
+      {
+        ++counter;
+
+        const double delta = double(value) - mean;
+        mean += delta / double(counter);
+        m2_value += delta * (double(value) - mean);
+      }
+
+      template <typename TInput>
+      void add(const TInput* p, size_t n)
+      {
+        while (n != 0U)
+        {
+          const size_t block = (n < Block_Size) ? n : Block_Size;
+
+          const double block_mean = lane_sum<double>(p, block) / double(block);
+          const double block_m2   = lane_deviation_product<double>(p, block_mean, p, block_mean, block);
+
+          combine(uint32_t(block), block_mean, block_m2);
+
+          p += block;
+          n -= block;
+        }
+      }
+
+      void merge(const moments& other)
+      {
+        combine(other.counter, other.mean, other.m2_value);
+      }
+
+      uint32_t count() const
+      {
+        return counter;
+      }
+
+      double m2() const
+      {
+        return m2_value;
+      }
+
+      void clear()
+      {
+        mean     = 0.0;
+        m2_value = 0.0;
+        counter  = 0U;
+      }
+
+    private:
+
+      //*************************************************************************
+      /// Chan's formula for the moments of the union of two sets.
+      //*************************************************************************
+      void combine(uint32_t other_count, double other_mean, double other_m2)
+      {
+        if (other_count == 0U)
+        {
+          return;
+        }
+
+        const double n_a   = double(counter);
+        const double n_b   = double(other_count);
+        const double n     = n_a + n_b;
+        const double delta = other_mean - mean;
+
+        mean     += delta * (n_b / n);
+        m2_value += other_m2 + (delta * delta * ((n_a * n_b) / n));
+        counter  += other_count;
+      }
+
+      double   mean;
+      double   m2_value;
+      uint32_t counter;
+    };
+
+    //***************************************************************************
+    /// The count, M2 of each sequence and co-moment of a pair of sequences.
+    /// As moments, but the co-moment is the sum of the products of the
+    /// deviations of each pair from the means.
+    //***************************************************************************
+    template <typename TCalc, bool Is_Floating_Point = etl::is_floating_point<TCalc>::value>
+    class co_moments;
+
+    //***************************************************************************
+    /// Integral co-moments.
+    //***************************************************************************
+    template <typename TCalc>
+    class co_moments<TCalc, false>
+    {
+    public:
+
+      co_moments()
+      {
+        clear();
+      }
+
+      template <typename TInput>
+      void add(TInput value1, TInput value2)
+      {
+        inner_product   += TCalc(value1) * TCalc(value2);
+        sum_of_squares1 += TCalc(value1) * TCalc(value1);
+        sum_of_squares2 += TCalc(value2) * TCalc(value2);
+        sum1            += TCalc(value1);
+        sum2            += TCalc(value2);
+        ++counter;
+      }
+
+      template <typename TInput>
+      void add(const TInput* p1, const TInput* p2, size_t n)
+      {
+        inner_product += lane_inner_product<TCalc>(p1, p2, n);
+        lane_sums<TCalc>(p1, n, sum1, sum_of_squares1);
+        lane_sums<TCalc>(p2, n, sum2, sum_of_squares2);
+        counter += uint32_t(n);
+      }
+
+      void merge(const co_moments& other)
+      {
+        inner_product   += other.inner_product;
+        sum_of_squares1 += other.sum_of_squares1;
+        sum_of_squares2 += other.sum_of_squares2;
+        sum1            += other.sum1;
+        sum2            += other.sum2;
+        counter         += other.counter;
+      }
+
+      uint32_t count() const
+      {
+        return counter;
+      }
+
+      double m2_1() const
+      {
+        double n = double(counter);
+
+        double square_of_sum1 = (sum1 * sum1);
+
+        return ((n * sum_of_squares1) - square_of_sum1) / n;
+      }
+
+      double m2_2() const
+      {
+        double n = double(counter);
+
+        double square_of_sum2 = (sum2 * sum2);
+
+        return ((n * sum_of_squares2) - square_of_sum2) / n;
+      }
+
+      double co_moment() const
+      {
+        double n = double(counter);
+
+        return ((n * inner_product) - (sum1 * sum2)) / n;
+      }
+
+      void clear()
+      {
+        inner_product   = TCalc(0);
+        sum_of_squares1 = TCalc(0);
+        sum_of_squares2 = TCalc(0);
+        sum1            = TCalc(0);
+        sum2            = TCalc(0);
+        counter         = 0U;
+      }
+
+    private:
+
+      TCalc    inner_product;
+      TCalc    sum_of_squares1;
+      TCalc    sum_of_squares2;
+      TCalc    sum1;
+      TCalc    sum2;
+      uint32_t counter;
+    };
+
+    //***************************************************************************
+    /// Floating point co-moments.
+    //***************************************************************************
+    template <typename TCalc>
+    class co_moments<TCalc, true>
+    {
+    public:
+
+      co_moments()
+      {
+        clear();
+      }
+
+      template <typename TInput>
+      void add(TInput value1, TInput value2)
+      {
+        ++counter;
+
+        const double n      = double(counter);
+        const double delta1 = double(value1) - mean1;
+        const double delta2 = double(value2) - mean2;
+
+        mean1 += delta1 / n;
+        mean2 += delta2 / n;
+
+        m2_1_value      += delta1 * (double(value1) - mean1);
+        m2_2_value      += delta2 * (double(value2) - mean2);
+        co_moment_value += delta1 * (double(value2) - mean2);
+      }
+
+      template <typename TInput>
+      void add(const TInput* p1, const TInput* p2, size_t n)
+      {
+        while (n != 0U)
+        {
+          const size_t block = (n < Block_Size) ? n : Block_Size;
+
+          const double block_mean1     = lane_sum<double>(p1, block) / double(block);
+          const double block_mean2     = lane_sum<double>(p2, block) / double(block);
+          const double block_m2_1      = lane_deviation_product<double>(p1, block_mean1, p1, block_mean1, block);
+          const double block_m2_2      = lane_deviation_product<double>(p2, block_mean2, p2, block_mean2, block);
+          const double block_co_moment = lane_deviation_product<double>(p1, block_mean1, p2, block_mean2, block);
+
+          combine(uint32_t(block), block_mean1, block_mean2, block_m2_1, block_m2_2, block_co_moment);
+
+          p1 += block;
+          p2 += block;
+          n  -= block;
+        }
+      }
+
+      void merge(const co_moments& other)
+      {
+        combine(other.counter, other.mean1, other.mean2, other.m2_1_value, other.m2_2_value, other.co_moment_value);
+      }
+
+      uint32_t count() const
+      {
+        return counter;
+      }
+
+      double m2_1() const
+      {
+        return m2_1_value;
+      }
+
+      double m2_2() const
+      {
+        return m2_2_value;
+      }
+
+      double co_moment() const
+      {
+        return co_moment_value;
+      }
+
+      void clear()
+      {
+        mean1           = 0.0;
+        mean2           = 0.0;
+        m2_1_value      = 0.0;
+        m2_2_value      = 0.0;
+        co_moment_value = 0.0;
+        counter         = 0U;
+      }
+
+    private:
+
+      //*************************************************************************
+      /// Chan's formula for the co-moments of the union of two sets.
+      //*************************************************************************
+      void combine(uint32_t other_count, double other_mean1, double other_mean2, double other_m2_1, double other_m2_2, double other_co_moment)
+      {
+        if (other_count == 0U)
+        {
+          return;
+        }
+
+        const double n_a    = double(counter);
+        const double n_b    = double(other_count);
+        const double n      = n_a + n_b;
+        const double f      = (n_a * n_b) / n;
+        const double delta1 = other_mean1 - mean1;
+        const double delta2 = other_mean2 - mean2;
+
+        mean1           += delta1 * (n_b / n);
+        mean2           += delta2 * (n_b / n);
+        m2_1_value      += other_m2_1 + (delta1 * delta1 * f);
+        m2_2_value      += other_m2_2 + (delta2 * delta2 * f);
+        co_moment_value += other_co_moment + (delta1 * delta2 * f);
+        counter         += other_count;
+      }
+
+      double   mean1;
+      double   mean2;
+      double   m2_1_value;
+      double   m2_2_value;
+      double   co_moment_value;
+      uint32_t counter;
+    };
+  }
+}
+
+#endif
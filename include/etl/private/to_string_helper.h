@@ -45,6 +45,10 @@ SOFTWARE.
 #include "../math.h"
 #include "../limits.h"
 
+#if ETL_USING_64BIT_TYPES
+  #include "floating_point_decimal.h"
+#endif
+
 #include <math.h>
 
 #if ETL_USING_STL && ETL_USING_CPP11
@@ -289,6 +293,31 @@ namespace etl
     }
 #endif
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Appends the characters of a floating point conversion to a string.
+    //***************************************************************************
+    template <typename TIString>
+    class string_sink
+    {
+    public:
+
+      explicit string_sink(TIString& str_)
+        : str(str_)
+      {
+      }
+
+      void operator()(char c)
+      {
+        str.push_back(typename TIString::value_type(c));
+      }
+
+    private:
+
+      TIString& str;
+    };
+#endif
+
     //***************************************************************************
     /// Helper function for floating point.
     //***************************************************************************
@@ -308,6 +337,27 @@ namespace etl
 
       iterator start = str.end();
 
+#if ETL_USING_64BIT_TYPES
+      typedef typename etl::private_floating_point_decimal::working_type<T>::type working_type;
+
+      const working_type working_value = static_cast<working_type>(value);
+
+      if (!etl::private_floating_point_decimal::is_finite(working_value))
+      {
+        etl::private_to_string::add_nan_inf(etl::private_floating_point_decimal::is_nan(working_value), true, str);
+      }
+      else
+      {
+        if (etl::is_negative(value))
+        {
+          str.push_back(type('-'));
+        }
+
+        // Exact fixed point digits, rounded half to even.
+        string_sink<TIString> sink(str);
+        etl::private_floating_point_decimal::write_fixed(sink, working_value, format.get_precision(), false);
+      }
+#else
       if (isnan(value) || isinf(value))
       {
         etl::private_to_string::add_nan_inf(isnan(value), isinf(value), str);
@@ -317,12 +367,10 @@ namespace etl
         // Make sure we format the two halves correctly.
         uint32_t max_precision = etl::numeric_limits<T>::digits10;
 
-#if ETL_NOT_USING_64BIT_TYPES
         if (max_precision > 9)
         {
           max_precision = 9;
         }
-#endif
 
         etl::basic_format_spec<TIString> integral_format = format;
         integral_format.decimal().width(0).precision(format.get_precision() > max_precision ? max_precision : format.get_precision());
@@ -353,6 +401,7 @@ namespace etl
 
         etl::private_to_string::add_integral_and_fractional(integral, fractional, str, integral_format, fractional_format, etl::is_negative(value));
       }
+#endif
 
       etl::private_to_string::add_alignment(str, start, format);
     }
@@ -0,0 +1,286 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RADIX_SORT_INCLUDED
+#define ETL_RADIX_SORT_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "span.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+
+//*****************************************************************************
+///\defgroup radix_sort radix_sort
+/// A stable least significant digit radix sort for integral and floating
+/// point keys.
+///\ingroup algorithms
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_radix_sort
+  {
+    //*************************************************************************
+    /// Maps a key to an unsigned integer with the same ordering.
+    //*************************************************************************
+    template <typename TKey, bool Is_Integral = etl::is_integral<TKey>::value, bool Is_Signed = etl::is_signed<TKey>::value>
+    struct radix_key;
+
+    //*************************************************************************
+    /// Unsigned integers are used as they are.
+    //*************************************************************************
+    template <typename TKey>
+    struct radix_key<TKey, true, false>
+    {
+      typedef TKey type;
+
+      static type get(TKey key)
+      {
+        return key;
+      }
+    };
+
+    //*************************************************************************
+    /// Signed integers have their sign bit flipped, so that negative values
+    /// come before positive ones.
+    //*************************************************************************
+    template <typename TKey>
+    struct radix_key<TKey, true, true>
+    {
+      typedef typename etl::make_unsigned<TKey>::type type;
+
+      static type get(TKey key)
+      {
+        return static_cast<type>(static_cast<type>(key) ^ static_cast<type>(type(1U) << ((sizeof(type) * CHAR_BIT) - 1U)));
+      }
+    };
+
+    //*************************************************************************
+    /// Floats have their sign bit set if positive, or all bits inverted if negative.
+    //*************************************************************************
+    template <>
+    struct radix_key<float, false, true>
+    {
+      typedef uint32_t type;
+
+      static type get(float key)
+      {
+        ETL_STATIC_ASSERT(sizeof(float) == sizeof(uint32_t), "float must be 32 bits");
+
+        type bits;
+        memcpy(&bits, &key, sizeof(bits));
+
+        return ((bits & 0x80000000UL) != 0U) ? static_cast<type>(~bits) : static_cast<type>(bits | 0x80000000UL);
+      }
+    };
+
+    //*************************************************************************
+    /// Doubles have their sign bit set if positive, or all bits inverted if negative.
+    //*************************************************************************
+    template <>
+    struct radix_key<double, false, true>
+    {
+      typedef uint64_t type;
+
+      static type get(double key)
+      {
+        ETL_STATIC_ASSERT(sizeof(double) == sizeof(uint64_t), "double must be 64 bits");
+
+        type bits;
+        memcpy(&bits, &key, sizeof(bits));
+
+        return ((bits & 0x8000000000000000ULL) != 0U) ? static_cast<type>(~bits) : static_cast<type>(bits | 0x8000000000000000ULL);
+      }
+    };
+
+    //*************************************************************************
+    /// The key of a value is the value itself.
+    //*************************************************************************
+    struct identity_key
+    {
+      template <typename T>
+      const T& operator()(const T& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Moves the values to their place in the destination for one digit.
+    //*************************************************************************
+    template <typename TRadixKey, typename TSource, typename TDestination, typename TKeyFunction>
+    void scatter(TSource first, TSource last, TDestination destination, size_t* offsets, unsigned shift, TKeyFunction& key)
+    {
+      while (first != last)
+      {
+        const size_t digit = static_cast<size_t>((TRadixKey::get(key(*first)) >> shift) & 0xFFU);
+
+        *(destination + offsets[digit]) = ETL_MOVE(*first);
+        ++offsets[digit];
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts by the keys of type TKey.
+    //*************************************************************************
+    template <typename TKey, typename TIterator, typename TKeyFunction>
+    void radix_sort(TIterator first, TIterator last, typename etl::iterator_traits<TIterator>::value_type* p_scratch, size_t scratch_size, TKeyFunction& key)
+    {
+      typedef radix_key<typename etl::remove_cv<typename etl::remove_reference<TKey>::type>::type> radix_key_t;
+      typedef typename radix_key_t::type                                                          unsigned_key_t;
+
+      static const size_t Digits  = sizeof(unsigned_key_t);
+      static const size_t Buckets = 256U;
+
+      const size_t n = static_cast<size_t>(etl::distance(first, last));
+
+      if (n < 2U)
+      {
+        return;
+      }
+
+      ETL_ASSERT_OR_RETURN(scratch_size >= n, ETL_ERROR(algorithm_error));
+
+      // One pass counts every digit of every key.
+      size_t counts[Digits][Buckets];
+      memset(counts, 0, sizeof(counts));
+
+      for (TIterator itr = first; itr != last; ++itr)
+      {
+        unsigned_key_t k = radix_key_t::get(key(*itr));
+
+        for (size_t d = 0U; d < Digits; ++d)
+        {
+          ++counts[d][static_cast<size_t>(k & 0xFFU)];
+          k = static_cast<unsigned_key_t>(k >> 8U);
+        }
+      }
+
+      const unsigned_key_t first_key = radix_key_t::get(key(*first));
+      bool in_scratch = false;
+
+      for (size_t d = 0U; d < Digits; ++d)
+      {
+        const unsigned shift = static_cast<unsigned>(d * 8U);
+        size_t* offsets = counts[d];
+
+        // Skip a digit that is the same for every key.
+        if (offsets[static_cast<size_t>((first_key >> shift) & 0xFFU)] == n)
+        {
+          continue;
+        }
+
+        size_t total = 0U;
+
+        for (size_t b = 0U; b < Buckets; ++b)
+        {
+          const size_t count = offsets[b];
+          offsets[b] = total;
+          total += count;
+        }
+
+        if (in_scratch)
+        {
+          scatter<radix_key_t>(p_scratch, p_scratch + n, first, offsets, shift, key);
+        }
+        else
+        {
+          scatter<radix_key_t>(first, last, p_scratch, offsets, shift, key);
+        }
+
+        in_scratch = !in_scratch;
+      }
+
+      if (in_scratch)
+      {
+        etl::move(p_scratch, p_scratch + n, first);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts a range of integral or floating point values with a stable LSD
+  /// radix sort using 8 bit digits.
+  /// All digits are counted in a single pass and digits that are the same for
+  /// every value are skipped. The counts for each digit are held on the
+  /// stack, which is 256 * sizeof(size_t) bytes per byte of the value.
+  /// If asserts or exceptions are enabled, emits etl::algorithm_error if the
+  /// scratch area is smaller than the range.
+  ///\param first   The start of the range.
+  ///\param last    The end of the range.
+  ///\param scratch Temporary storage for at least as many values as the range.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <typename TIterator>
+  void radix_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> scratch)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    private_radix_sort::identity_key key;
+
+    private_radix_sort::radix_sort<value_type>(first, last, scratch.data(), scratch.size(), key);
+  }
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// Sorts a range of records by a key with a stable LSD radix sort using 8
+  /// bit digits. The key must be an integral or floating point type.
+  /// All digits are counted in a single pass and digits that are the same for
+  /// every key are skipped. The key function is called once per record for
+  /// the count and once per record for each digit that is not skipped.
+  /// If asserts or exceptions are enabled, emits etl::algorithm_error if the
+  /// scratch area is smaller than the range.
+  ///\param first   The start of the range.
+  ///\param last    The end of the range.
+  ///\param scratch Temporary storage for at least as many records as the range.
+  ///\param key     Returns the key of a record.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <typename TIterator, typename TKeyFunction>
+  void radix_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> scratch, TKeyFunction key)
+  {
+    typedef decltype(key(*first)) key_type;
+
+    private_radix_sort::radix_sort<key_type>(first, last, scratch.data(), scratch.size(), key);
+  }
+#endif
+}
+
+#endif
@@ -33,11 +33,94 @@ SOFTWARE.
 
 #include "platform.h"
 #include "binary.h"
+#include "span.h"
 
 #include <stdint.h>
 
 namespace etl
 {
+  namespace private_random
+  {
+    //*************************************************************************
+    /// Converts the top 24 bits of a random number to a float in [0, 1).
+    //*************************************************************************
+    inline float to_unit_float(uint32_t n)
+    {
+      return static_cast<float>(n >> 8U) * (1.0f / 16777216.0f);
+    }
+
+    //*************************************************************************
+    /// Gets a random number from the generator in the inclusive range [low, high].
+    /// Uses Lemire's multiply-shift with rejection, so the result is unbiased
+    /// and a division is only needed when a rejection is possible.
+    /// The generator is called non-virtually.
+    //*************************************************************************
+    template <typename TGenerator>
+    uint32_t range(TGenerator& generator, uint32_t low, uint32_t high)
+    {
+      const uint32_t r = high - low + 1UL;
+      uint32_t n = generator.TGenerator::operator()();
+
+      // The full 32 bit range.
+      if (r == 0U)
+      {
+        return n;
+      }
+
+#if ETL_USING_64BIT_TYPES
+      uint64_t m = uint64_t(n) * r;
+      uint32_t l = static_cast<uint32_t>(m);
+
+      if (l < r)
+      {
+        const uint32_t threshold = static_cast<uint32_t>(0UL - r) % r;
+
+        while (l < threshold)
+        {
+          n = generator.TGenerator::operator()();
+          m = uint64_t(n) * r;
+          l = static_cast<uint32_t>(m);
+        }
+      }
+
+      return low + static_cast<uint32_t>(m >> 32U);
+#else
+      const uint32_t threshold = static_cast<uint32_t>(0UL - r) % r;
+
+      while (n < threshold)
+      {
+        n = generator.TGenerator::operator()();
+      }
+
+      return low + (n % r);
+#endif
+    }
+
+    //*************************************************************************
+    /// Fills the span with random numbers from the generator.
+    //*************************************************************************
+    template <typename TGenerator>
+    void fill(TGenerator& generator, etl::span<uint32_t> values)
+    {
+      for (size_t i = 0UL; i < values.size(); ++i)
+      {
+        values[i] = generator.TGenerator::operator()();
+      }
+    }
+
+    //*************************************************************************
+    /// Fills the span with random numbers from the generator in the range [0, 1).
+    //*************************************************************************
+    template <typename TGenerator>
+    void fill(TGenerator& generator, etl::span<float> values)
+    {
+      for (size_t i = 0UL; i < values.size(); ++i)
+      {
+        values[i] = to_unit_float(generator.TGenerator::operator()());
+      }
+    }
+  }
+
 #if defined(ETL_POLYMORPHIC_RANDOM)
   //***************************************************************************
   /// The base for all 32 bit random number generators.
@@ -53,6 +136,28 @@ namespace etl
     virtual void initialise(uint32_t seed) = 0;
     virtual uint32_t operator()() = 0;
     virtual uint32_t range(uint32_t low, uint32_t high) = 0;
+
+    //*************************************************************************
+    /// Fills the span with random numbers.
+    //*************************************************************************
+    virtual void fill(etl::span<uint32_t> values)
+    {
+      for (size_t i = 0UL; i < values.size(); ++i)
+      {
+        values[i] = operator()();
+      }
+    }
+
+    //*************************************************************************
+    /// Fills the span with random numbers in the range [0, 1).
+    //*************************************************************************
+    virtual void fill(etl::span<float> values)
+    {
+      for (size_t i = 0UL; i < values.size(); ++i)
+      {
+        values[i] = private_random::to_unit_float(operator()());
+      }
+    }
   };
 #else
   //***************************************************************************
@@ -139,12 +244,23 @@ namespace etl
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
-        uint32_t r = high - low + 1UL;
-        uint32_t n = operator()();
-        n %= r;
-        n += low;
+        return private_random::range(*this, low, high);
+      }
 
-        return n;
+      //***************************************************************************
+      /// Fills the span with random numbers.
+      //***************************************************************************
+      void fill(etl::span<uint32_t> values)
+      {
+        private_random::fill(*this, values);
+      }
+
+      //***************************************************************************
+      /// Fills the span with random numbers in the range [0, 1).
+      //***************************************************************************
+      void fill(etl::span<float> values)
+      {
+        private_random::fill(*this, values);
       }
 
     private:
@@ -208,14 +324,42 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
+      // The sequence is not full range 32 bit, so the multiply-shift method cannot be used.
       uint32_t r = high - low + 1UL;
       uint32_t n = operator()();
+
+      // The full 32 bit range.
+      if (r == 0U)
+      {
+        return n;
+      }
+
       n %= r;
       n += low;
 
       return n;
     }
 
+    //***************************************************************************
+    /// Fills the span with random numbers.
+    //***************************************************************************
+    void fill(etl::span<uint32_t> values)
+    {
+      private_random::fill(*this, values);
+    }
+
+    //***************************************************************************
+    /// Fills the span with random numbers in the range [0, 1).
+    //***************************************************************************
+    void fill(etl::span<float> values)
+    {
+      // The sequence is 31 bit.
+      for (size_t i = 0UL; i < values.size(); ++i)
+      {
+        values[i] = private_random::to_unit_float(random_lcg::operator()() << 1U);
+      }
+    }
+
   private:
 
     static ETL_CONSTANT uint32_t a = 40014U;
@@ -284,14 +428,42 @@ namespace etl
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
+        // The sequence is not full range 32 bit, so the multiply-shift method cannot be used.
         uint32_t r = high - low + 1UL;
         uint32_t n = operator()();
+
+        // The full 32 bit range.
+        if (r == 0U)
+        {
+          return n;
+        }
+
         n %= r;
         n += low;
 
         return n;
       }
 
+      //***************************************************************************
+      /// Fills the span with random numbers.
+      //***************************************************************************
+      void fill(etl::span<uint32_t> values)
+      {
+        private_random::fill(*this, values);
+      }
+
+      //***************************************************************************
+      /// Fills the span with random numbers in the range [0, 1).
+      //***************************************************************************
+      void fill(etl::span<float> values)
+      {
+        // The sequence is 31 bit.
+        for (size_t i = 0UL; i < values.size(); ++i)
+        {
+          values[i] = private_random::to_unit_float(random_clcg::operator()() << 1U);
+        }
+      }
+
     private:
 
       static ETL_CONSTANT uint32_t a1 = 40014U;
@@ -367,12 +539,23 @@ namespace etl
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
-        uint32_t r = high - low + 1UL;
-        uint32_t n = operator()();
-        n %= r;
-        n += low;
+        return private_random::range(*this, low, high);
+      }
 
-        return n;
+      //***************************************************************************
+      /// Fills the span with random numbers.
+      //***************************************************************************
+      void fill(etl::span<uint32_t> values)
+      {
+        private_random::fill(*this, values);
+      }
+
+      //***************************************************************************
+      /// Fills the span with random numbers in the range [0, 1).
+      //***************************************************************************
+      void fill(etl::span<float> values)
+      {
+        private_random::fill(*this, values);
       }
 
     private:
@@ -436,12 +619,23 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1UL;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
+      return private_random::range(*this, low, high);
+    }
 
-      return n;
+    //***************************************************************************
+    /// Fills the span with random numbers.
+    //***************************************************************************
+    void fill(etl::span<uint32_t> values)
+    {
+      private_random::fill(*this, values);
+    }
+
+    //***************************************************************************
+    /// Fills the span with random numbers in the range [0, 1).
+    //***************************************************************************
+    void fill(etl::span<float> values)
+    {
+      private_random::fill(*this, values);
     }
 
   private:
@@ -506,12 +700,23 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1UL;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
+      return private_random::range(*this, low, high);
+    }
 
-      return n;
+    //***************************************************************************
+    /// Fills the span with random numbers.
+    //***************************************************************************
+    void fill(etl::span<uint32_t> values)
+    {
+      private_random::fill(*this, values);
+    }
+
+    //***************************************************************************
+    /// Fills the span with random numbers in the range [0, 1).
+    //***************************************************************************
+    void fill(etl::span<float> values)
+    {
+      private_random::fill(*this, values);
     }
 
   private:
@@ -521,6 +726,278 @@ namespace etl
 
     uint64_t value;
   };
+
+  //***************************************************************************
+  /// A 32 bit random number generator.
+  /// Uses the 64 bit xoshiro256** algorithm, seeded with splitmix64.
+  /// operator() returns the upper 32 bits of each 64 bit result.
+  /// fill() uses both halves of each 64 bit result.
+  /// https://prng.di.unimi.it/
+  //***************************************************************************
+  class random_xoshiro256ss : public random
+  {
+  public:
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_xoshiro256ss()
+    {
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n    = reinterpret_cast<uintptr_t>(this);
+      uint32_t  seed = static_cast<uint32_t>(n);
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_xoshiro256ss(uint32_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    /// The state is expanded from the seed with splitmix64, so it is never all zero.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint32_t seed)
+    {
+      uint64_t x = seed;
+
+      for (size_t i = 0UL; i < 4UL; ++i)
+      {
+        x += 0x9E3779B97F4A7C15ULL;
+
+        uint64_t z = x;
+        z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+        state[i] = z ^ (z >> 31U);
+      }
+    }
+
+    //***************************************************************************
+    /// Get the next random_xoshiro256ss number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      return static_cast<uint32_t>(next() >> 32U);
+    }
+
+    //***************************************************************************
+    /// Get the next random_xoshiro256ss number in a specified inclusive range.
+    //***************************************************************************
+    uint32_t range(uint32_t low, uint32_t high)
+    {
+      return private_random::range(*this, low, high);
+    }
+
+    //***************************************************************************
+    /// Fills the span with random numbers.
+    /// Each 64 bit result supplies two values, upper half first.
+    //***************************************************************************
+    void fill(etl::span<uint32_t> values)
+    {
+      size_t i = 0UL;
+
+      for (; (i + 1UL) < values.size(); i += 2UL)
+      {
+        const uint64_t n = next();
+        values[i]       = static_cast<uint32_t>(n >> 32U);
+        values[i + 1UL] = static_cast<uint32_t>(n);
+      }
+
+      if (i < values.size())
+      {
+        values[i] = random_xoshiro256ss::operator()();
+      }
+    }
+
+    //***************************************************************************
+    /// Fills the span with random numbers in the range [0, 1).
+    /// Each 64 bit result supplies two values, upper half first.
+    //***************************************************************************
+    void fill(etl::span<float> values)
+    {
+      size_t i = 0UL;
+
+      for (; (i + 1UL) < values.size(); i += 2UL)
+      {
+        const uint64_t n = next();
+        values[i]       = private_random::to_unit_float(static_cast<uint32_t>(n >> 32U));
+        values[i + 1UL] = private_random::to_unit_float(static_cast<uint32_t>(n));
+      }
+
+      if (i < values.size())
+      {
+        values[i] = private_random::to_unit_float(random_xoshiro256ss::operator()());
+      }
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Get the next 64 bit result.
+    //***************************************************************************
+    uint64_t next()
+    {
+      const uint64_t result = etl::rotate_left(state[1] * 5U, 7U) * 9U;
+      const uint64_t t      = state[1] << 17U;
+
+      state[2] ^= state[0];
+      state[3] ^= state[1];
+      state[1] ^= state[2];
+      state[0] ^= state[3];
+      state[2] ^= t;
+      state[3] = etl::rotate_left(state[3], 45U);
+
+      return result;
+    }
+
+    uint64_t state[4];
+  };
+
+  //***************************************************************************
+  /// A 32 bit random number generator.
+  /// Uses the 64 bit wyrand algorithm.
+  /// operator() returns the upper 32 bits of each 64 bit result.
+  /// fill() uses both halves of each 64 bit result.
+  /// https://github.com/wangyi-fudan/wyhash
+  //***************************************************************************
+  class random_wyrand : public random
+  {
+  public:
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_wyrand()
+    {
+#include "private/diagnostic_useless_cast_push.h"
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n = reinterpret_cast<uintptr_t>(this);
+      value = static_cast<uint64_t>(n);
+#include "private/diagnostic_pop.h"
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_wyrand(uint32_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint32_t seed)
+    {
+      value = seed;
+    }
+
+    //***************************************************************************
+    /// Get the next random_wyrand number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      return static_cast<uint32_t>(next() >> 32U);
+    }
+
+    //***************************************************************************
+    /// Get the next random_wyrand number in a specified inclusive range.
+    //***************************************************************************
+    uint32_t range(uint32_t low, uint32_t high)
+    {
+      return private_random::range(*this, low, high);
+    }
+
+    //***************************************************************************
+    /// Fills the span with random numbers.
+    /// Each 64 bit result supplies two values, upper half first.
+    //***************************************************************************
+    void fill(etl::span<uint32_t> values)
+    {
+      size_t i = 0UL;
+
+      for (; (i + 1UL) < values.size(); i += 2UL)
+      {
+        const uint64_t n = next();
+        values[i]       = static_cast<uint32_t>(n >> 32U);
+        values[i + 1UL] = static_cast<uint32_t>(n);
+      }
+
+      if (i < values.size())
+      {
+        values[i] = random_wyrand::operator()();
+      }
+    }
+
+    //***************************************************************************
+    /// Fills the span with random numbers in the range [0, 1).
+    /// Each 64 bit result supplies two values, upper half first.
+    //***************************************************************************
+    void fill(etl::span<float> values)
+    {
+      size_t i = 0UL;
+
+      for (; (i + 1UL) < values.size(); i += 2UL)
+      {
+        const uint64_t n = next();
+        values[i]       = private_random::to_unit_float(static_cast<uint32_t>(n >> 32U));
+        values[i + 1UL] = private_random::to_unit_float(static_cast<uint32_t>(n));
+      }
+
+      if (i < values.size())
+      {
+        values[i] = private_random::to_unit_float(random_wyrand::operator()());
+      }
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Get the next 64 bit result.
+    /// The 128 bit product is folded by XORing its two halves.
+    //***************************************************************************
+    uint64_t next()
+    {
+      value += increment;
+
+      const uint64_t a = value;
+      const uint64_t b = value ^ multiplier;
+
+      const uint64_t a_lo = a & 0xFFFFFFFFULL;
+      const uint64_t a_hi = a >> 32U;
+      const uint64_t b_lo = b & 0xFFFFFFFFULL;
+      const uint64_t b_hi = b >> 32U;
+
+      const uint64_t lo_lo = a_lo * b_lo;
+      const uint64_t hi_lo = a_hi * b_lo;
+      const uint64_t lo_hi = a_lo * b_hi;
+      const uint64_t hi_hi = a_hi * b_hi;
+
+      const uint64_t middle = (lo_lo >> 32U) + (hi_lo & 0xFFFFFFFFULL) + (lo_hi & 0xFFFFFFFFULL);
+
+      const uint64_t low  = (lo_lo & 0xFFFFFFFFULL) | (middle << 32U);
+      const uint64_t high = hi_hi + (hi_lo >> 32U) + (lo_hi >> 32U) + (middle >> 32U);
+
+      return low ^ high;
+    }
+
+    static ETL_CONSTANT uint64_t increment  = 0xA0761D6478BD642FULL;
+    static ETL_CONSTANT uint64_t multiplier = 0xE7037ED1A0B428DBULL;
+
+    uint64_t value;
+  };
 #endif
 
 #if ETL_USING_8BIT_TYPES
@@ -575,12 +1052,23 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1UL;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
+      return private_random::range(*this, low, high);
+    }
 
-      return n;
+    //***************************************************************************
+    /// Fills the span with random numbers.
+    //***************************************************************************
+    void fill(etl::span<uint32_t> values)
+    {
+      private_random::fill(*this, values);
+    }
+
+    //***************************************************************************
+    /// Fills the span with random numbers in the range [0, 1).
+    //***************************************************************************
+    void fill(etl::span<float> values)
+    {
+      private_random::fill(*this, values);
     }
 
   private:
@@ -315,6 +315,11 @@ namespace etl
 #endif
 
 #if ETL_USING_CPP11 && ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// A pool of messages with atomic reference counts.
+  /// When used with etl::fixed_sized_memory_block_allocator_atomic, messages
+  /// may be shared and released across threads without a pool lock.
+  //***************************************************************************
   using  atomic_counted_message_pool = reference_counted_message_pool<etl::atomic_int>;
 #endif
 }
@@ -80,6 +80,55 @@ namespace etl
     ETL_NODISCARD virtual int32_t get_reference_count() const = 0;
   };
 
+  namespace private_reference_counted_object
+  {
+    //*************************************************************************
+    /// Increments a counter.
+    //*************************************************************************
+    template <typename TCounter>
+    void increment(TCounter& counter)
+    {
+      ++counter;
+    }
+
+    //*************************************************************************
+    /// Decrements a counter and returns the new value.
+    //*************************************************************************
+    template <typename TCounter>
+    int32_t decrement(TCounter& counter)
+    {
+      ETL_ASSERT(counter > 0, ETL_ERROR(reference_count_overrun));
+
+      return int32_t(--counter);
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    /// Increments an atomic counter.
+    /// A new reference can only be made from an existing one, so no ordering is required.
+    //*************************************************************************
+    template <typename T>
+    void increment(etl::atomic<T>& counter)
+    {
+      counter.fetch_add(1, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Decrements an atomic counter and returns the new value.
+    /// Acquire/release ensures that all uses of the object happen before the last release.
+    //*************************************************************************
+    template <typename T>
+    int32_t decrement(etl::atomic<T>& counter)
+    {
+      const T previous = counter.fetch_sub(1, etl::memory_order_acq_rel);
+
+      ETL_ASSERT(previous > 0, ETL_ERROR(reference_count_overrun));
+
+      return int32_t(previous - 1);
+    }
+#endif
+  }
+
   //***************************************************************************
   /// A specific type of reference counter.
   //***************************************************************************
@@ -109,7 +158,7 @@ namespace etl
     //***************************************************************************
     virtual void increment_reference_count() ETL_OVERRIDE
     {
-      ++reference_count;
+      private_reference_counted_object::increment(reference_count);
     }
 
     //***************************************************************************
@@ -117,9 +166,7 @@ namespace etl
     //***************************************************************************
     ETL_NODISCARD virtual int32_t decrement_reference_count() ETL_OVERRIDE
     {
-      ETL_ASSERT(reference_count > 0, ETL_ERROR(reference_count_overrun));
-
-      return int32_t(--reference_count);
+      return private_reference_counted_object::decrement(reference_count);
     }
 
     //***************************************************************************
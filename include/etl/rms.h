@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/statistics_sums.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -109,7 +111,7 @@ namespace etl
     //*********************************
     void add(TInput value)
     {
-      sum_of_squares += TCalc(value * value);
+      sum_of_squares += TCalc(value) * TCalc(value);
       ++counter;
       recalculate = true;
     }
@@ -127,6 +129,28 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a span of values.
+    //*********************************
+    void add(etl::span<const TInput> values)
+    {
+      typedef typename private_statistics::bulk_sum_type<calc_t>::type sum_t;
+
+      sum_of_squares += calc_t(private_statistics::lane_sum_of_squares<sum_t>(values.data(), values.size()));
+      counter += uint32_t(values.size());
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Adds the partial result of another rms.
+    //*********************************
+    void merge(const rms& other)
+    {
+      sum_of_squares += other.sum_of_squares;
+      counter += other.counter;
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
@@ -0,0 +1,1219 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ROARING_BITMAP_INCLUDED
+#define ETL_ROARING_BITMAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "bit.h"
+#include "functional.h"
+#include "iterator.h"
+#include "vector.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup roaring_bitmap roaring_bitmap
+/// A fixed capacity compressed bitmap of 32 bit values.
+/// Values are grouped into chunks of 65536 by their upper 16 bits. Each
+/// chunk that holds a value is stored in a container that is either a
+/// sorted array of values, a 65536 bit bitmap, or a sorted array of runs.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for roaring bitmaps.
+  ///\ingroup roaring_bitmap
+  //***************************************************************************
+  class roaring_bitmap_exception : public etl::exception
+  {
+  public:
+
+    roaring_bitmap_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// All of the containers are in use.
+  ///\ingroup roaring_bitmap
+  //***************************************************************************
+  class roaring_bitmap_full : public etl::roaring_bitmap_exception
+  {
+  public:
+
+    roaring_bitmap_full(string_type file_name_, numeric_type line_number_)
+      : etl::roaring_bitmap_exception(ETL_ERROR_TEXT("roaring_bitmap:full", ETL_ROARING_BITMAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_roaring_bitmap
+  {
+    static ETL_CONSTANT uint32_t Values_Per_Container = 65536U;
+    static ETL_CONSTANT uint32_t Max_Array_Size       = 4096U;
+    static ETL_CONSTANT uint32_t Words_Per_Bitmap     = 1024U;
+    static ETL_CONSTANT uint32_t Max_Runs             = 2048U;
+
+    /// Returned when a container has no more values.
+    static ETL_CONSTANT uint32_t npos = Values_Per_Container;
+
+    //*************************************************************************
+    /// A run of consecutive values. The last value is inclusive.
+    //*************************************************************************
+    struct run_type
+    {
+      uint16_t first;
+      uint16_t last;
+    };
+
+    //*************************************************************************
+    /// Compares a value with the last value of a run.
+    //*************************************************************************
+    struct run_last_less
+    {
+      bool operator ()(const run_type& run, uint32_t value) const
+      {
+        return run.last < value;
+      }
+    };
+
+    //*************************************************************************
+    /// The values of one chunk.
+    /// An array holds up to Max_Array_Size sorted values.
+    /// A bitmap holds more than Max_Array_Size values.
+    /// Runs are only created by run_optimize(), and are converted back to an
+    /// array or bitmap before being modified.
+    //*************************************************************************
+    class container
+    {
+    public:
+
+      enum
+      {
+        Array,
+        Bitmap,
+        Run
+      };
+
+      //***********************************************************************
+      /// Makes an empty array container.
+      //***********************************************************************
+      void clear()
+      {
+        type        = Array;
+        cardinality = 0U;
+        n_runs      = 0U;
+      }
+
+      //***********************************************************************
+      /// Checks if the container holds the value.
+      //***********************************************************************
+      bool contains(uint32_t value) const
+      {
+        switch (type)
+        {
+          case Array:
+          {
+            const uint16_t* itr = etl::lower_bound(values, values + cardinality, value);
+
+            return (itr != (values + cardinality)) && (*itr == value);
+          }
+
+          case Bitmap:
+          {
+            return (words[value >> 6U] & (uint64_t(1U) << (value & 63U))) != 0U;
+          }
+
+          default:
+          {
+            const run_type* itr = etl::lower_bound(runs, runs + n_runs, value, run_last_less());
+
+            return (itr != (runs + n_runs)) && (itr->first <= value);
+          }
+        }
+      }
+
+      //***********************************************************************
+      /// Gets the smallest value that is not less than 'value'.
+      ///\returns The value, or npos if there is none.
+      //***********************************************************************
+      uint32_t next_from(uint32_t value) const
+      {
+        if (value >= Values_Per_Container)
+        {
+          return npos;
+        }
+
+        switch (type)
+        {
+          case Array:
+          {
+            const uint16_t* itr = etl::lower_bound(values, values + cardinality, value);
+
+            return (itr != (values + cardinality)) ? uint32_t(*itr) : npos;
+          }
+
+          case Bitmap:
+          {
+            uint32_t index = value >> 6U;
+            uint64_t word  = words[index] & (~uint64_t(0U) << (value & 63U));
+
+            while (word == 0U)
+            {
+              if (++index == Words_Per_Bitmap)
+              {
+                return npos;
+              }
+
+              word = words[index];
+            }
+
+            return (index << 6U) + uint32_t(etl::countr_zero(word));
+          }
+
+          default:
+          {
+            const run_type* itr = etl::lower_bound(runs, runs + n_runs, value, run_last_less());
+
+            return (itr != (runs + n_runs)) ? etl::max(uint32_t(itr->first), value) : npos;
+          }
+        }
+      }
+
+      //***********************************************************************
+      /// Calls the function for each value, in ascending order.
+      /// 'high' holds the upper 16 bits of the values.
+      //***********************************************************************
+      template <typename TFunction>
+      void for_each(uint32_t high, TFunction& function) const
+      {
+        switch (type)
+        {
+          case Array:
+          {
+            for (uint32_t i = 0U; i < cardinality; ++i)
+            {
+              function(high | values[i]);
+            }
+            break;
+          }
+
+          case Bitmap:
+          {
+            for (uint32_t i = 0U; i < Words_Per_Bitmap; ++i)
+            {
+              uint64_t word = words[i];
+
+              while (word != 0U)
+              {
+                function(high | ((i << 6U) + uint32_t(etl::countr_zero(word))));
+
+                // Clear the lowest set bit.
+                word &= word - 1U;
+              }
+            }
+            break;
+          }
+
+          default:
+          {
+            for (uint32_t i = 0U; i < n_runs; ++i)
+            {
+              for (uint32_t value = runs[i].first; value <= runs[i].last; ++value)
+              {
+                function(high | value);
+              }
+            }
+            break;
+          }
+        }
+      }
+
+      //***********************************************************************
+      /// Adds a value to an array or bitmap.
+      /// An array must have space for the value.
+      ///\returns <b>true</b> if the value was added.
+      //***********************************************************************
+      bool add(uint32_t value)
+      {
+        if (type == Bitmap)
+        {
+          uint64_t&      word = words[value >> 6U];
+          const uint64_t bit  = uint64_t(1U) << (value & 63U);
+
+          if ((word & bit) != 0U)
+          {
+            return false;
+          }
+
+          word |= bit;
+        }
+        else
+        {
+          uint16_t* itr = etl::lower_bound(values, values + cardinality, value);
+
+          if ((itr != (values + cardinality)) && (*itr == value))
+          {
+            return false;
+          }
+
+          etl::copy_backward(itr, values + cardinality, values + cardinality + 1U);
+          *itr = uint16_t(value);
+        }
+
+        ++cardinality;
+
+        return true;
+      }
+
+      //***********************************************************************
+      /// Removes a value from an array or bitmap.
+      ///\returns <b>true</b> if the value was removed.
+      //***********************************************************************
+      bool remove(uint32_t value)
+      {
+        if (type == Bitmap)
+        {
+          uint64_t&      word = words[value >> 6U];
+          const uint64_t bit  = uint64_t(1U) << (value & 63U);
+
+          if ((word & bit) == 0U)
+          {
+            return false;
+          }
+
+          word &= ~bit;
+        }
+        else
+        {
+          uint16_t* itr = etl::lower_bound(values, values + cardinality, value);
+
+          if ((itr == (values + cardinality)) || (*itr != value))
+          {
+            return false;
+          }
+
+          etl::copy(itr + 1U, values + cardinality, itr);
+        }
+
+        --cardinality;
+
+        return true;
+      }
+
+      //***********************************************************************
+      /// Copies the values of another container.
+      //***********************************************************************
+      void assign(const container& other)
+      {
+        type        = other.type;
+        cardinality = other.cardinality;
+        n_runs      = other.n_runs;
+
+        switch (type)
+        {
+          case Array:  { etl::copy(other.values, other.values + cardinality, values); break; }
+          case Bitmap: { etl::copy(other.words,  other.words + Words_Per_Bitmap, words); break; }
+          default:     { etl::copy(other.runs,   other.runs + n_runs, runs); break; }
+        }
+      }
+
+      uint8_t  type;
+      uint32_t cardinality;
+      uint32_t n_runs;
+
+      union
+      {
+        uint16_t values[Max_Array_Size];
+        uint64_t words[Words_Per_Bitmap];
+        run_type runs[Max_Runs];
+      };
+    };
+
+    //*************************************************************************
+    /// Reads the values of a container as successive 64 bit words.
+    //*************************************************************************
+    class word_reader
+    {
+    public:
+
+      explicit word_reader(const container& c_)
+        : c(c_)
+        , position(0U)
+      {
+      }
+
+      //***********************************************************************
+      /// Gets the word at 'index'. Must be called with ascending indexes.
+      //***********************************************************************
+      uint64_t word(uint32_t index)
+      {
+        switch (c.type)
+        {
+          case container::Array:
+          {
+            uint64_t result = 0U;
+
+            while ((position < c.cardinality) && ((uint32_t(c.values[position]) >> 6U) == index))
+            {
+              result |= uint64_t(1U) << (c.values[position] & 63U);
+              ++position;
+            }
+
+            return result;
+          }
+
+          case container::Bitmap:
+          {
+            return c.words[index];
+          }
+
+          default:
+          {
+            uint64_t       result = 0U;
+            const uint32_t first  = index << 6U;
+            const uint32_t last   = first + 63U;
+
+            while ((position < c.n_runs) && (c.runs[position].first <= last))
+            {
+              const uint32_t from = etl::max(uint32_t(c.runs[position].first), first) - first;
+              const uint32_t to   = etl::min(uint32_t(c.runs[position].last), last) - first;
+
+              result |= (~uint64_t(0U) >> (63U - (to - from))) << from;
+
+              if (c.runs[position].last > last)
+              {
+                // The run continues into the next word.
+                break;
+              }
+
+              ++position;
+            }
+
+            return result;
+          }
+        }
+      }
+
+    private:
+
+      const container& c;
+      uint32_t         position;
+    };
+
+    //*************************************************************************
+    /// Combines two containers word by word.
+    /// The result is an array if it fits, otherwise a bitmap.
+    //*************************************************************************
+    template <typename TOperation>
+    void combine_words(const container& lhs, const container& rhs, TOperation operation, container& result)
+    {
+      uint32_t cardinality = 0U;
+
+      {
+        word_reader lhs_reader(lhs);
+        word_reader rhs_reader(rhs);
+
+        for (uint32_t i = 0U; i < Words_Per_Bitmap; ++i)
+        {
+          cardinality += uint32_t(etl::popcount(operation(lhs_reader.word(i), rhs_reader.word(i))));
+        }
+      }
+
+      word_reader lhs_reader(lhs);
+      word_reader rhs_reader(rhs);
+
+      result.clear();
+
+      if (cardinality > Max_Array_Size)
+      {
+        result.type = container::Bitmap;
+
+        for (uint32_t i = 0U; i < Words_Per_Bitmap; ++i)
+        {
+          result.words[i] = operation(lhs_reader.word(i), rhs_reader.word(i));
+        }
+      }
+      else
+      {
+        uint32_t n = 0U;
+
+        for (uint32_t i = 0U; (i < Words_Per_Bitmap) && (n < cardinality); ++i)
+        {
+          uint64_t word = operation(lhs_reader.word(i), rhs_reader.word(i));
+
+          while (word != 0U)
+          {
+            result.values[n++] = uint16_t((i << 6U) + uint32_t(etl::countr_zero(word)));
+            word &= word - 1U;
+          }
+        }
+      }
+
+      result.cardinality = cardinality;
+    }
+
+    //*************************************************************************
+    /// Converts a container to an array, or a bitmap if it does not fit.
+    //*************************************************************************
+    inline void to_array_or_bitmap(const container& source, container& result)
+    {
+      combine_words(source, source, etl::bit_and<uint64_t>(), result);
+    }
+
+    //*************************************************************************
+    /// Converts a container to a bitmap.
+    //*************************************************************************
+    inline void to_bitmap(const container& source, container& result)
+    {
+      word_reader reader(source);
+
+      result.clear();
+      result.type        = container::Bitmap;
+      result.cardinality = source.cardinality;
+
+      for (uint32_t i = 0U; i < Words_Per_Bitmap; ++i)
+      {
+        result.words[i] = reader.word(i);
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the runs of a container, word by word.
+    /// Calls function(first, last) for each run.
+    ///\returns The number of runs.
+    //*************************************************************************
+    template <typename TFunction>
+    uint32_t find_runs(const container& source, TFunction& function)
+    {
+      word_reader reader(source);
+
+      uint32_t n_runs = 0U;
+      uint32_t first  = 0U;
+      uint32_t next   = 0U; // One past the last value of the open run.
+
+      for (uint32_t i = 0U; i < Words_Per_Bitmap; ++i)
+      {
+        const uint64_t word = reader.word(i);
+        uint32_t       bit  = 0U;
+
+        while ((bit < 64U) && ((word >> bit) != 0U))
+        {
+          bit += uint32_t(etl::countr_zero(uint64_t(word >> bit)));
+
+          const uint32_t length = uint32_t(etl::countr_one(uint64_t(word >> bit)));
+          const uint32_t start  = (i << 6U) + bit;
+
+          if ((n_runs == 0U) || (start != next))
+          {
+            // Close the open run and start a new one.
+            if (n_runs != 0U)
+            {
+              function(first, next - 1U);
+            }
+
+            first = start;
+            ++n_runs;
+          }
+
+          next = start + length;
+          bit += length;
+        }
+      }
+
+      if (n_runs != 0U)
+      {
+        function(first, next - 1U);
+      }
+
+      return n_runs;
+    }
+
+    //*************************************************************************
+    /// Functors for find_runs.
+    //*************************************************************************
+    struct ignore_runs
+    {
+      void operator ()(uint32_t, uint32_t) const
+      {
+      }
+    };
+
+    struct store_runs
+    {
+      explicit store_runs(container& c_)
+        : c(c_)
+      {
+      }
+
+      void operator ()(uint32_t first, uint32_t last)
+      {
+        c.runs[c.n_runs].first = uint16_t(first);
+        c.runs[c.n_runs].last  = uint16_t(last);
+        ++c.n_runs;
+      }
+
+      container& c;
+    };
+
+    //*************************************************************************
+    /// The intersection of two containers.
+    //*************************************************************************
+    inline void intersection(const container& lhs, const container& rhs, container& result)
+    {
+      result.clear();
+
+      if ((lhs.type == container::Array) && (rhs.type == container::Array))
+      {
+        // Merge two sorted arrays.
+        uint32_t i = 0U;
+        uint32_t j = 0U;
+
+        while ((i < lhs.cardinality) && (j < rhs.cardinality))
+        {
+          if (lhs.values[i] < rhs.values[j])
+          {
+            ++i;
+          }
+          else if (rhs.values[j] < lhs.values[i])
+          {
+            ++j;
+          }
+          else
+          {
+            result.values[result.cardinality++] = lhs.values[i];
+            ++i;
+            ++j;
+          }
+        }
+      }
+      else if ((lhs.type == container::Array) || (rhs.type == container::Array))
+      {
+        // Keep the array values that are in the other container.
+        const container& array = (lhs.type == container::Array) ? lhs : rhs;
+        const container& other = (lhs.type == container::Array) ? rhs : lhs;
+
+        for (uint32_t i = 0U; i < array.cardinality; ++i)
+        {
+          if (other.contains(array.values[i]))
+          {
+            result.values[result.cardinality++] = array.values[i];
+          }
+        }
+      }
+      else
+      {
+        combine_words(lhs, rhs, etl::bit_and<uint64_t>(), result);
+      }
+    }
+
+    //*************************************************************************
+    /// The union of two containers.
+    //*************************************************************************
+    inline void set_union(const container& lhs, const container& rhs, container& result)
+    {
+      result.clear();
+
+      if ((lhs.type == container::Array) && (rhs.type == container::Array) && ((lhs.cardinality + rhs.cardinality) <= Max_Array_Size))
+      {
+        // Merge two sorted arrays.
+        uint32_t i = 0U;
+        uint32_t j = 0U;
+
+        while ((i < lhs.cardinality) || (j < rhs.cardinality))
+        {
+          if ((j == rhs.cardinality) || ((i < lhs.cardinality) && (lhs.values[i] < rhs.values[j])))
+          {
+            result.values[result.cardinality++] = lhs.values[i++];
+          }
+          else if ((i == lhs.cardinality) || (rhs.values[j] < lhs.values[i]))
+          {
+            result.values[result.cardinality++] = rhs.values[j++];
+          }
+          else
+          {
+            result.values[result.cardinality++] = lhs.values[i];
+            ++i;
+            ++j;
+          }
+        }
+      }
+      else
+      {
+        combine_words(lhs, rhs, etl::bit_or<uint64_t>(), result);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// A fixed capacity compressed bitmap of 32 bit values.
+  ///\tparam Max_Containers The maximum number of 65536 value chunks that may
+  /// hold values at the same time.
+  ///\ingroup roaring_bitmap
+  //***************************************************************************
+  template <size_t Max_Containers>
+  class roaring_bitmap
+  {
+  private:
+
+    typedef private_roaring_bitmap::container container_type;
+
+  public:
+
+    ETL_STATIC_ASSERT(Max_Containers > 0U, "Max_Containers must be greater than zero");
+    ETL_STATIC_ASSERT(Max_Containers <= 65536U, "Max_Containers must not be greater than 65536");
+
+    typedef uint32_t value_type;
+    typedef size_t   size_type;
+
+    static ETL_CONSTANT size_t MAX_CONTAINERS = Max_Containers;
+
+    //*************************************************************************
+    /// Iterates the values in ascending order.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, value_type, ptrdiff_t, const value_type*, value_type>
+    {
+    public:
+
+      friend class roaring_bitmap;
+
+      const_iterator()
+        : p_bitmap(ETL_NULLPTR)
+        , entry(0U)
+        , low(0U)
+      {
+      }
+
+      value_type operator *() const
+      {
+        return (value_type(p_bitmap->index[entry].key) << 16U) | low;
+      }
+
+      const_iterator& operator ++()
+      {
+        low = p_bitmap->containers[p_bitmap->index[entry].slot].next_from(low + 1U);
+
+        if (low == private_roaring_bitmap::npos)
+        {
+          ++entry;
+          low = (entry < p_bitmap->index.size()) ? p_bitmap->containers[p_bitmap->index[entry].slot].next_from(0U) : 0U;
+        }
+
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_bitmap == rhs.p_bitmap) && (lhs.entry == rhs.entry) && (lhs.low == rhs.low);
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const roaring_bitmap* p_bitmap_, size_t entry_, uint32_t low_)
+        : p_bitmap(p_bitmap_)
+        , entry(entry_)
+        , low(low_)
+      {
+      }
+
+      const roaring_bitmap* p_bitmap;
+      size_t                entry;
+      uint32_t              low;
+    };
+
+    typedef const_iterator iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    roaring_bitmap()
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    roaring_bitmap(const roaring_bitmap& other)
+    {
+      initialise();
+      *this = other;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    roaring_bitmap& operator =(const roaring_bitmap& other)
+    {
+      if (&other != this)
+      {
+        clear();
+
+        for (size_t i = 0U; i < other.index.size(); ++i)
+        {
+          const size_t slot = allocate();
+
+          containers[slot].assign(other.containers[other.index[i].slot]);
+          index.push_back(entry_type(other.index[i].key, slot));
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Adds a value.
+    ///\returns <b>true</b> if the value was added, <b>false</b> if it was
+    /// already present.
+    /// If a new container is needed and none are free, emits an
+    /// etl::roaring_bitmap_full error.
+    //*************************************************************************
+    bool add(value_type value)
+    {
+      const uint16_t key = uint16_t(value >> 16U);
+      const uint32_t low = value & 0xFFFFU;
+
+      typename index_type::iterator itr = find_entry(key);
+
+      if ((itr == index.end()) || (itr->key != key))
+      {
+        ETL_ASSERT_OR_RETURN_VALUE(!free_slots.empty(), ETL_ERROR(roaring_bitmap_full), false);
+
+        itr = index.insert(itr, entry_type(key, allocate()));
+      }
+      else
+      {
+        if (containers[itr->slot].contains(low))
+        {
+          return false;
+        }
+
+        if (containers[itr->slot].type == container_type::Run)
+        {
+          private_roaring_bitmap::to_array_or_bitmap(containers[itr->slot], containers[scratch]);
+          swap_with_scratch(*itr);
+        }
+
+        if ((containers[itr->slot].type == container_type::Array) && (containers[itr->slot].cardinality == private_roaring_bitmap::Max_Array_Size))
+        {
+          private_roaring_bitmap::to_bitmap(containers[itr->slot], containers[scratch]);
+          swap_with_scratch(*itr);
+        }
+      }
+
+      return containers[itr->slot].add(low);
+    }
+
+    //*************************************************************************
+    /// Adds a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+    {
+      while (first != last)
+      {
+        add(value_type(*first));
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes a value.
+    ///\returns <b>true</b> if the value was removed, <b>false</b> if it was
+    /// not present.
+    //*************************************************************************
+    bool remove(value_type value)
+    {
+      const uint16_t key = uint16_t(value >> 16U);
+      const uint32_t low = value & 0xFFFFU;
+
+      typename index_type::iterator itr = find_entry(key);
+
+      if ((itr == index.end()) || (itr->key != key) || !containers[itr->slot].contains(low))
+      {
+        return false;
+      }
+
+      if (containers[itr->slot].type == container_type::Run)
+      {
+        private_roaring_bitmap::to_array_or_bitmap(containers[itr->slot], containers[scratch]);
+        swap_with_scratch(*itr);
+      }
+
+      container_type& c = containers[itr->slot];
+
+      c.remove(low);
+
+      if (c.cardinality == 0U)
+      {
+        release(itr->slot);
+        index.erase(itr);
+      }
+      else if ((c.type == container_type::Bitmap) && (c.cardinality <= private_roaring_bitmap::Max_Array_Size))
+      {
+        private_roaring_bitmap::to_array_or_bitmap(c, containers[scratch]);
+        swap_with_scratch(*itr);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Checks if the value is present.
+    //*************************************************************************
+    bool contains(value_type value) const
+    {
+      const uint16_t key = uint16_t(value >> 16U);
+
+      typename index_type::const_iterator itr = find_entry(key);
+
+      return (itr != index.end()) && (itr->key == key) && containers[itr->slot].contains(value & 0xFFFFU);
+    }
+
+    //*************************************************************************
+    /// The number of values.
+    //*************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < index.size(); ++i)
+      {
+        n += containers[index[i].slot].cardinality;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Checks if there are no values.
+    //*************************************************************************
+    bool empty() const
+    {
+      return index.empty();
+    }
+
+    //*************************************************************************
+    /// The number of containers in use.
+    //*************************************************************************
+    size_t container_count() const
+    {
+      return index.size();
+    }
+
+    //*************************************************************************
+    /// The maximum number of containers.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t max_containers()
+    {
+      return Max_Containers;
+    }
+
+    //*************************************************************************
+    /// Removes all of the values.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < index.size(); ++i)
+      {
+        release(index[i].slot);
+      }
+
+      index.clear();
+    }
+
+    //*************************************************************************
+    /// Converts each container to runs, where that is smaller.
+    /// Containers of runs are converted back when they are modified.
+    //*************************************************************************
+    void run_optimize()
+    {
+      for (size_t i = 0U; i < index.size(); ++i)
+      {
+        container_type& c = containers[index[i].slot];
+
+        if (c.type != container_type::Run)
+        {
+          private_roaring_bitmap::ignore_runs ignore;
+
+          const uint32_t n_runs = private_roaring_bitmap::find_runs(c, ignore);
+
+          // A run takes the space of two array values, and a bitmap that of a full array.
+          const uint32_t current_size = (c.type == container_type::Array) ? c.cardinality : private_roaring_bitmap::Max_Array_Size;
+
+          if ((2U * n_runs) < current_size)
+          {
+            container_type& result = containers[scratch];
+            private_roaring_bitmap::store_runs store(result);
+
+            result.clear();
+            result.type        = container_type::Run;
+            result.cardinality = c.cardinality;
+            private_roaring_bitmap::find_runs(c, store);
+
+            swap_with_scratch(index[i]);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Keeps only the values that are also in 'other'.
+    //*************************************************************************
+    roaring_bitmap& operator &=(const roaring_bitmap& other)
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < index.size(); ++i)
+      {
+        typename index_type::const_iterator itr = other.find_entry(index[i].key);
+
+        if ((itr != other.index.end()) && (itr->key == index[i].key))
+        {
+          private_roaring_bitmap::intersection(containers[index[i].slot], other.containers[itr->slot], containers[scratch]);
+
+          if (containers[scratch].cardinality != 0U)
+          {
+            swap_with_scratch(index[i]);
+            index[n++] = index[i];
+            continue;
+          }
+        }
+
+        release(index[i].slot);
+      }
+
+      index.resize(n);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Adds the values that are in 'other'.
+    /// If a new container is needed and none are free, emits an
+    /// etl::roaring_bitmap_full error.
+    //*************************************************************************
+    roaring_bitmap& operator |=(const roaring_bitmap& other)
+    {
+      if (&other == this)
+      {
+        return *this;
+      }
+
+      for (size_t i = 0U; i < other.index.size(); ++i)
+      {
+        const entry_type& other_entry = other.index[i];
+
+        typename index_type::iterator itr = find_entry(other_entry.key);
+
+        if ((itr != index.end()) && (itr->key == other_entry.key))
+        {
+          private_roaring_bitmap::set_union(containers[itr->slot], other.containers[other_entry.slot], containers[scratch]);
+          swap_with_scratch(*itr);
+        }
+        else
+        {
+          ETL_ASSERT_OR_RETURN_VALUE(!free_slots.empty(), ETL_ERROR(roaring_bitmap_full), *this);
+
+          const size_t slot = allocate();
+
+          containers[slot].assign(other.containers[other_entry.slot]);
+          index.insert(itr, entry_type(other_entry.key, slot));
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Calls the function for each value, in ascending order.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each(TFunction function) const
+    {
+      for (size_t i = 0U; i < index.size(); ++i)
+      {
+        containers[index[i].slot].for_each(value_type(index[i].key) << 16U, function);
+      }
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Iterator to the smallest value.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return index.empty() ? end() : const_iterator(this, 0U, containers[index[0].slot].next_from(0U));
+    }
+
+    //*************************************************************************
+    /// Iterator to one past the largest value.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, index.size(), 0U);
+    }
+
+    //*************************************************************************
+    /// Checks if two bitmaps hold the same values.
+    //*************************************************************************
+    friend bool operator ==(const roaring_bitmap& lhs, const roaring_bitmap& rhs)
+    {
+      return (lhs.count() == rhs.count()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend bool operator !=(const roaring_bitmap& lhs, const roaring_bitmap& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Maps the upper 16 bits of the values to a container slot.
+    //*************************************************************************
+    struct entry_type
+    {
+      entry_type()
+        : key(0U)
+        , slot(0U)
+      {
+      }
+
+      entry_type(uint16_t key_, size_t slot_)
+        : key(key_)
+        , slot(slot_)
+      {
+      }
+
+      uint16_t key;
+      size_t   slot;
+    };
+
+    struct entry_key_less
+    {
+      bool operator ()(const entry_type& entry, uint16_t key) const
+      {
+        return entry.key < key;
+      }
+    };
+
+    typedef etl::vector<entry_type, Max_Containers> index_type;
+
+    //*************************************************************************
+    void initialise()
+    {
+      // The last slot starts as the scratch container.
+      for (size_t i = Max_Containers; i != 0U; --i)
+      {
+        free_slots.push_back(i - 1U);
+      }
+
+      scratch = Max_Containers;
+    }
+
+    //*************************************************************************
+    typename index_type::iterator find_entry(uint16_t key)
+    {
+      return etl::lower_bound(index.begin(), index.end(), key, entry_key_less());
+    }
+
+    //*************************************************************************
+    typename index_type::const_iterator find_entry(uint16_t key) const
+    {
+      return etl::lower_bound(index.begin(), index.end(), key, entry_key_less());
+    }
+
+    //*************************************************************************
+    /// Gets an empty container.
+    //*************************************************************************
+    size_t allocate()
+    {
+      const size_t slot = free_slots.back();
+      free_slots.pop_back();
+
+      containers[slot].clear();
+
+      return slot;
+    }
+
+    //*************************************************************************
+    void release(size_t slot)
+    {
+      free_slots.push_back(slot);
+    }
+
+    //*************************************************************************
+    /// Makes the scratch container the entry's container, and the entry's
+    /// old container the scratch container.
+    //*************************************************************************
+    void swap_with_scratch(entry_type& entry)
+    {
+      const size_t slot = entry.slot;
+
+      entry.slot = scratch;
+      scratch    = slot;
+    }
+
+    index_type                            index;
+    etl::vector<size_t, Max_Containers>   free_slots;
+    size_t                                scratch;
+    container_type                        containers[Max_Containers + 1U];
+  };
+
+  template <size_t Max_Containers>
+  ETL_CONSTANT size_t roaring_bitmap<Max_Containers>::MAX_CONTAINERS;
+}
+
+#endif
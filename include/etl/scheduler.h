@@ -37,7 +37,13 @@ SOFTWARE.
 #include "task.h"
 #include "type_traits.h"
 #include "function.h"
+#include "atomic.h"
+#include "power.h"
+#include "bit.h"
+#include "algorithm.h"
+#include "static_assert.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace etl
@@ -94,6 +100,19 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// 'Invalid worker' exception.
+  //***************************************************************************
+  class scheduler_invalid_worker_exception : public etl::scheduler_exception
+  {
+  public:
+
+    scheduler_invalid_worker_exception(string_type file_name_, numeric_type line_number_)
+      : etl::scheduler_exception(ETL_ERROR_TEXT("scheduler:invalid worker", ETL_SCHEDULER_FILE_ID"D"), file_name_, line_number_)
+    {
+    }
+  };
+
   //***************************************************************************
   /// Sequential Single.
   /// A policy the scheduler can use to decide what to do next.
@@ -222,6 +241,238 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Highest Priority Ready.
+  /// A policy the scheduler can use to decide what to do next.
+  /// Calls the highest priority task that is marked as ready.
+  /// Tasks are polled for work when they are added and after each time they
+  /// process work. A task that is given new work while it is not ready must be
+  /// marked as ready by calling the scheduler's set_task_ready().
+  /// Finding the next task to call is O(1), regardless of the number of tasks.
+  /// The scheduler sizes the policy from its MAX_TASKS, which must not be more than 1024.
+  /// If ETL_HAS_ATOMIC is set, the ready flags are atomic, and set_task_ready()
+  /// may be called from an interrupt or another thread, as long as tasks are
+  /// not being added at the same time. If not, set_task_ready() must only be
+  /// called from the scheduler's thread.
+  //***************************************************************************
+  struct scheduler_policy_highest_priority_ready
+  {
+  };
+
+  namespace private_scheduler
+  {
+    //*************************************************************************
+    /// The implementation of scheduler_policy_highest_priority_ready.
+    //*************************************************************************
+    template <size_t MAX_TASKS_>
+    class highest_priority_ready_policy
+    {
+    public:
+
+      highest_priority_ready_policy()
+        : n_tasks(0U)
+      {
+        clear_all();
+      }
+
+      bool schedule_tasks(etl::ivector<etl::task*>& task_list)
+      {
+        if (task_list.size() != n_tasks)
+        {
+          poll_all_tasks(task_list);
+        }
+
+        const word_t summary_bits = load(summary);
+
+        if (summary_bits == 0U)
+        {
+          return true;
+        }
+
+        // The task list is in descending priority order, so the lowest ready index is the highest priority.
+        const size_t word  = static_cast<size_t>(etl::countr_zero(summary_bits));
+        const size_t index = (word * Bits_Per_Word) + static_cast<size_t>(etl::countr_zero(load(ready_words[word])));
+
+        etl::task& task = *(task_list[index]);
+
+        task.task_process_work();
+
+        // Clear the flag before asking for work, so that work given after the
+        // question is flagged again rather than lost.
+        clear_ready(index);
+
+        if (task.task_request_work() > 0)
+        {
+          set_ready(index);
+        }
+
+        return false;
+      }
+
+      void set_task_ready(etl::ivector<etl::task*>& task_list, etl::task& task)
+      {
+        // If tasks have been added, the next schedule clears this and polls all of them.
+        typedef etl::ivector<etl::task*>::iterator iterator;
+
+        iterator itask = etl::lower_bound(task_list.begin(), task_list.end(), task.get_task_priority(), compare_priority());
+
+        while ((itask != task_list.end()) && ((*itask)->get_task_priority() == task.get_task_priority()))
+        {
+          if (*itask == &task)
+          {
+            set_ready(static_cast<size_t>(etl::distance(task_list.begin(), itask)));
+            break;
+          }
+
+          ++itask;
+        }
+      }
+
+    private:
+
+      typedef uint32_t word_t;
+
+#if ETL_HAS_ATOMIC
+      typedef etl::atomic<word_t> flags_t;
+#else
+      typedef word_t flags_t;
+#endif
+
+      static ETL_CONSTANT size_t Bits_Per_Word = 32U;
+      static ETL_CONSTANT size_t N_Words       = (MAX_TASKS_ + Bits_Per_Word - 1U) / Bits_Per_Word;
+
+      ETL_STATIC_ASSERT(N_Words <= Bits_Per_Word, "MAX_TASKS must not be more than 1024");
+
+      //*******************************************
+      // Used to find tasks in descending priority.
+      //*******************************************
+      struct compare_priority
+      {
+        bool operator()(const etl::task* ptask, etl::task_priority_t priority) const
+        {
+          return ptask->get_task_priority() > priority;
+        }
+      };
+
+      void poll_all_tasks(etl::ivector<etl::task*>& task_list)
+      {
+        clear_all();
+
+        n_tasks = task_list.size();
+
+        for (size_t index = 0UL; index < n_tasks; ++index)
+        {
+          if (task_list[index]->task_request_work() > 0)
+          {
+            set_ready(index);
+          }
+        }
+      }
+
+      void clear_all()
+      {
+        store(summary, 0U);
+
+        for (size_t i = 0UL; i < N_Words; ++i)
+        {
+          store(ready_words[i], 0U);
+        }
+      }
+
+      void set_ready(size_t index)
+      {
+        const size_t word = index / Bits_Per_Word;
+
+        // The task's flag is set before the summary, so a set summary flag always has a task flag to find.
+        fetch_or(ready_words[word], word_t(1U) << (index % Bits_Per_Word));
+        fetch_or(summary,           word_t(1U) << word);
+      }
+
+      void clear_ready(size_t index)
+      {
+        const size_t word = index / Bits_Per_Word;
+        const word_t mask = static_cast<word_t>(~(word_t(1U) << (index % Bits_Per_Word)));
+
+        if ((fetch_and(ready_words[word], mask) & mask) == 0U)
+        {
+          fetch_and(summary, static_cast<word_t>(~(word_t(1U) << word)));
+
+          // Another task in the word may have been made ready in the meantime.
+          if (load(ready_words[word]) != 0U)
+          {
+            fetch_or(summary, word_t(1U) << word);
+          }
+        }
+      }
+
+      static word_t load(const flags_t& flags)
+      {
+#if ETL_HAS_ATOMIC
+        return flags.load();
+#else
+        return flags;
+#endif
+      }
+
+      static void store(flags_t& flags, word_t value)
+      {
+#if ETL_HAS_ATOMIC
+        flags.store(value);
+#else
+        flags = value;
+#endif
+      }
+
+      static word_t fetch_or(flags_t& flags, word_t value)
+      {
+#if ETL_HAS_ATOMIC
+        return flags.fetch_or(value);
+#else
+        const word_t previous = flags;
+        flags = previous | value;
+        return previous;
+#endif
+      }
+
+      static word_t fetch_and(flags_t& flags, word_t value)
+      {
+#if ETL_HAS_ATOMIC
+        return flags.fetch_and(value);
+#else
+        const word_t previous = flags;
+        flags = previous & value;
+        return previous;
+#endif
+      }
+
+      flags_t ready_words[N_Words];
+      flags_t summary;
+      size_t  n_tasks;
+    };
+
+    template <size_t MAX_TASKS_>
+    ETL_CONSTANT size_t highest_priority_ready_policy<MAX_TASKS_>::Bits_Per_Word;
+
+    template <size_t MAX_TASKS_>
+    ETL_CONSTANT size_t highest_priority_ready_policy<MAX_TASKS_>::N_Words;
+
+    //*************************************************************************
+    /// The policy type that a scheduler derives from.
+    /// Policies that are sized by the number of tasks are given the scheduler's.
+    //*************************************************************************
+    template <typename TSchedulerPolicy, size_t MAX_TASKS_>
+    struct scheduler_policy_type
+    {
+      typedef TSchedulerPolicy type;
+    };
+
+    template <size_t MAX_TASKS_>
+    struct scheduler_policy_type<etl::scheduler_policy_highest_priority_ready, MAX_TASKS_>
+    {
+      typedef highest_priority_ready_policy<MAX_TASKS_> type;
+    };
+  }
+
   //***************************************************************************
   /// Scheduler base.
   //***************************************************************************
@@ -273,7 +524,7 @@ namespace etl
     //*******************************************
     /// Force the scheduler to exit.
     //*******************************************
-    void exit_scheduler()
+    virtual void exit_scheduler()
     {
       scheduler_exit = true;
     }
@@ -354,8 +605,12 @@ namespace etl
   /// Scheduler.
   //***************************************************************************
   template <typename TSchedulerPolicy, size_t MAX_TASKS_>
-  class scheduler : public etl::ischeduler, protected TSchedulerPolicy
+  class scheduler : public etl::ischeduler, protected private_scheduler::scheduler_policy_type<TSchedulerPolicy, MAX_TASKS_>::type
   {
+  private:
+
+    typedef typename private_scheduler::scheduler_policy_type<TSchedulerPolicy, MAX_TASKS_>::type policy_t;
+
   public:
 
     enum
@@ -368,6 +623,15 @@ namespace etl
     {
     }
 
+    //*******************************************
+    /// Mark a task as ready to process work.
+    /// Only used by policies that do not poll every task.
+    //*******************************************
+    void set_task_ready(etl::task& task)
+    {
+      policy_t::set_task_ready(task_list, task);
+    }
+
     //*******************************************
     /// Start the scheduler.
     //*******************************************
@@ -381,7 +645,7 @@ namespace etl
       {
         if (scheduler_running)
         {
-          bool idle = TSchedulerPolicy::schedule_tasks(task_list);
+          bool idle = policy_t::schedule_tasks(task_list);
 
           if (p_watchdog_callback)
           {
@@ -401,6 +665,294 @@ namespace etl
     typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
     task_list_t task_list;
   };
+
+#if ETL_USING_CPP11 && ETL_HAS_ATOMIC
+  namespace private_scheduler
+  {
+    //*************************************************************************
+    /// A bounded Chase-Lev work stealing deque of task indexes.
+    /// The owning worker pushes and takes at the bottom.
+    /// Any other worker may steal from the top.
+    //*************************************************************************
+    template <size_t Capacity>
+    class work_stealing_deque
+    {
+    public:
+
+      ETL_STATIC_ASSERT(etl::is_power_of_2<Capacity>::value, "Capacity must be a power of 2");
+
+      //*******************************************
+      /// Constructor.
+      //*******************************************
+      work_stealing_deque()
+        : top(0U)
+        , bottom(0U)
+      {
+        for (size_t i = 0UL; i < Capacity; ++i)
+        {
+          buffer[i].store(0U, etl::memory_order_relaxed);
+        }
+      }
+
+      //*******************************************
+      /// Pushes a task index to the bottom.
+      /// Only called by the owning worker.
+      //*******************************************
+      bool push(size_t index)
+      {
+        const size_t b = bottom.load(etl::memory_order_relaxed);
+        const size_t t = top.load(etl::memory_order_acquire);
+
+        if ((b - t) >= Capacity)
+        {
+          return false;
+        }
+
+        buffer[b & Mask].store(index, etl::memory_order_relaxed);
+        bottom.store(b + 1U, etl::memory_order_release);
+
+        return true;
+      }
+
+      //*******************************************
+      /// Takes the most recently pushed task index from the bottom.
+      /// Only called by the owning worker.
+      //*******************************************
+      bool take(size_t& index)
+      {
+        const size_t b = bottom.load(etl::memory_order_relaxed) - 1U;
+        bottom.store(b, etl::memory_order_seq_cst);
+        size_t t = top.load(etl::memory_order_seq_cst);
+
+        bool success = false;
+
+        if (static_cast<ptrdiff_t>(b - t) >= 0)
+        {
+          index   = buffer[b & Mask].load(etl::memory_order_relaxed);
+          success = true;
+
+          if (b == t)
+          {
+            // The last one, so race any thieves for it.
+            success = top.compare_exchange_strong(t, t + 1U, etl::memory_order_seq_cst, etl::memory_order_relaxed);
+            bottom.store(b + 1U, etl::memory_order_relaxed);
+          }
+        }
+        else
+        {
+          // Was empty.
+          bottom.store(b + 1U, etl::memory_order_relaxed);
+        }
+
+        return success;
+      }
+
+      //*******************************************
+      /// Steals the oldest task index from the top.
+      /// May be called by any worker.
+      //*******************************************
+      bool steal(size_t& index)
+      {
+        size_t t       = top.load(etl::memory_order_seq_cst);
+        const size_t b = bottom.load(etl::memory_order_seq_cst);
+
+        if (static_cast<ptrdiff_t>(b - t) > 0)
+        {
+          const size_t i = buffer[t & Mask].load(etl::memory_order_relaxed);
+
+          if (top.compare_exchange_strong(t, t + 1U, etl::memory_order_seq_cst, etl::memory_order_relaxed))
+          {
+            index = i;
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+    private:
+
+      static ETL_CONSTANT size_t Mask = Capacity - 1U;
+
+      etl::atomic<size_t> top;
+      etl::atomic<size_t> bottom;
+      etl::atomic<size_t> buffer[Capacity];
+    };
+
+    template <size_t Capacity>
+    ETL_CONSTANT size_t work_stealing_deque<Capacity>::Mask;
+  }
+
+  //***************************************************************************
+  /// Work stealing scheduler.
+  /// Runs tasks on MAX_WORKERS_ worker threads supplied by the application.
+  /// The thread that calls start() is worker 0. Each of the other threads
+  /// must call run_worker(id), with id in the range 1 to MAX_WORKERS_ - 1.
+  /// Every worker must be run, as each owns a share of the tasks.
+  /// Tasks are shared out between the workers in priority order.
+  /// Each worker queues its ready tasks so that the highest priority is run next.
+  /// An idle worker steals the oldest queued task from the other workers.
+  /// A task is never processed by more than one worker at a time, but tasks that
+  /// share data with each other must synchronise it themselves.
+  /// All tasks must be added before any worker is started.
+  /// The idle and watchdog callbacks are only called from worker 0.
+  //***************************************************************************
+  template <size_t MAX_TASKS_, size_t MAX_WORKERS_>
+  class scheduler_work_stealing : public etl::ischeduler
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_WORKERS_ > 0U, "There must be at least one worker");
+
+    enum
+    {
+      MAX_TASKS   = MAX_TASKS_,
+      MAX_WORKERS = MAX_WORKERS_
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    scheduler_work_stealing()
+      : ischeduler(task_list)
+      , exit_requested(false)
+    {
+      for (size_t i = 0UL; i < MAX_TASKS; ++i)
+      {
+        claimed[i].store(false, etl::memory_order_relaxed);
+      }
+    }
+
+    //*******************************************
+    /// Start the scheduler.
+    /// Runs worker 0 on the calling thread.
+    //*******************************************
+    void start() ETL_OVERRIDE
+    {
+      ETL_ASSERT(task_list.size() > 0, ETL_ERROR(etl::scheduler_no_tasks_exception));
+
+      scheduler_running = true;
+
+      while (!exit_requested.load(etl::memory_order_acquire))
+      {
+        if (scheduler_running)
+        {
+          bool idle = schedule_tasks(0U);
+
+          if (p_watchdog_callback)
+          {
+            (*p_watchdog_callback)();
+          }
+
+          if (idle && p_idle_callback)
+          {
+            (*p_idle_callback)();
+          }
+        }
+      }
+    }
+
+    //*******************************************
+    /// Runs one of the other workers on the calling thread.
+    /// Returns when the scheduler is exited.
+    //*******************************************
+    void run_worker(size_t worker_id)
+    {
+      ETL_ASSERT_OR_RETURN((worker_id > 0U) && (worker_id < MAX_WORKERS), ETL_ERROR(etl::scheduler_invalid_worker_exception));
+
+      while (!exit_requested.load(etl::memory_order_acquire))
+      {
+        schedule_tasks(worker_id);
+      }
+    }
+
+    //*******************************************
+    /// Force all of the workers to exit.
+    /// May be called from any thread.
+    //*******************************************
+    void exit_scheduler() ETL_OVERRIDE
+    {
+      ischeduler::exit_scheduler();
+      exit_requested.store(true, etl::memory_order_release);
+    }
+
+  private:
+
+    //*******************************************
+    /// Queues the worker's ready tasks, then processes one unit of work
+    /// from its own queue, or one stolen from another worker.
+    /// Returns true if the worker was idle.
+    //*******************************************
+    bool schedule_tasks(size_t worker_id)
+    {
+      deque_t& own = deques[worker_id];
+
+      // The task list is in descending priority order, so push the worker's share
+      // in reverse, leaving the highest priority ready task at the bottom.
+      const size_t n_tasks = task_list.size();
+
+      if (worker_id < n_tasks)
+      {
+        size_t index = worker_id + (((n_tasks - 1U - worker_id) / MAX_WORKERS) * MAX_WORKERS);
+
+        while (true)
+        {
+          // Only this worker sets the claim, so no other worker can be processing the task.
+          if (!claimed[index].load(etl::memory_order_acquire) && (task_list[index]->task_request_work() > 0))
+          {
+            claimed[index].store(true, etl::memory_order_relaxed);
+            own.push(index);
+          }
+
+          if (index < MAX_WORKERS)
+          {
+            break;
+          }
+
+          index -= MAX_WORKERS;
+        }
+      }
+
+      size_t index;
+
+      if (own.take(index) || steal(worker_id, index))
+      {
+        task_list[index]->task_process_work();
+        claimed[index].store(false, etl::memory_order_release);
+
+        return false;
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// Tries to steal a task from each of the other workers in turn.
+    //*******************************************
+    bool steal(size_t worker_id, size_t& index)
+    {
+      for (size_t i = 1U; i < MAX_WORKERS; ++i)
+      {
+        const size_t victim = (worker_id + i) % MAX_WORKERS;
+
+        if (deques[victim].steal(index))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
+    typedef private_scheduler::work_stealing_deque<etl::power_of_2_round_up<MAX_TASKS>::value> deque_t;
+
+    task_list_t         task_list;
+    deque_t             deques[MAX_WORKERS];
+    etl::atomic<bool>   claimed[MAX_TASKS];
+    etl::atomic<bool>   exit_requested;
+  };
+#endif
 }
 
 #endif
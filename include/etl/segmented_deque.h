@@ -0,0 +1,1127 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEGMENTED_DEQUE_INCLUDED
+#define ETL_SEGMENTED_DEQUE_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "utility.h"
+#include "memory.h"
+#include "ipool.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "type_traits.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup segmented_deque segmented_deque
+/// A double ended queue that stores its elements in fixed size blocks taken
+/// from a shared pool.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for segmented deques
+  ///\ingroup segmented_deque
+  //***************************************************************************
+  class segmented_deque_exception : public etl::exception
+  {
+  public:
+
+    segmented_deque_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Segmented deque full exception.
+  ///\ingroup segmented_deque
+  //***************************************************************************
+  class segmented_deque_full : public etl::segmented_deque_exception
+  {
+  public:
+
+    segmented_deque_full(string_type file_name_, numeric_type line_number_)
+      : etl::segmented_deque_exception(ETL_ERROR_TEXT("segmented_deque:full", ETL_SEGMENTED_DEQUE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Segmented deque empty exception.
+  ///\ingroup segmented_deque
+  //***************************************************************************
+  class segmented_deque_empty : public etl::segmented_deque_exception
+  {
+  public:
+
+    segmented_deque_empty(string_type file_name_, numeric_type line_number_)
+      : etl::segmented_deque_exception(ETL_ERROR_TEXT("segmented_deque:empty", ETL_SEGMENTED_DEQUE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Segmented deque out of bounds exception.
+  ///\ingroup segmented_deque
+  //***************************************************************************
+  class segmented_deque_out_of_bounds : public etl::segmented_deque_exception
+  {
+  public:
+
+    segmented_deque_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::segmented_deque_exception(ETL_ERROR_TEXT("segmented_deque:bounds", ETL_SEGMENTED_DEQUE_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A double ended queue that stores up to Max_Blocks blocks of Block_Size
+  /// elements. Blocks are taken from a pool when they are first needed and
+  /// returned when they become empty, so a pool may be shared between many
+  /// deques and an empty deque holds no blocks.
+  /// The pool must be able to hold items of pool_type, for example
+  /// etl::pool<segmented_deque::pool_type, N>.
+  /// Elements are never moved. Pushing and popping at either end does not
+  /// invalidate iterators or references to other elements, apart from end().
+  /// One position is reserved to distinguish full from empty, so max_size()
+  /// is (Block_Size * Max_Blocks) - 1.
+  ///\ingroup segmented_deque
+  //***************************************************************************
+  template <typename T, const size_t Block_Size_, const size_t Max_Blocks_>
+  class segmented_deque
+  {
+  public:
+
+    static ETL_CONSTANT size_t Block_Size = Block_Size_;
+    static ETL_CONSTANT size_t Max_Blocks = Max_Blocks_;
+
+    ETL_STATIC_ASSERT(Block_Size_ > 0U, "Block_Size must be greater than zero");
+    ETL_STATIC_ASSERT(Max_Blocks_ > 0U, "Max_Blocks must be greater than zero");
+    ETL_STATIC_ASSERT((Block_Size_ * Max_Blocks_) > 1U, "Capacity must be greater than one");
+
+    typedef size_t    size_type;
+    typedef T         value_type;
+    typedef T&        reference;
+    typedef const T&  const_reference;
+#if ETL_USING_CPP11
+    typedef T&&       rvalue_reference;
+#endif
+    typedef T*        pointer;
+    typedef const T*  const_pointer;
+    typedef typename etl::iterator_traits<pointer>::difference_type difference_type;
+
+    /// The type of the items in the block pool.
+    typedef etl::uninitialized_buffer_of<T, Block_Size_> pool_type;
+
+  private:
+
+    static ETL_CONSTANT size_t Buffer_Size = Block_Size_ * Max_Blocks_;
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// Iterator
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, T>
+    {
+    public:
+
+      friend class segmented_deque;
+      friend class const_iterator;
+
+      //***************************************************
+      iterator()
+        : p_deque(ETL_NULLPTR)
+        , position(0U)
+      {
+      }
+
+      //***************************************************
+      iterator& operator ++()
+      {
+        position = segmented_deque::next(position);
+
+        return *this;
+      }
+
+      //***************************************************
+      iterator operator ++(int)
+      {
+        iterator previous(*this);
+        position = segmented_deque::next(position);
+
+        return previous;
+      }
+
+      //***************************************************
+      iterator& operator --()
+      {
+        position = segmented_deque::previous(position);
+
+        return *this;
+      }
+
+      //***************************************************
+      iterator operator --(int)
+      {
+        iterator previous(*this);
+        position = segmented_deque::previous(position);
+
+        return previous;
+      }
+
+      //***************************************************
+      iterator& operator +=(difference_type offset)
+      {
+        position = segmented_deque::advance(position, offset);
+
+        return *this;
+      }
+
+      //***************************************************
+      iterator& operator -=(difference_type offset)
+      {
+        position = segmented_deque::advance(position, -offset);
+
+        return *this;
+      }
+
+      //***************************************************
+      reference operator *() const
+      {
+        return *p_deque->address(position);
+      }
+
+      //***************************************************
+      pointer operator ->() const
+      {
+        return p_deque->address(position);
+      }
+
+      //***************************************************
+      reference operator [](difference_type i) const
+      {
+        return *p_deque->address(segmented_deque::advance(position, i));
+      }
+
+      //***************************************************
+      friend iterator operator +(const iterator& lhs, difference_type offset)
+      {
+        iterator result(lhs);
+        result += offset;
+        return result;
+      }
+
+      //***************************************************
+      friend iterator operator +(difference_type offset, const iterator& rhs)
+      {
+        iterator result(rhs);
+        result += offset;
+        return result;
+      }
+
+      //***************************************************
+      friend iterator operator -(const iterator& lhs, difference_type offset)
+      {
+        iterator result(lhs);
+        result -= offset;
+        return result;
+      }
+
+      //***************************************************
+      friend difference_type operator -(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.distance() - rhs.distance();
+      }
+
+      //***************************************************
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.position == rhs.position;
+      }
+
+      //***************************************************
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //***************************************************
+      friend bool operator <(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.distance() < rhs.distance();
+      }
+
+      //***************************************************
+      friend bool operator <=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      //***************************************************
+      friend bool operator >(const iterator& lhs, const iterator& rhs)
+      {
+        return (rhs < lhs);
+      }
+
+      //***************************************************
+      friend bool operator >=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      //***************************************************
+      iterator(segmented_deque* p_deque_, size_type position_)
+        : p_deque(p_deque_)
+        , position(position_)
+      {
+      }
+
+      //***************************************************
+      difference_type distance() const
+      {
+        return static_cast<difference_type>(p_deque->distance_from_front(position));
+      }
+
+      segmented_deque* p_deque;
+      size_type        position;
+    };
+
+    //*************************************************************************
+    /// Const Iterator
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, const T>
+    {
+    public:
+
+      friend class segmented_deque;
+
+      //***************************************************
+      const_iterator()
+        : p_deque(ETL_NULLPTR)
+        , position(0U)
+      {
+      }
+
+      //***************************************************
+      const_iterator(const typename segmented_deque::iterator& other)
+        : p_deque(other.p_deque)
+        , position(other.position)
+      {
+      }
+
+      //***************************************************
+      const_iterator& operator ++()
+      {
+        position = segmented_deque::next(position);
+
+        return *this;
+      }
+
+      //***************************************************
+      const_iterator operator ++(int)
+      {
+        const_iterator previous(*this);
+        position = segmented_deque::next(position);
+
+        return previous;
+      }
+
+      //***************************************************
+      const_iterator& operator --()
+      {
+        position = segmented_deque::previous(position);
+
+        return *this;
+      }
+
+      //***************************************************
+      const_iterator operator --(int)
+      {
+        const_iterator previous(*this);
+        position = segmented_deque::previous(position);
+
+        return previous;
+      }
+
+      //***************************************************
+      const_iterator& operator +=(difference_type offset)
+      {
+        position = segmented_deque::advance(position, offset);
+
+        return *this;
+      }
+
+      //***************************************************
+      const_iterator& operator -=(difference_type offset)
+      {
+        position = segmented_deque::advance(position, -offset);
+
+        return *this;
+      }
+
+      //***************************************************
+      const_reference operator *() const
+      {
+        return *p_deque->address(position);
+      }
+
+      //***************************************************
+      const_pointer operator ->() const
+      {
+        return p_deque->address(position);
+      }
+
+      //***************************************************
+      const_reference operator [](difference_type i) const
+      {
+        return *p_deque->address(segmented_deque::advance(position, i));
+      }
+
+      //***************************************************
+      friend const_iterator operator +(const const_iterator& lhs, difference_type offset)
+      {
+        const_iterator result(lhs);
+        result += offset;
+        return result;
+      }
+
+      //***************************************************
+      friend const_iterator operator +(difference_type offset, const const_iterator& rhs)
+      {
+        const_iterator result(rhs);
+        result += offset;
+        return result;
+      }
+
+      //***************************************************
+      friend const_iterator operator -(const const_iterator& lhs, difference_type offset)
+      {
+        const_iterator result(lhs);
+        result -= offset;
+        return result;
+      }
+
+      //***************************************************
+      friend difference_type operator -(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.distance() - rhs.distance();
+      }
+
+      //***************************************************
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.position == rhs.position;
+      }
+
+      //***************************************************
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //***************************************************
+      friend bool operator <(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.distance() < rhs.distance();
+      }
+
+      //***************************************************
+      friend bool operator <=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      //***************************************************
+      friend bool operator >(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (rhs < lhs);
+      }
+
+      //***************************************************
+      friend bool operator >=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      //***************************************************
+      const_iterator(const segmented_deque* p_deque_, size_type position_)
+        : p_deque(p_deque_)
+        , position(position_)
+      {
+      }
+
+      //***************************************************
+      difference_type distance() const
+      {
+        return static_cast<difference_type>(p_deque->distance_from_front(position));
+      }
+
+      const segmented_deque* p_deque;
+      size_type              position;
+    };
+
+    typedef etl::reverse_iterator<iterator>       reverse_iterator;
+    typedef etl::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param block_pool The pool that blocks are taken from.
+    //*************************************************************************
+    explicit segmented_deque(etl::ipool& block_pool)
+      : p_pool(&block_pool)
+      , head(0U)
+      , current_size(0U)
+    {
+      initialise_blocks();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// The copy takes its blocks from the same pool.
+    //*************************************************************************
+    segmented_deque(const segmented_deque& other)
+      : p_pool(other.p_pool)
+      , head(0U)
+      , current_size(0U)
+    {
+      initialise_blocks();
+      append(other);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// The blocks continue to be taken from this deque's pool.
+    //*************************************************************************
+    segmented_deque& operator =(const segmented_deque& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        append(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Returns all blocks to the pool.
+    //*************************************************************************
+    ~segmented_deque()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Gets an iterator to the beginning of the deque.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(this, head);
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the beginning of the deque.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, head);
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the beginning of the deque.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, head);
+    }
+
+    //*************************************************************************
+    /// Gets an iterator to the end of the deque.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(this, advance(head, current_size));
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the end of the deque.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, advance(head, current_size));
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the end of the deque.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(this, advance(head, current_size));
+    }
+
+    //*************************************************************************
+    /// Gets a reverse iterator to the end of the deque.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets a const reverse iterator to the end of the deque.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets a const reverse iterator to the end of the deque.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets a reverse iterator to the beginning of the deque.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets a const reverse iterator to the beginning of the deque.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets a const reverse iterator to the beginning of the deque.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the item at the index.
+    /// If asserts or exceptions are enabled, throws an etl::segmented_deque_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    reference at(size_t index)
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(segmented_deque_out_of_bounds));
+
+      return *address(advance(head, index));
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the item at the index.
+    /// If asserts or exceptions are enabled, throws an etl::segmented_deque_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    const_reference at(size_t index) const
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(segmented_deque_out_of_bounds));
+
+      return *address(advance(head, index));
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the item at the index.
+    //*************************************************************************
+    reference operator [](size_t index)
+    {
+      return *address(advance(head, index));
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the item at the index.
+    //*************************************************************************
+    const_reference operator [](size_t index) const
+    {
+      return *address(advance(head, index));
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the item at the front of the deque.
+    //*************************************************************************
+    reference front()
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(segmented_deque_empty));
+
+      return *address(head);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the item at the front of the deque.
+    //*************************************************************************
+    const_reference front() const
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(segmented_deque_empty));
+
+      return *address(head);
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the item at the back of the deque.
+    //*************************************************************************
+    reference back()
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(segmented_deque_empty));
+
+      return *address(back_position());
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the item at the back of the deque.
+    //*************************************************************************
+    const_reference back() const
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(segmented_deque_empty));
+
+      return *address(back_position());
+    }
+
+    //*************************************************************************
+    /// Adds an item to the back of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::segmented_deque_full if the deque is already full
+    /// or an etl::pool_no_allocation if a block is needed and the pool is empty.
+    //*************************************************************************
+    void push_back(const_reference item)
+    {
+      pointer p = prepare_back();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T(item);
+        ++current_size;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Adds an item to the back of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::segmented_deque_full if the deque is already full
+    /// or an etl::pool_no_allocation if a block is needed and the pool is empty.
+    //*************************************************************************
+    void push_back(rvalue_reference item)
+    {
+      pointer p = prepare_back();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T(etl::move(item));
+        ++current_size;
+      }
+    }
+
+    //*************************************************************************
+    /// Emplaces an item at the back of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::segmented_deque_full if the deque is already full
+    /// or an etl::pool_no_allocation if a block is needed and the pool is empty.
+    //*************************************************************************
+    template <typename ... Args>
+    reference emplace_back(Args && ... args)
+    {
+      pointer p = prepare_back();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+        ++current_size;
+      }
+
+      return back();
+    }
+#endif
+
+    //*************************************************************************
+    /// Adds an item to the front of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::segmented_deque_full if the deque is already full
+    /// or an etl::pool_no_allocation if a block is needed and the pool is empty.
+    //*************************************************************************
+    void push_front(const_reference item)
+    {
+      pointer p = prepare_front();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T(item);
+        head = previous(head);
+        ++current_size;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Adds an item to the front of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::segmented_deque_full if the deque is already full
+    /// or an etl::pool_no_allocation if a block is needed and the pool is empty.
+    //*************************************************************************
+    void push_front(rvalue_reference item)
+    {
+      pointer p = prepare_front();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T(etl::move(item));
+        head = previous(head);
+        ++current_size;
+      }
+    }
+
+    //*************************************************************************
+    /// Emplaces an item at the front of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::segmented_deque_full if the deque is already full
+    /// or an etl::pool_no_allocation if a block is needed and the pool is empty.
+    //*************************************************************************
+    template <typename ... Args>
+    reference emplace_front(Args && ... args)
+    {
+      pointer p = prepare_front();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+        head = previous(head);
+        ++current_size;
+      }
+
+      return front();
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the item at the back of the deque.
+    /// Returns the block to the pool if it is no longer used.
+    /// If asserts or exceptions are enabled, throws an etl::segmented_deque_empty if the deque is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(segmented_deque_empty));
+
+      const size_type position = back_position();
+
+      address(position)->~T();
+      --current_size;
+      release_unused_block(position / Block_Size);
+    }
+
+    //*************************************************************************
+    /// Removes the item at the front of the deque.
+    /// Returns the block to the pool if it is no longer used.
+    /// If asserts or exceptions are enabled, throws an etl::segmented_deque_empty if the deque is empty.
+    //*************************************************************************
+    void pop_front()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(segmented_deque_empty));
+
+      const size_type position = head;
+
+      address(position)->~T();
+      head = next(head);
+      --current_size;
+      release_unused_block(position / Block_Size);
+    }
+
+    //*************************************************************************
+    /// Clears the deque and returns all of its blocks to the pool.
+    //*************************************************************************
+    void clear()
+    {
+      if ETL_IF_CONSTEXPR(!etl::is_trivially_destructible<T>::value)
+      {
+        for (size_type i = 0U; i < current_size; ++i)
+        {
+          address(advance(head, i))->~T();
+        }
+      }
+
+      for (size_type i = 0U; i < Max_Blocks; ++i)
+      {
+        if (blocks[i] != ETL_NULLPTR)
+        {
+          p_pool->release(blocks[i]);
+          blocks[i] = ETL_NULLPTR;
+        }
+      }
+
+      head         = 0U;
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the number of items in the deque.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the deque is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the deque is full.
+    /// Further pushes may still fail if the pool has no free blocks.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the deque.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return Buffer_Size - 1U;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity of the deque, ignoring the state of the pool.
+    //*************************************************************************
+    size_type available() const
+    {
+      return max_size() - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of blocks held by the deque.
+    //*************************************************************************
+    size_type block_count() const
+    {
+      size_type count = 0U;
+
+      for (size_type i = 0U; i < Max_Blocks; ++i)
+      {
+        count += (blocks[i] != ETL_NULLPTR) ? 1U : 0U;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Gets the pool that blocks are taken from.
+    //*************************************************************************
+    etl::ipool& get_pool() const
+    {
+      return *p_pool;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Positions are in the range [0, Buffer_Size) and do not change while
+    /// the item at the position is in the deque.
+    //*************************************************************************
+    static size_type next(size_type position)
+    {
+      return (position == (Buffer_Size - 1U)) ? 0U : position + 1U;
+    }
+
+    //*************************************************************************
+    static size_type previous(size_type position)
+    {
+      return (position == 0U) ? Buffer_Size - 1U : position - 1U;
+    }
+
+    //*************************************************************************
+    static size_type advance(size_type position, difference_type offset)
+    {
+      difference_type result = static_cast<difference_type>(position) + (offset % static_cast<difference_type>(Buffer_Size));
+
+      if (result < 0)
+      {
+        result += Buffer_Size;
+      }
+      else if (result >= static_cast<difference_type>(Buffer_Size))
+      {
+        result -= Buffer_Size;
+      }
+
+      return static_cast<size_type>(result);
+    }
+
+    //*************************************************************************
+    size_type distance_from_front(size_type position) const
+    {
+      return (position >= head) ? position - head : position + Buffer_Size - head;
+    }
+
+    //*************************************************************************
+    size_type back_position() const
+    {
+      return advance(head, current_size - 1U);
+    }
+
+    //*************************************************************************
+    pointer address(size_type position) const
+    {
+      return blocks[position / Block_Size] + (position % Block_Size);
+    }
+
+    //*************************************************************************
+    void initialise_blocks()
+    {
+      for (size_type i = 0U; i < Max_Blocks; ++i)
+      {
+        blocks[i] = ETL_NULLPTR;
+      }
+    }
+
+    //*************************************************************************
+    /// Makes sure that the block holding the position has been taken from the pool.
+    /// Returns the address for the position, or null on failure.
+    /// The pool raises its own error if it has no free blocks.
+    //*************************************************************************
+    pointer prepare(size_type position)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(segmented_deque_full), ETL_NULLPTR);
+
+      pointer& block = blocks[position / Block_Size];
+
+      if (block == ETL_NULLPTR)
+      {
+        pool_type* p_block = p_pool->template allocate<pool_type>();
+
+        if (p_block == ETL_NULLPTR)
+        {
+          return ETL_NULLPTR;
+        }
+
+        block = reinterpret_cast<pointer>(p_block->raw);
+      }
+
+      return block + (position % Block_Size);
+    }
+
+    //*************************************************************************
+    pointer prepare_back()
+    {
+      return prepare(advance(head, current_size));
+    }
+
+    //*************************************************************************
+    pointer prepare_front()
+    {
+      return prepare(previous(head));
+    }
+
+    //*************************************************************************
+    /// Returns a block to the pool if none of the items are in it.
+    /// The items are contiguous, so a block that was just popped from can
+    /// only still be in use if it holds the front or the back item.
+    //*************************************************************************
+    void release_unused_block(size_type block_index)
+    {
+      const bool in_use = !empty() &&
+                          (((head / Block_Size) == block_index) || ((back_position() / Block_Size) == block_index));
+
+      if (!in_use)
+      {
+        p_pool->release(blocks[block_index]);
+        blocks[block_index] = ETL_NULLPTR;
+      }
+    }
+
+    //*************************************************************************
+    void append(const segmented_deque& other)
+    {
+      for (const_iterator itr = other.begin(); itr != other.end(); ++itr)
+      {
+        push_back(*itr);
+      }
+    }
+
+    etl::ipool* p_pool;             ///< The pool that blocks are taken from.
+    pointer     blocks[Max_Blocks_]; ///< The block for each range of positions, or null.
+    size_type   head;               ///< The position of the front item.
+    size_type   current_size;       ///< The number of items.
+  };
+
+  template <typename T, const size_t Block_Size_, const size_t Max_Blocks_>
+  ETL_CONSTANT size_t segmented_deque<T, Block_Size_, Max_Blocks_>::Block_Size;
+
+  template <typename T, const size_t Block_Size_, const size_t Max_Blocks_>
+  ETL_CONSTANT size_t segmented_deque<T, Block_Size_, Max_Blocks_>::Max_Blocks;
+
+  template <typename T, const size_t Block_Size_, const size_t Max_Blocks_>
+  ETL_CONSTANT size_t segmented_deque<T, Block_Size_, Max_Blocks_>::Buffer_Size;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup segmented_deque
+  //***************************************************************************
+  template <typename T, const size_t Block_Size, const size_t Max_Blocks>
+  bool operator ==(const etl::segmented_deque<T, Block_Size, Max_Blocks>& lhs, const etl::segmented_deque<T, Block_Size, Max_Blocks>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup segmented_deque
+  //***************************************************************************
+  template <typename T, const size_t Block_Size, const size_t Max_Blocks>
+  bool operator !=(const etl::segmented_deque<T, Block_Size, Max_Blocks>& lhs, const etl::segmented_deque<T, Block_Size, Max_Blocks>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#endif
@@ -0,0 +1,1135 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SMALL_VECTOR_INCLUDED
+#define ETL_SMALL_VECTOR_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "utility.h"
+#include "memory.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "type_traits.h"
+#include "placement_new.h"
+#include "integral_limits.h"
+#include "parameter_type.h"
+#include "imemory_block_allocator.h"
+#include "static_assert.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <string.h>
+
+//*****************************************************************************
+///\defgroup small_vector small_vector
+/// A vector that stores a small number of elements internally and moves them
+/// to a block taken from a memory block allocator when it needs more space.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for small vectors
+  ///\ingroup small_vector
+  //***************************************************************************
+  class small_vector_exception : public etl::exception
+  {
+  public:
+
+    small_vector_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Small vector full exception.
+  /// Raised when more space is needed and the allocator cannot supply it.
+  ///\ingroup small_vector
+  //***************************************************************************
+  class small_vector_full : public etl::small_vector_exception
+  {
+  public:
+
+    small_vector_full(string_type file_name_, numeric_type line_number_)
+      : etl::small_vector_exception(ETL_ERROR_TEXT("small_vector:full", ETL_SMALL_VECTOR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Small vector empty exception.
+  ///\ingroup small_vector
+  //***************************************************************************
+  class small_vector_empty : public etl::small_vector_exception
+  {
+  public:
+
+    small_vector_empty(string_type file_name_, numeric_type line_number_)
+      : etl::small_vector_exception(ETL_ERROR_TEXT("small_vector:empty", ETL_SMALL_VECTOR_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Small vector out of bounds exception.
+  ///\ingroup small_vector
+  //***************************************************************************
+  class small_vector_out_of_bounds : public etl::small_vector_exception
+  {
+  public:
+
+    small_vector_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::small_vector_exception(ETL_ERROR_TEXT("small_vector:bounds", ETL_SMALL_VECTOR_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized small vectors.
+  /// Can be used as a reference type for all small vectors containing a specific type.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  class ismall_vector
+  {
+  public:
+
+    typedef T                                     value_type;
+    typedef T&                                    reference;
+    typedef const T&                              const_reference;
+#if ETL_USING_CPP11
+    typedef T&&                                   rvalue_reference;
+#endif
+    typedef T*                                    pointer;
+    typedef const T*                              const_pointer;
+    typedef T*                                    iterator;
+    typedef const T*                              const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef size_t                                size_type;
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+  protected:
+
+    typedef typename etl::parameter_type<T>::type parameter_t;
+
+  public:
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the vector.
+    //*********************************************************************
+    iterator begin()
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the vector.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the vector.
+    //*********************************************************************
+    iterator end()
+    {
+      return p_end;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the vector.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return p_end;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the vector.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the vector.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return p_end;
+    }
+
+    //*********************************************************************
+    /// Returns an reverse iterator to the reverse beginning of the vector.
+    //*********************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the vector.
+    //*********************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a reverse iterator to the end + 1 of the vector.
+    //*********************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the vector.
+    //*********************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the vector.
+    //*********************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the vector.
+    //*********************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*********************************************************************
+    /// Resizes the vector.
+    /// If asserts or exceptions are enabled and the extra space cannot be
+    /// allocated then a small_vector_full is thrown.
+    ///\param new_size The new size.
+    //*********************************************************************
+    void resize(size_t new_size)
+    {
+      resize(new_size, T());
+    }
+
+    //*********************************************************************
+    /// Resizes the vector.
+    /// If asserts or exceptions are enabled and the extra space cannot be
+    /// allocated then a small_vector_full is thrown.
+    ///\param new_size The new size.
+    ///\param value    The value to fill new elements with.
+    //*********************************************************************
+    void resize(size_t new_size, const_reference value)
+    {
+      if (new_size > size())
+      {
+        if (!grow(new_size))
+        {
+          return;
+        }
+
+        etl::uninitialized_fill(p_end, p_buffer + new_size, value);
+        p_end = p_buffer + new_size;
+      }
+      else
+      {
+        destroy_back(size() - new_size);
+      }
+    }
+
+    //*********************************************************************
+    /// Makes sure that the capacity is at least n.
+    /// If asserts or exceptions are enabled and the space cannot be
+    /// allocated then a small_vector_full is thrown.
+    //*********************************************************************
+    void reserve(size_t n)
+    {
+      if (n > current_capacity)
+      {
+        relocate_to(n);
+      }
+    }
+
+    //*********************************************************************
+    /// Moves the elements back to the internal buffer, if they fit, and
+    /// returns the allocated block.
+    //*********************************************************************
+    void shrink_to_fit()
+    {
+      if (!is_internal() && (size() <= internal_capacity))
+      {
+        const size_type n = size();
+        pointer p_old = p_buffer;
+
+        relocate(p_old, p_end, p_internal);
+        p_allocator->release(p_old);
+
+        p_buffer         = p_internal;
+        p_end            = p_internal + n;
+        current_capacity = internal_capacity;
+      }
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'i'
+    //*********************************************************************
+    reference operator [](size_t i)
+    {
+      return p_buffer[i];
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'i'
+    //*********************************************************************
+    const_reference operator [](size_t i) const
+    {
+      return p_buffer[i];
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'i'
+    /// If asserts or exceptions are enabled, emits an etl::small_vector_out_of_bounds if the index is out of range.
+    //*********************************************************************
+    reference at(size_t i)
+    {
+      ETL_ASSERT(i < size(), ETL_ERROR(small_vector_out_of_bounds));
+      return p_buffer[i];
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'i'
+    /// If asserts or exceptions are enabled, emits an etl::small_vector_out_of_bounds if the index is out of range.
+    //*********************************************************************
+    const_reference at(size_t i) const
+    {
+      ETL_ASSERT(i < size(), ETL_ERROR(small_vector_out_of_bounds));
+      return p_buffer[i];
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the first element.
+    //*********************************************************************
+    reference front()
+    {
+      return *p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the first element.
+    //*********************************************************************
+    const_reference front() const
+    {
+      return *p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the last element.
+    //*********************************************************************
+    reference back()
+    {
+      return *(p_end - 1);
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the last element.
+    //*********************************************************************
+    const_reference back() const
+    {
+      return *(p_end - 1);
+    }
+
+    //*********************************************************************
+    /// Returns a pointer to the beginning of the vector data.
+    //*********************************************************************
+    pointer data()
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns a const pointer to the beginning of the vector data.
+    //*********************************************************************
+    const_pointer data() const
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if the space cannot be allocated.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<!etl::is_integral<TIterator>::value, void>::type
+      assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      const size_type n = static_cast<size_type>(etl::distance(first, last));
+
+      if (grow(n))
+      {
+        p_end = etl::uninitialized_copy(first, last, p_buffer);
+      }
+    }
+
+    //*********************************************************************
+    /// Assigns values to the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if the space cannot be allocated.
+    ///\param n     The number of elements to add.
+    ///\param value The value to insert for each element.
+    //*********************************************************************
+    void assign(size_t n, parameter_t value)
+    {
+      clear();
+
+      if (grow(n))
+      {
+        p_end = etl::uninitialized_fill_n(p_buffer, n, value);
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the vector.
+    /// Any allocated block is kept; call shrink_to_fit to return it.
+    //*************************************************************************
+    void clear()
+    {
+      destroy_back(size());
+    }
+
+    //*********************************************************************
+    /// Inserts a value at the end of the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if the space cannot be allocated.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back(const_reference value)
+    {
+      if (p_end == (p_buffer + current_capacity))
+      {
+        // The value may be in the vector, so copy it before moving the elements.
+        T copy(value);
+
+        if (grow(size() + 1U))
+        {
+          create_back(ETL_MOVE(copy));
+        }
+      }
+      else
+      {
+        create_back(value);
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value at the end of the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if the space cannot be allocated.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back(rvalue_reference value)
+    {
+      if (p_end == (p_buffer + current_capacity))
+      {
+        T copy(etl::move(value));
+
+        if (grow(size() + 1U))
+        {
+          create_back(etl::move(copy));
+        }
+      }
+      else
+      {
+        create_back(etl::move(value));
+      }
+    }
+
+    //*********************************************************************
+    /// Constructs a value at the end of the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if the space cannot be allocated.
+    //*********************************************************************
+    template <typename ... Args>
+    reference emplace_back(Args && ... args)
+    {
+      if (p_end == (p_buffer + current_capacity))
+      {
+        T copy(etl::forward<Args>(args)...);
+
+        if (grow(size() + 1U))
+        {
+          create_back(etl::move(copy));
+        }
+      }
+      else
+      {
+        ::new (p_end) T(etl::forward<Args>(args)...);
+        ++p_end;
+      }
+
+      return back();
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes an element from the end of the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_empty if the vector is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(small_vector_empty));
+
+      destroy_back(1U);
+    }
+
+    //*********************************************************************
+    /// Inserts a value into the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if the space cannot be allocated.
+    ///\param position The position to insert before.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator position, const_reference value)
+    {
+      const size_type index = static_cast<size_type>(position - p_buffer);
+
+      // The value may be in the vector, so copy it before moving the elements.
+      T copy(value);
+
+      if (!grow(size() + 1U))
+      {
+        return end();
+      }
+
+      if (open_gap(index, 1U) == 1U)
+      {
+        p_buffer[index] = copy;
+      }
+      else
+      {
+        ::new (p_buffer + index) T(copy);
+      }
+
+      return p_buffer + index;
+    }
+
+    //*********************************************************************
+    /// Inserts 'n' copies of a value into the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if the space cannot be allocated.
+    ///\param position The position to insert before.
+    ///\param n        The number of elements to add.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator position, size_t n, parameter_t value)
+    {
+      const size_type index = static_cast<size_type>(position - p_buffer);
+
+      if (n == 0U)
+      {
+        return p_buffer + index;
+      }
+
+      T copy(value);
+
+      if (!grow(size() + n))
+      {
+        return end();
+      }
+
+      const size_type assigned = open_gap(index, n);
+
+      etl::fill_n(p_buffer + index, assigned, copy);
+      etl::uninitialized_fill_n(p_buffer + index + assigned, n - assigned, copy);
+
+      return p_buffer + index;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values into the vector.
+    /// If asserts or exceptions are enabled, emits small_vector_full if the space cannot be allocated.
+    /// The range must not be in the vector.
+    ///\param position The position to insert before.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    typename etl::enable_if<!etl::is_integral<TIterator>::value, iterator>::type
+      insert(const_iterator position, TIterator first, TIterator last)
+    {
+      const size_type index = static_cast<size_type>(position - p_buffer);
+      const size_type n     = static_cast<size_type>(etl::distance(first, last));
+
+      if (n == 0U)
+      {
+        return p_buffer + index;
+      }
+
+      if (!grow(size() + n))
+      {
+        return end();
+      }
+
+      const size_type assigned = open_gap(index, n);
+      pointer p = p_buffer + index;
+
+      for (size_type i = 0U; i < n; ++i, ++first, ++p)
+      {
+        if (i < assigned)
+        {
+          *p = *first;
+        }
+        else
+        {
+          ::new (p) T(*first);
+        }
+      }
+
+      return p_buffer + index;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator pointing to the element that followed the erased element.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      return erase(i_element, i_element + 1);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element + 1.
+    ///\return An iterator pointing to the element that followed the erased elements.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      iterator i_first = to_iterator(first);
+      iterator i_last  = to_iterator(last);
+
+      if (i_first != i_last)
+      {
+        etl::move(i_last, p_end, i_first);
+        destroy_back(static_cast<size_type>(i_last - i_first));
+      }
+
+      return i_first;
+    }
+
+    //*************************************************************************
+    /// Gets the current size of the vector.
+    //*************************************************************************
+    size_type size() const
+    {
+      return static_cast<size_type>(p_end - p_buffer);
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the vector.
+    //*************************************************************************
+    bool empty() const
+    {
+      return p_end == p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements that fit without taking more space.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return current_capacity;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements that fit in the internal buffer.
+    //*************************************************************************
+    size_type internal_capacity_size() const
+    {
+      return internal_capacity;
+    }
+
+    //*************************************************************************
+    /// Returns true if the elements are held in the internal buffer.
+    //*************************************************************************
+    bool is_internal() const
+    {
+      return p_buffer == p_internal;
+    }
+
+    //*************************************************************************
+    /// Returns the largest size that could be requested from the allocator.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return (p_allocator == ETL_NULLPTR) ? internal_capacity : etl::integral_limits<size_type>::max / sizeof(T);
+    }
+
+    //*************************************************************************
+    /// Gets the allocator, or null if there is none.
+    //*************************************************************************
+    etl::imemory_block_allocator* get_allocator() const
+    {
+      return p_allocator;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ismall_vector& operator =(const ismall_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    /// Takes the allocated block if both vectors use the same allocator.
+    //*************************************************************************
+    ismall_vector& operator =(ismall_vector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    ismall_vector(T* p_internal_, size_t internal_capacity_, etl::imemory_block_allocator* p_allocator_)
+      : p_buffer(p_internal_)
+      , p_end(p_internal_)
+      , current_capacity(internal_capacity_)
+      , p_internal(p_internal_)
+      , internal_capacity(internal_capacity_)
+      , p_allocator(p_allocator_)
+    {
+    }
+
+    //*********************************************************************
+    /// Destroys the elements and returns any allocated block.
+    //*********************************************************************
+    void release_all()
+    {
+      clear();
+
+      if (!is_internal())
+      {
+        p_allocator->release(p_buffer);
+
+        p_buffer         = p_internal;
+        p_end            = p_internal;
+        current_capacity = internal_capacity;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Moves the contents of another vector to this one.
+    //*********************************************************************
+    void move_from(ismall_vector& other)
+    {
+      if (!other.is_internal() && (other.p_allocator == p_allocator))
+      {
+        release_all();
+
+        p_buffer         = other.p_buffer;
+        p_end            = other.p_end;
+        current_capacity = other.current_capacity;
+
+        other.p_buffer         = other.p_internal;
+        other.p_end            = other.p_internal;
+        other.current_capacity = other.internal_capacity;
+      }
+      else
+      {
+        clear();
+
+        if (grow(other.size()))
+        {
+          p_end = etl::uninitialized_move(other.begin(), other.end(), p_buffer);
+        }
+
+        other.release_all();
+      }
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// Makes sure there is room for 'required' elements.
+    /// The capacity is doubled, or set to 'required' if that is larger or
+    /// the allocator cannot supply the doubled size.
+    //*********************************************************************
+    bool grow(size_type required)
+    {
+      if (required <= current_capacity)
+      {
+        return true;
+      }
+
+      size_type new_capacity = current_capacity * 2U;
+
+      if (new_capacity < required)
+      {
+        new_capacity = required;
+      }
+
+      pointer p_new = allocate(new_capacity);
+
+      if ((p_new == ETL_NULLPTR) && (new_capacity != required))
+      {
+        new_capacity = required;
+        p_new        = allocate(new_capacity);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(p_new != ETL_NULLPTR, ETL_ERROR(small_vector_full), false);
+
+      adopt(p_new, new_capacity);
+
+      return true;
+    }
+
+    //*********************************************************************
+    /// Moves the elements to a new block of 'new_capacity' elements.
+    //*********************************************************************
+    bool relocate_to(size_type new_capacity)
+    {
+      pointer p_new = allocate(new_capacity);
+
+      ETL_ASSERT_OR_RETURN_VALUE(p_new != ETL_NULLPTR, ETL_ERROR(small_vector_full), false);
+
+      adopt(p_new, new_capacity);
+
+      return true;
+    }
+
+    //*********************************************************************
+    /// Requests a block of 'n' elements from the allocator.
+    /// Returns null if there is no allocator or it cannot supply the block.
+    //*********************************************************************
+    pointer allocate(size_type n)
+    {
+      if (p_allocator == ETL_NULLPTR)
+      {
+        return ETL_NULLPTR;
+      }
+
+      return static_cast<pointer>(p_allocator->allocate(n * sizeof(T), etl::alignment_of<T>::value));
+    }
+
+    //*********************************************************************
+    /// Moves the elements to the new block and releases the old one.
+    //*********************************************************************
+    void adopt(pointer p_new, size_type new_capacity)
+    {
+      const size_type n = size();
+
+      relocate(p_buffer, p_end, p_new);
+
+      if (!is_internal())
+      {
+        p_allocator->release(p_buffer);
+      }
+
+      p_buffer         = p_new;
+      p_end            = p_new + n;
+      current_capacity = new_capacity;
+    }
+
+    //*********************************************************************
+    /// Moves the elements to uninitialised memory and ends their lifetime
+    /// at the old address. Trivially copyable types are copied as bytes.
+    //*********************************************************************
+    static void relocate(pointer p_first, pointer p_last, pointer p_destination)
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_copyable<T>::value)
+      {
+        if (p_first != p_last)
+        {
+          memcpy(static_cast<void*>(p_destination), static_cast<const void*>(p_first), static_cast<size_t>(p_last - p_first) * sizeof(T));
+        }
+      }
+      else
+      {
+        while (p_first != p_last)
+        {
+          ::new (p_destination) T(ETL_MOVE(*p_first));
+          p_first->~T();
+          ++p_first;
+          ++p_destination;
+        }
+      }
+    }
+
+    //*********************************************************************
+    /// Makes room for 'n' elements at 'index'.
+    /// The capacity must already be available.
+    /// Returns the number of elements at the start of the gap that are still
+    /// constructed and must be assigned to. The rest of the gap is
+    /// uninitialised and must be constructed.
+    //*********************************************************************
+    size_type open_gap(size_type index, size_type n)
+    {
+      const size_type old_size = size();
+      pointer p_position = p_buffer + index;
+      pointer p_old_end  = p_end;
+
+      p_end += n;
+
+      if ((index + n) >= old_size)
+      {
+        // The gap reaches past the current end.
+        etl::uninitialized_move(p_position, p_old_end, p_position + n);
+
+        return old_size - index;
+      }
+      else
+      {
+        etl::uninitialized_move(p_old_end - n, p_old_end, p_old_end);
+        etl::move_backward(p_position, p_old_end - n, p_old_end);
+
+        return n;
+      }
+    }
+
+    //*********************************************************************
+    void create_back(const_reference value)
+    {
+      ::new (p_end) T(value);
+      ++p_end;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    void create_back(rvalue_reference value)
+    {
+      ::new (p_end) T(etl::move(value));
+      ++p_end;
+    }
+#endif
+
+    //*********************************************************************
+    void destroy_back(size_type n)
+    {
+      pointer p_new_end = p_end - n;
+
+      etl::destroy(p_new_end, p_end);
+      p_end = p_new_end;
+    }
+
+    //*********************************************************************
+    iterator to_iterator(const_iterator itr) const
+    {
+      return const_cast<iterator>(itr);
+    }
+
+    // Disable copy construction.
+    ismall_vector(const ismall_vector&) ETL_DELETE;
+
+    pointer   p_buffer;          ///< The current storage.
+    pointer   p_end;             ///< One past the last element.
+    size_type current_capacity;  ///< The capacity of the current storage.
+
+    pointer const                       p_internal;        ///< The internal buffer.
+    const size_type                     internal_capacity; ///< The capacity of the internal buffer.
+    etl::imemory_block_allocator* const p_allocator;       ///< Where larger blocks come from, or null.
+  };
+
+  //***************************************************************************
+  /// A vector that holds up to Internal_Size elements internally.
+  /// When more space is needed the elements are moved to a block taken from
+  /// an etl::imemory_block_allocator. Trivially copyable elements are moved
+  /// with memcpy.
+  /// Without an allocator it behaves like an etl::vector of Internal_Size.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T, const size_t Internal_Size_>
+  class small_vector : public etl::ismall_vector<T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Internal_Size_ > 0U, "Zero internal size small_vector is not valid");
+
+    static ETL_CONSTANT size_t Internal_Size = Internal_Size_;
+
+    //*************************************************************************
+    /// Constructor, without an allocator.
+    //*************************************************************************
+    small_vector()
+      : etl::ismall_vector<T>(reinterpret_cast<T*>(&buffer), Internal_Size, ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param allocator Where larger blocks are taken from.
+    //*************************************************************************
+    explicit small_vector(etl::imemory_block_allocator& allocator)
+      : etl::ismall_vector<T>(reinterpret_cast<T*>(&buffer), Internal_Size, &allocator)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    small_vector(TIterator first, TIterator last, etl::imemory_block_allocator& allocator, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+      : etl::ismall_vector<T>(reinterpret_cast<T*>(&buffer), Internal_Size, &allocator)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    small_vector(std::initializer_list<T> init, etl::imemory_block_allocator& allocator)
+      : etl::ismall_vector<T>(reinterpret_cast<T*>(&buffer), Internal_Size, &allocator)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// The copy uses the same allocator.
+    //*************************************************************************
+    small_vector(const small_vector& other)
+      : etl::ismall_vector<T>(reinterpret_cast<T*>(&buffer), Internal_Size, other.get_allocator())
+    {
+      this->assign(other.begin(), other.end());
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    small_vector& operator =(const small_vector& rhs)
+    {
+      etl::ismall_vector<T>::operator =(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    /// Takes the allocated block from the other vector, if it has one.
+    //*************************************************************************
+    small_vector(small_vector&& other)
+      : etl::ismall_vector<T>(reinterpret_cast<T*>(&buffer), Internal_Size, other.get_allocator())
+    {
+      this->move_from(other);
+    }
+
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    small_vector& operator =(small_vector&& rhs)
+    {
+      etl::ismall_vector<T>::operator =(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~small_vector()
+    {
+      this->release_all();
+    }
+
+  private:
+
+    typename etl::aligned_storage<sizeof(T) * Internal_Size, etl::alignment_of<T>::value>::type buffer;
+  };
+
+  template <typename T, const size_t Internal_Size_>
+  ETL_CONSTANT size_t small_vector<T, Internal_Size_>::Internal_Size;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator ==(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator !=(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Less than operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator <(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+}
+
+#endif
@@ -37,6 +37,7 @@ SOFTWARE.
 #include "memory.h"
 #include "char_traits.h"
 #include "optional.h"
+#include "span.h"
 
 #include <ctype.h>
 #include <stdint.h>
@@ -795,6 +796,266 @@ namespace etl
     return all_tokens_found;
   }
 
+  namespace private_string_utilities
+  {
+    //*************************************************************************
+    /// A bitmap of the values of a set of single byte characters.
+    //*************************************************************************
+    class char_set_bitmap
+    {
+    public:
+
+      template <typename T>
+      ETL_CONSTEXPR14 char_set_bitmap(const T* set, size_t set_length) ETL_NOEXCEPT
+        : bits()
+      {
+        for (size_t i = 0U; i < set_length; ++i)
+        {
+          const uint_least8_t value = static_cast<uint_least8_t>(set[i]);
+
+          bits[value >> 5U] |= uint32_t(1U) << (value & 0x1FU);
+        }
+      }
+
+      template <typename T>
+      ETL_CONSTEXPR14 bool contains(T c) const ETL_NOEXCEPT
+      {
+        const uint_least8_t value = static_cast<uint_least8_t>(c);
+
+        return (bits[value >> 5U] & (uint32_t(1U) << (value & 0x1FU))) != 0U;
+      }
+
+    private:
+
+      uint32_t bits[8];
+    };
+
+
+    //*************************************************************************
+    /// The delimiters of a tokenizer.
+    /// Single byte characters are held as a bitmap.
+    //*************************************************************************
+    template <typename TChar, bool Is_Single_Byte = (sizeof(TChar) == 1U)>
+    class delimiter_set
+    {
+    public:
+
+      delimiter_set(const TChar* delimiters, size_t length)
+        : bitmap(delimiters, length)
+      {
+      }
+
+      bool contains(TChar c) const
+      {
+        return bitmap.contains(c);
+      }
+
+    private:
+
+      char_set_bitmap bitmap;
+    };
+
+    //*************************************************************************
+    /// Wider characters are compared against the delimiter string, which must
+    /// outlive the tokenizer.
+    //*************************************************************************
+    template <typename TChar>
+    class delimiter_set<TChar, false>
+    {
+    public:
+
+      delimiter_set(const TChar* delimiters_, size_t length_)
+        : delimiters(delimiters_)
+        , length(length_)
+      {
+      }
+
+      bool contains(TChar c) const
+      {
+        for (size_t i = 0U; i < length; ++i)
+        {
+          if (delimiters[i] == c)
+          {
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+    private:
+
+      const TChar* delimiters;
+      size_t       length;
+    };
+  }
+
+  //***************************************************************************
+  /// tokenizer
+  ///\brief Splits text into string views, according to a set of delimiters.
+  /// The delimiter set is built once and may be used for any number of inputs.
+  /// Single byte delimiters are copied into a bitmap. Wider characters are
+  /// compared against the caller's delimiter string, which is not copied, so
+  /// it must outlive the tokenizer.
+  /// Tokens are views of the input text, so the input must outlive them.
+  /// Tokens are returned as get_token would return them.
+  ///\tparam TStringView The string view type to return.
+  //***************************************************************************
+  template <typename TStringView>
+  class tokenizer
+  {
+  public:
+
+    typedef TStringView                         view_type;
+    typedef typename TStringView::value_type    value_type;
+    typedef typename TStringView::size_type     size_type;
+    typedef typename TStringView::const_pointer const_pointer;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param delimiters          A pointer to a null terminated string of delimiters.
+    ///                           For wider than single byte characters, it must outlive the tokenizer.
+    ///\param ignore_empty_tokens If <b>true</b> then empty tokens are ignored.
+    //*************************************************************************
+    tokenizer(const_pointer delimiters_, bool ignore_empty_tokens_ = false)
+      : delimiters(delimiters_, etl::strlen(delimiters_))
+      , ignore_empty_tokens(ignore_empty_tokens_)
+      , p_next(ETL_NULLPTR)
+      , p_end(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param delimiters          A pointer to a string of delimiters.
+    ///                           For wider than single byte characters, it must outlive the tokenizer.
+    ///\param length              The number of delimiters.
+    ///\param ignore_empty_tokens If <b>true</b> then empty tokens are ignored.
+    //*************************************************************************
+    tokenizer(const_pointer delimiters_, size_type length, bool ignore_empty_tokens_)
+      : delimiters(delimiters_, length)
+      , ignore_empty_tokens(ignore_empty_tokens_)
+      , p_next(ETL_NULLPTR)
+      , p_end(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the text to tokenise.
+    //*************************************************************************
+    void set_input(const TStringView& input)
+    {
+      p_next = input.data();
+      p_end  = (p_next == ETL_NULLPTR) ? ETL_NULLPTR : p_next + input.size();
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no more tokens.
+    //*************************************************************************
+    bool done() const
+    {
+      return p_next == ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the character is a delimiter.
+    //*************************************************************************
+    bool is_delimiter(value_type c) const
+    {
+      return delimiters.contains(c);
+    }
+
+    //*************************************************************************
+    /// Gets the next token.
+    ///\return The token, or an empty optional if there are no more tokens.
+    //*************************************************************************
+    etl::optional<TStringView> next()
+    {
+      TStringView token;
+
+      if (next_token(token))
+      {
+        return etl::optional<TStringView>(token);
+      }
+
+      return etl::optional<TStringView>();
+    }
+
+    //*************************************************************************
+    /// Fills the span with the following tokens.
+    /// Tokenisation may be continued with further calls.
+    /// For wider than single byte characters, the delimiter string given to
+    /// the constructor must still exist.
+    ///\return The number of tokens written.
+    //*************************************************************************
+    size_t split_into(etl::span<TStringView> tokens)
+    {
+      size_t count = 0U;
+
+      while ((count != tokens.size()) && next_token(tokens[count]))
+      {
+        ++count;
+      }
+
+      return count;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Finds the next token.
+    //*************************************************************************
+    bool next_token(TStringView& token)
+    {
+      while (p_next != ETL_NULLPTR)
+      {
+        const_pointer p_first = p_next;
+        const_pointer p_last  = p_first;
+
+        while ((p_last != p_end) && !delimiters.contains(*p_last))
+        {
+          ++p_last;
+        }
+
+        // Skip the delimiter, or finish if the end was reached.
+        p_next = (p_last == p_end) ? ETL_NULLPTR : p_last + 1;
+
+        if ((p_last != p_first) || !ignore_empty_tokens)
+        {
+          token = TStringView(p_first, static_cast<size_type>(p_last - p_first));
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    private_string_utilities::delimiter_set<value_type> delimiters;
+    bool          ignore_empty_tokens;
+    const_pointer p_next;
+    const_pointer p_end;
+  };
+
+  //***************************************************************************
+  /// split_into
+  ///\brief Splits text into a span of string views, according to a set of delimiters.
+  ///\param input               The input text.
+  ///\param tokens              The span of views to fill.
+  ///\param delimiters          A pointer to a null terminated string of delimiters.
+  ///                           It is only used during the call.
+  ///\param ignore_empty_tokens If <b>true</b> then empty tokens are ignored.
+  ///\return The number of tokens written.
+  //***************************************************************************
+  template <typename TStringView>
+  size_t split_into(const typename etl::type_identity<TStringView>::type& input, etl::span<TStringView> tokens, typename TStringView::const_pointer delimiters, bool ignore_empty_tokens)
+  {
+    etl::tokenizer<TStringView> splitter(delimiters, ignore_empty_tokens);
+
+    splitter.set_input(input);
+
+    return splitter.split_into(tokens);
+  }
+
   //***************************************************************************
   /// pad_left
   //***************************************************************************
@@ -518,21 +518,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const ETL_NOEXCEPT
     {
-      if ((size() < view.size()))
-      {
-        return npos;
-      }
-
-      const_iterator iposition = etl::search(begin() + position, end(), view.begin(), view.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return private_basic_string::find_substring(mbegin, size(), position, view.data(), view.size());
     }
 
     ETL_CONSTEXPR14 size_type find(T c, size_type position = 0) const ETL_NOEXCEPT
@@ -555,26 +541,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type rfind(etl::basic_string_view<T, TTraits> view, size_type position = npos) const ETL_NOEXCEPT
     {
-      if ((size() < view.size()))
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size());
-
-      const_iterator iposition = etl::find_end(begin(),
-                                               begin() + position,
-                                               view.begin(),
-                                               view.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return private_basic_string::rfind_substring(mbegin, etl::min(position, size()), view.data(), view.size());
     }
 
     ETL_CONSTEXPR14 size_type rfind(T c, size_type position = npos) const ETL_NOEXCEPT
@@ -597,25 +564,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const ETL_NOEXCEPT
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0UL; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
-        }
-      }
-
-      return npos;
+      return private_basic_string::find_first_of(mbegin, size(), position, view.data(), view.size());
     }
 
     ETL_CONSTEXPR14 size_type find_first_of(T c, size_type position = 0) const ETL_NOEXCEPT
@@ -686,33 +635,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_not_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const ETL_NOEXCEPT
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0UL; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-              break;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return private_basic_string::find_first_not_of(mbegin, size(), position, view.data(), view.size());
     }
 
     ETL_CONSTEXPR14 size_type find_first_not_of(T c, size_type position = 0) const ETL_NOEXCEPT
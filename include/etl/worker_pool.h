@@ -0,0 +1,196 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WORKER_POOL_INCLUDED
+#define ETL_WORKER_POOL_INCLUDED
+
+#include "platform.h"
+#include "execution.h"
+#include "static_assert.h"
+
+#if ETL_USING_STL && ETL_USING_CPP11
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup execution
+  /// A fixed size pool of worker threads, implemented using std::thread.
+  /// The thread calling run() processes chunks alongside the workers, so the
+  /// pool can process N_Workers + 1 chunks at the same time.
+  /// Only one call to run() is active at a time. A task must not call run()
+  /// on the pool that is running it.
+  //***************************************************************************
+  template <size_t N_Workers>
+  class worker_pool : public etl::iworker_pool
+  {
+  public:
+
+    ETL_STATIC_ASSERT(N_Workers > 0U, "A worker pool needs at least one worker");
+
+    static ETL_CONSTANT size_t Workers = N_Workers;
+
+    //*************************************************************************
+    /// Constructor.
+    /// Starts the worker threads.
+    //*************************************************************************
+    worker_pool()
+      : p_task(ETL_NULLPTR)
+      , n_chunks(0U)
+      , next_chunk(0U)
+      , pending(0U)
+      , stopping(false)
+    {
+      for (size_t i = 0U; i < N_Workers; ++i)
+      {
+        threads[i] = std::thread(&worker_pool::worker, this);
+      }
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Stops and joins the worker threads.
+    //*************************************************************************
+    ~worker_pool()
+    {
+      {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        stopping = true;
+      }
+
+      work_available.notify_all();
+
+      for (size_t i = 0U; i < N_Workers; ++i)
+      {
+        threads[i].join();
+      }
+    }
+
+    //*************************************************************************
+    /// The number of chunks that may be processed at the same time.
+    //*************************************************************************
+    size_t concurrency() const ETL_OVERRIDE
+    {
+      return N_Workers + 1U;
+    }
+
+    //*************************************************************************
+    /// Calls task(index) for every index in [0, count).
+    /// Returns when all of the calls have completed.
+    //*************************************************************************
+    void run(etl::iparallel_task& task, size_t count) ETL_OVERRIDE
+    {
+      std::lock_guard<std::mutex> run_lock(run_mutex);
+
+      std::unique_lock<std::mutex> lock(state_mutex);
+
+      p_task     = &task;
+      n_chunks   = count;
+      next_chunk = 0U;
+      pending    = count;
+
+      work_available.notify_all();
+
+      // Help the workers.
+      while (next_chunk < n_chunks)
+      {
+        process_next_chunk(lock);
+      }
+
+      work_done.wait(lock, [this]() { return pending == 0U; });
+
+      p_task = ETL_NULLPTR;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Claims and processes the next chunk.
+    /// Called with the state mutex locked.
+    //*************************************************************************
+    void process_next_chunk(std::unique_lock<std::mutex>& lock)
+    {
+      const size_t index = next_chunk++;
+      etl::iparallel_task& task = *p_task;
+
+      lock.unlock();
+      task(index);
+      lock.lock();
+
+      if (--pending == 0U)
+      {
+        work_done.notify_all();
+      }
+    }
+
+    //*************************************************************************
+    /// The worker thread loop.
+    //*************************************************************************
+    void worker()
+    {
+      std::unique_lock<std::mutex> lock(state_mutex);
+
+      while (true)
+      {
+        work_available.wait(lock, [this]() { return stopping || ((p_task != ETL_NULLPTR) && (next_chunk < n_chunks)); });
+
+        if (stopping)
+        {
+          return;
+        }
+
+        process_next_chunk(lock);
+      }
+    }
+
+    worker_pool(const worker_pool&) ETL_DELETE;
+    worker_pool& operator =(const worker_pool&) ETL_DELETE;
+
+    std::thread             threads[N_Workers];
+    std::mutex              run_mutex;
+    std::mutex              state_mutex;
+    std::condition_variable work_available;
+    std::condition_variable work_done;
+
+    etl::iparallel_task* p_task;
+    size_t               n_chunks;
+    size_t               next_chunk;
+    size_t               pending;
+    bool                 stopping;
+  };
+}
+
+#endif
+#endif
@@ -854,6 +854,98 @@ namespace
       CHECK(itr1 == itr2);
     }
 
+    //*************************************************************************
+    TEST(search_default_searcher)
+    {
+      std::string haystack = "ABCDFEGHIJKLMNOPQRSTUVWXYZ";
+      std::string needle   = "KLMNO";
+      std::string missing  = "KLMNX";
+
+      etl::default_searcher<std::string::iterator> searcher(needle.begin(), needle.end());
+
+      std::pair<std::string::iterator, std::string::iterator> expected(haystack.begin() + 10, haystack.begin() + 15);
+      etl::pair<std::string::iterator, std::string::iterator> result = searcher(haystack.begin(), haystack.end());
+
+      CHECK(expected.first == result.first);
+      CHECK(expected.second == result.second);
+      CHECK(haystack.begin() + 10 == etl::search(haystack.begin(), haystack.end(), searcher));
+
+      etl::default_searcher<std::string::iterator> missing_searcher(missing.begin(), missing.end());
+
+      result = missing_searcher(haystack.begin(), haystack.end());
+
+      CHECK(haystack.end() == result.first);
+      CHECK(haystack.end() == result.second);
+    }
+
+    //*************************************************************************
+    TEST(search_boyer_moore_horspool_searcher)
+    {
+      std::mt19937 generator(1234);
+      std::uniform_int_distribution<int> distribution(0, 3);
+
+      std::string haystack;
+
+      for (size_t i = 0UL; i < 1000UL; ++i)
+      {
+        haystack.push_back(char('a' + distribution(generator)));
+      }
+
+      for (size_t length = 0UL; length < 12UL; ++length)
+      {
+        for (size_t start = 0UL; start < 100UL; start += 7UL)
+        {
+          std::string needle = haystack.substr(start + 500UL, length);
+          needle.append(length % 3UL, 'd');
+
+          etl::boyer_moore_horspool_searcher<std::string::const_iterator> searcher(needle.cbegin(), needle.cend());
+
+          std::string::const_iterator expected = std::search(haystack.cbegin(), haystack.cend(), needle.cbegin(), needle.cend());
+          etl::pair<std::string::const_iterator, std::string::const_iterator> result = searcher(haystack.cbegin(), haystack.cend());
+
+          CHECK(expected == result.first);
+
+          if (expected != haystack.cend())
+          {
+            CHECK(expected + needle.size() == result.second);
+          }
+          else
+          {
+            CHECK(haystack.cend() == result.second);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(search_boyer_moore_horspool_searcher_long_pattern)
+    {
+      // Longer than the maximum skip.
+      std::string haystack(1000U, 'a');
+      std::string needle(300U, 'a');
+      needle.back() = 'b';
+      haystack.replace(650U, needle.size(), needle);
+
+      etl::boyer_moore_horspool_searcher<std::string::const_iterator> searcher(needle.cbegin(), needle.cend());
+
+      CHECK(haystack.cbegin() + 650U == etl::search(haystack.cbegin(), haystack.cend(), searcher));
+    }
+
+    //*************************************************************************
+    TEST(search_boyer_moore_horspool_searcher_wide_values)
+    {
+      // 0x0141 and 0x0041 share a skip table entry.
+      const std::u16string haystack = u"\u0141\u0141A\u0142A\u0141B";
+      const std::u16string needle   = u"A\u0141B";
+      const std::u16string missing  = u"\u0141AA";
+
+      etl::boyer_moore_horspool_searcher<std::u16string::const_iterator> searcher(needle.cbegin(), needle.cend());
+      etl::boyer_moore_horspool_searcher<std::u16string::const_iterator> missing_searcher(missing.cbegin(), missing.cend());
+
+      CHECK(haystack.cbegin() + 4U == etl::search(haystack.cbegin(), haystack.cend(), searcher));
+      CHECK(haystack.cend() == etl::search(haystack.cbegin(), haystack.cend(), missing_searcher));
+    }
+
     //*************************************************************************
     TEST(heap)
     {
@@ -2504,5 +2596,116 @@ namespace
       CHECK_EQUAL(0, result5);
       CHECK_EQUAL(10, result6);
     }
+    //*************************************************************************
+    template <typename T>
+    void check_block_kernels(T unique_value)
+    {
+      // Lengths either side of the block sizes, positions at the start, middle and end.
+      for (size_t length = 0U; length < 150U; length += 7U)
+      {
+        std::vector<T> values(length);
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          values[i] = T(i % 23U);
+        }
+
+        for (size_t position = 0U; position < length; position += 5U)
+        {
+          std::vector<T> modified(values);
+          modified[position] = unique_value;
+
+          const T* first = modified.data();
+          const T* last  = modified.data() + length;
+
+          CHECK_EQUAL(std::find(first, last, unique_value) - first,  etl::find(first, last, unique_value) - first);
+          CHECK_EQUAL(std::count(first, last, T(3)),                 etl::count(first, last, T(3)));
+          CHECK_EQUAL(std::min_element(first, last) - first,         etl::min_element(first, last) - first);
+          CHECK_EQUAL(std::max_element(first, last) - first,         etl::max_element(first, last) - first);
+          CHECK_EQUAL(std::minmax_element(first, last).first - first,  etl::minmax_element(first, last).first - first);
+          CHECK_EQUAL(std::minmax_element(first, last).second - first, etl::minmax_element(first, last).second - first);
+
+          CHECK(!etl::equal(values.data(), values.data() + length, first));
+          CHECK(etl::equal(first, last, modified.data()));
+          CHECK(!etl::equal(first, last, values.data(), values.data() + length));
+          CHECK(etl::equal(first, last, modified.data(), modified.data() + length));
+          CHECK(!etl::equal(first, last, modified.data(), modified.data() + length - 1U));
+
+          CHECK_EQUAL(std::mismatch(values.data(), values.data() + length, first).first - values.data(),
+                      etl::mismatch(values.data(), values.data() + length, first).first - values.data());
+          CHECK_EQUAL(std::mismatch(values.data(), values.data() + length, first).second - first,
+                      etl::mismatch(values.data(), values.data() + length, first).second - first);
+        }
+
+        CHECK(etl::find(values.data(), values.data() + length, unique_value) == values.data() + length);
+      }
+    }
+
+    //*************************************************************************
+    TEST(block_kernels)
+    {
+      check_block_kernels<int8_t>(int8_t(-100));
+      check_block_kernels<uint8_t>(uint8_t(200));
+      check_block_kernels<int16_t>(int16_t(-1000));
+      check_block_kernels<uint32_t>(uint32_t(100000));
+      check_block_kernels<int64_t>(int64_t(-1000000));
+      check_block_kernels<float>(-1.5f);
+      check_block_kernels<double>(1.0e10);
+    }
+
+    //*************************************************************************
+    TEST(minmax_element_block_kernels_duplicates)
+    {
+      // First smallest and last largest, as for the generic algorithm.
+      int data1[] = { 5, 1, 9, 1, 9, 3, 1, 9, 2 };
+
+      CHECK_EQUAL(1, etl::min_element(std::begin(data1), std::end(data1)) - std::begin(data1));
+      CHECK_EQUAL(2, etl::max_element(std::begin(data1), std::end(data1)) - std::begin(data1));
+      CHECK_EQUAL(1, etl::minmax_element(std::begin(data1), std::end(data1)).first  - std::begin(data1));
+      CHECK_EQUAL(7, etl::minmax_element(std::begin(data1), std::end(data1)).second - std::begin(data1));
+    }
+
+    //*************************************************************************
+    TEST(mismatch)
+    {
+      std::list<int> data1 = { 1, 2, 3, 4, 5 };
+      std::list<int> data2 = { 1, 2, 9, 4, 5, 6 };
+
+      auto result = etl::mismatch(data1.begin(), data1.end(), data2.begin());
+      CHECK_EQUAL(3, *result.first);
+      CHECK_EQUAL(9, *result.second);
+
+      result = etl::mismatch(data1.begin(), data1.end(), data2.begin(), std::not_equal_to<int>());
+      CHECK(result.first == data1.begin());
+
+      auto result2 = etl::mismatch(data2.begin(), data2.end(), data1.begin(), data1.end());
+      CHECK_EQUAL(9, *result2.first);
+
+      // Bounded by the shorter range.
+      int a[] = { 1, 2, 3, 4 };
+      int b[] = { 1, 2 };
+      auto result3 = etl::mismatch(std::begin(a), std::end(a), std::begin(b), std::end(b));
+      CHECK(result3.first  == a + 2);
+      CHECK(result3.second == std::end(b));
+
+      auto result4 = etl::mismatch(std::begin(a), std::end(a), std::begin(b), std::end(b), std::equal_to<int>());
+      CHECK(result4.first == a + 2);
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(block_kernels_constexpr)
+    {
+      static constexpr int data1[] = { 4, 2, 7, 2, 9, 1, 7 };
+
+      constexpr const int* found   = etl::find(std::begin(data1), std::end(data1), 7);
+      constexpr ptrdiff_t  count   = etl::count(std::begin(data1), std::end(data1), 2);
+      constexpr const int* minimum = etl::min_element(std::begin(data1), std::end(data1));
+
+      CHECK_EQUAL(2, found - data1);
+      CHECK_EQUAL(2, count);
+      CHECK_EQUAL(5, minimum - data1);
+    }
+#endif
   }
 }
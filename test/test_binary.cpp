@@ -2503,6 +2503,18 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_count_leading_zeros_64_every_width)
+    {
+      for (size_t i = 0; i < 64; ++i)
+      {
+        uint64_t value = uint64_t(1U) << i;
+
+        CHECK_EQUAL(int(test_leading_zeros(value)), int(etl::count_leading_zeros(value)));
+        CHECK_EQUAL(int(test_leading_zeros(value | 1U)), int(etl::count_leading_zeros(value | 1U)));
+      }
+    }
+
 #if ETL_USING_CPP14
     //*************************************************************************
     TEST(test_count_leading_zeros_64_constexpr)
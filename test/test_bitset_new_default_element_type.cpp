@@ -31,6 +31,8 @@ SOFTWARE.
 #include <limits>
 #include <type_traits>
 #include <bitset>
+#include <string>
+#include <vector>
 
 #include "etl/private/bitset_new.h"
 #include "etl/string.h"
@@ -2709,5 +2711,153 @@ namespace
 
       CHECK_EQUAL(32, ETL_OR_STD17::size(b));
     }
+
+    //*************************************************************************
+    template <typename TElement>
+    void check_wide_word_operations()
+    {
+      static etl::bitset<1000, TElement> bs1;
+      static etl::bitset<1000, TElement> bs2;
+      std::bitset<1000> compare1;
+      std::bitset<1000> compare2;
+
+      for (size_t i = 0U; i < 1000U; i += 7U)
+      {
+        bs1.set(i);
+        compare1.set(i);
+      }
+
+      for (size_t i = 3U; i < 1000U; i += 5U)
+      {
+        bs2.set(i);
+        compare2.set(i);
+      }
+
+      CHECK_EQUAL(compare1.count(), bs1.count());
+
+      etl::bitset<1000, TElement> result = bs1 & bs2;
+      CHECK_EQUAL((compare1 & compare2).to_string(), result.template to_string<std::string>());
+
+      result = bs1 | bs2;
+      CHECK_EQUAL((compare1 | compare2).to_string(), result.template to_string<std::string>());
+
+      result = bs1 ^ bs2;
+      CHECK_EQUAL((compare1 ^ compare2).to_string(), result.template to_string<std::string>());
+
+      // Find every bit in both states.
+      for (size_t i = 0U; i < 1000U; ++i)
+      {
+        size_t expected_true  = i;
+        size_t expected_false = i;
+
+        while ((expected_true < 1000U) && !compare1.test(expected_true))
+        {
+          ++expected_true;
+        }
+
+        while ((expected_false < 1000U) && compare1.test(expected_false))
+        {
+          ++expected_false;
+        }
+
+        CHECK_EQUAL((expected_true  == 1000U) ? bs1.npos : expected_true,  bs1.find_next(true, i));
+        CHECK_EQUAL((expected_false == 1000U) ? bs1.npos : expected_false, bs1.find_next(false, i));
+      }
+
+      CHECK_EQUAL(bs1.npos, bs1.find_next(true, 1000U));
+
+      // The unused bits of the last element are never found.
+      etl::bitset<1000, TElement> all_set;
+      all_set.set();
+      CHECK_EQUAL(bs1.npos, all_set.find_next(false, 0U));
+      CHECK_EQUAL(999U, all_set.find_next(true, 999U));
+
+      // Each set bit, in order.
+      std::vector<size_t> positions;
+      bs1.for_each_set_bit([&positions](size_t position) { positions.push_back(position); });
+
+      std::vector<size_t> expected;
+      for (size_t i = 0U; i < 1000U; i += 7U)
+      {
+        expected.push_back(i);
+      }
+
+      CHECK_TRUE(expected == positions);
+    }
+
+    //*************************************************************************
+    TEST(test_wide_word_operations)
+    {
+      check_wide_word_operations<uint8_t>();
+      check_wide_word_operations<uint16_t>();
+      check_wide_word_operations<uint32_t>();
+      check_wide_word_operations<uint64_t>();
+    }
+
+    //*************************************************************************
+    TEST(test_find_next_upper_half_of_64_bit_element)
+    {
+      etl::bitset<128, uint64_t> bs;
+      bs.set(40U);
+      bs.set(100U);
+
+      CHECK_EQUAL(40U,  bs.find_next(true, 33U));
+      CHECK_EQUAL(100U, bs.find_next(true, 41U));
+      CHECK_EQUAL(41U,  bs.find_next(false, 40U));
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_set_bit)
+    {
+      etl::bitset<70> bs;
+      bs.set(0U);
+      bs.set(9U);
+      bs.set(63U);
+      bs.set(64U);
+      bs.set(69U);
+
+      struct accumulator
+      {
+        void operator()(size_t position)
+        {
+          sum += position;
+          ++count;
+        }
+
+        size_t sum   = 0U;
+        size_t count = 0U;
+      };
+
+      accumulator result = bs.for_each_set_bit(accumulator());
+
+      CHECK_EQUAL(5U, result.count);
+      CHECK_EQUAL(0U + 9U + 63U + 64U + 69U, result.sum);
+
+      etl::bitset<70> empty;
+      CHECK_EQUAL(0U, empty.for_each_set_bit(accumulator()).count);
+    }
+
+    //*************************************************************************
+    TEST(test_set_span)
+    {
+      const size_t positions[] = { 1U, 17U, 64U, 99U };
+
+      etl::bitset<100> bs;
+      bs.set(etl::span<const size_t>(positions));
+
+      CHECK_EQUAL(4U, bs.count());
+      CHECK_TRUE(bs.test(1U));
+      CHECK_TRUE(bs.test(17U));
+      CHECK_TRUE(bs.test(64U));
+      CHECK_TRUE(bs.test(99U));
+
+      bs.set(etl::span<const size_t>(positions, 2U), false);
+      CHECK_EQUAL(2U, bs.count());
+      CHECK_FALSE(bs.test(1U));
+      CHECK_FALSE(bs.test(17U));
+
+      const size_t bad_positions[] = { 5U, 100U };
+      CHECK_THROW(bs.set(etl::span<const size_t>(bad_positions)), etl::bitset_overflow);
+    }
   }
 }
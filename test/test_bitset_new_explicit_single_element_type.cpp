@@ -31,6 +31,7 @@ SOFTWARE.
 #include <limits>
 #include <type_traits>
 #include <bitset>
+#include <vector>
 
 #include "etl/private/bitset_new.h"
 #include "etl/string.h"
@@ -2823,5 +2824,48 @@ namespace
 
       CHECK_EQUAL(32, ETL_OR_STD17::size(b));
     }
+
+    //*************************************************************************
+    TEST(test_find_next_upper_half_of_64_bit_element)
+    {
+      etl::bitset<64, uint64_t> bs;
+      bs.set(40U);
+      bs.set(63U);
+
+      CHECK_EQUAL(40U, bs.find_next(true, 33U));
+      CHECK_EQUAL(63U, bs.find_next(true, 41U));
+      CHECK_EQUAL(41U, bs.find_next(false, 40U));
+      CHECK_EQUAL(etl::bitset<>::npos, bs.find_next(true, 64U));
+
+      etl::bitset<40, uint64_t> partial;
+      partial.set();
+      CHECK_EQUAL(etl::bitset<>::npos, partial.find_next(false, 0U));
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_set_bit)
+    {
+      etl::bitset<64, uint64_t> bs;
+      bs.set(0U);
+      bs.set(31U);
+      bs.set(63U);
+
+      std::vector<size_t> positions;
+      bs.for_each_set_bit([&positions](size_t position) { positions.push_back(position); });
+
+      std::vector<size_t> expected = { 0U, 31U, 63U };
+      CHECK_TRUE(expected == positions);
+    }
+
+    //*************************************************************************
+    TEST(test_set_span)
+    {
+      const size_t positions[] = { 2U, 5U, 7U };
+
+      etl::bitset<8, uint8_t> bs;
+      bs.set(etl::span<const size_t>(positions));
+
+      CHECK_EQUAL(0xA4U, bs.value<uint8_t>());
+    }
   }
 }
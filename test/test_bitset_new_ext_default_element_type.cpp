@@ -31,6 +31,7 @@ SOFTWARE.
 #include <limits>
 #include <type_traits>
 #include <bitset>
+#include <vector>
 
 #include "etl/private/bitset_new.h"
 #include "etl/string.h"
@@ -2459,5 +2460,23 @@ namespace
 
       CHECK_EQUAL(32, ETL_OR_STD17::size(b));
     }
+
+    //*************************************************************************
+    TEST(test_for_each_set_bit_and_set_span)
+    {
+      etl::bitset_ext<1000>::buffer_type buffer;
+      etl::bitset_ext<1000> bs(buffer);
+
+      const size_t positions[] = { 3U, 64U, 500U, 999U };
+      bs.set(etl::span<const size_t>(positions));
+
+      std::vector<size_t> found;
+      bs.for_each_set_bit([&found](size_t position) { found.push_back(position); });
+
+      std::vector<size_t> expected(positions, positions + 4U);
+      CHECK_TRUE(expected == found);
+      CHECK_EQUAL(4U, bs.count());
+      CHECK_EQUAL(500U, bs.find_next(true, 65U));
+    }
   }
 }
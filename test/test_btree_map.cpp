@@ -0,0 +1,366 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/btree_map.h"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <random>
+
+namespace
+{
+  SUITE(test_btree_map)
+  {
+    static const size_t SIZE = 1000U;
+
+    typedef etl::btree_map<int, int, SIZE>       Data;
+    typedef etl::ibtree_map<int, int>            IData;
+    typedef etl::btree_map<int, int, SIZE, 4>    Data4;
+    typedef etl::btree_map<int, int, SIZE, 5>    Data5;
+    typedef std::map<int, int>                   Compare;
+
+    //*************************************************************************
+    template <typename TData>
+    bool is_equal(const TData& data, const Compare& compare)
+    {
+      if (data.size() != compare.size())
+      {
+        return false;
+      }
+
+      typename TData::const_iterator itr = data.begin();
+
+      for (Compare::const_iterator citr = compare.begin(); citr != compare.end(); ++citr, ++itr)
+      {
+        if ((itr->first != citr->first) || (itr->second != citr->second))
+        {
+          return false;
+        }
+      }
+
+      return itr == data.end();
+    }
+
+    //*************************************************************************
+    template <typename TData>
+    void random_insert_and_erase(unsigned seed)
+    {
+      TData data;
+      Compare compare;
+      std::mt19937 generator(seed);
+      std::uniform_int_distribution<int> key_distribution(0, 1999);
+
+      for (int round = 0; round < 3; ++round)
+      {
+        // Fill.
+        while (compare.size() < SIZE)
+        {
+          const int key = key_distribution(generator);
+          const bool inserted = data.insert(std::make_pair(key, key * 10)).second;
+
+          CHECK_EQUAL(compare.insert(std::make_pair(key, key * 10)).second, inserted);
+        }
+
+        CHECK_TRUE(data.full());
+        CHECK_TRUE(is_equal(data, compare));
+
+        // Empty most of it.
+        while (compare.size() > (SIZE / 10U))
+        {
+          const int key = key_distribution(generator);
+
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+
+        CHECK_TRUE(is_equal(data, compare));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK_TRUE(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK_EQUAL(0U, data.height());
+      CHECK_TRUE(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_ascending_and_descending)
+    {
+      Data  ascending;
+      Data4 descending;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        ascending.insert(std::make_pair(i, i));
+        descending.insert(std::make_pair(int(SIZE) - 1 - i, i));
+      }
+
+      CHECK_TRUE(ascending.full());
+      CHECK_TRUE(descending.full());
+
+      int expected = 0;
+
+      for (Data::const_iterator itr = ascending.begin(); itr != ascending.end(); ++itr)
+      {
+        CHECK_EQUAL(expected++, itr->first);
+      }
+
+      CHECK_EQUAL(int(SIZE), expected);
+
+      for (Data4::const_reverse_iterator itr = descending.rbegin(); itr != descending.rend(); ++itr)
+      {
+        CHECK_EQUAL(--expected, itr->first);
+      }
+
+      CHECK_EQUAL(0, expected);
+      CHECK(ascending.height() < descending.height());
+    }
+
+    //*************************************************************************
+    TEST(test_random_insert_and_erase)
+    {
+      random_insert_and_erase<Data>(1U);
+      random_insert_and_erase<Data4>(2U);
+      random_insert_and_erase<Data5>(3U);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_existing)
+    {
+      Data data;
+
+      CHECK_TRUE(data.insert(std::make_pair(1, 10)).second);
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(std::make_pair(1, 20));
+
+      CHECK_FALSE(result.second);
+      CHECK_EQUAL(10, result.first->second);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::btree_map<int, int, 10, 4> data;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK_THROW(data.insert(std::make_pair(10, 10)), etl::btree_full);
+
+      // An existing key does not need space.
+      CHECK_FALSE(data.insert(std::make_pair(5, 5)).second);
+    }
+
+    //*************************************************************************
+    TEST(test_index_and_at)
+    {
+      Data data;
+
+      data[3] = 30;
+      data[1] = 10;
+      data[2];
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(10, data.at(1));
+      CHECK_EQUAL(0, data.at(2));
+      CHECK_EQUAL(30, data[3]);
+
+      const Data& cdata = data;
+      CHECK_EQUAL(30, cdata.at(3));
+      CHECK_THROW(data.at(4), etl::btree_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_bounds_and_equal_range)
+    {
+      Data4   data;
+      Compare compare;
+
+      for (int i = 0; i < 200; i += 2)
+      {
+        data.insert(std::make_pair(i, i));
+        compare.insert(std::make_pair(i, i));
+      }
+
+      for (int i = -1; i <= 200; ++i)
+      {
+        Data4::iterator   lower = data.lower_bound(i);
+        Compare::iterator clower = compare.lower_bound(i);
+
+        CHECK_EQUAL(clower == compare.end(), lower == data.end());
+
+        if (clower != compare.end())
+        {
+          CHECK_EQUAL(clower->first, lower->first);
+        }
+
+        Data4::const_iterator upper  = static_cast<const Data4&>(data).upper_bound(i);
+        Compare::iterator     cupper = compare.upper_bound(i);
+
+        CHECK_EQUAL(cupper == compare.end(), upper == data.end());
+
+        if (cupper != compare.end())
+        {
+          CHECK_EQUAL(cupper->first, upper->first);
+        }
+
+        ETL_OR_STD::pair<Data4::iterator, Data4::iterator> range = data.equal_range(i);
+        CHECK_EQUAL(compare.count(i), size_t(std::distance(range.first, range.second)));
+        CHECK_EQUAL(compare.count(i), data.count(i));
+        CHECK_EQUAL(compare.count(i) == 1U, data.contains(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator_and_range)
+    {
+      Data4   data;
+      Compare compare;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data.insert(std::make_pair(i, i));
+        compare.insert(std::make_pair(i, i));
+      }
+
+      // Erase every other value while iterating.
+      Data4::iterator itr = data.begin();
+
+      while (itr != data.end())
+      {
+        itr = data.erase(itr);
+
+        if (itr != data.end())
+        {
+          ++itr;
+        }
+      }
+
+      for (int i = 0; i < 100; i += 2)
+      {
+        compare.erase(i);
+      }
+
+      CHECK_TRUE(is_equal(data, compare));
+
+      data.erase(data.find(21), data.find(61));
+      compare.erase(compare.find(21), compare.find(61));
+      CHECK_TRUE(is_equal(data, compare));
+
+      data.erase(data.find(81), data.end());
+      compare.erase(compare.find(81), compare.end());
+      CHECK_TRUE(is_equal(data, compare));
+
+      data.erase(data.begin(), data.end());
+      CHECK_TRUE(data.empty());
+      CHECK_EQUAL(0U, data.height());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_move_and_compare)
+    {
+      Data data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data[i] = i * i;
+      }
+
+      Data copy(data);
+      CHECK_TRUE(copy == data);
+
+      copy.erase(99);
+      CHECK_TRUE(copy != data);
+      CHECK_TRUE(copy < data);
+
+      Data moved(std::move(copy));
+      CHECK_TRUE(copy.empty());
+      CHECK_EQUAL(99U, moved.size());
+
+      IData& idata = moved;
+      idata = data;
+      CHECK_TRUE(moved == data);
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys_and_transparent_comparator)
+    {
+      typedef etl::btree_map<std::string, std::string, 100, 4, etl::less<> > SData;
+
+      SData data;
+      std::map<std::string, std::string> compare;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        const std::string key = std::to_string((i * 37) % 100);
+        data.insert(std::make_pair(key, key + "!"));
+        compare.insert(std::make_pair(key, key + "!"));
+      }
+
+      CHECK_TRUE(std::equal(compare.begin(), compare.end(), data.begin()));
+      CHECK_EQUAL("42!", data.at("42"));
+      CHECK_TRUE(data.contains("7"));
+      CHECK_TRUE(data.find("100") == data.end());
+
+      for (int i = 0; i < 100; i += 3)
+      {
+        CHECK_EQUAL(1U, data.erase(std::to_string(i)));
+        compare.erase(std::to_string(i));
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK_TRUE(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_and_initializer_list)
+    {
+      Data data = { { 3, 30 }, { 1, 10 }, { 2, 20 } };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, data.begin()->first);
+
+      CHECK_TRUE(data.emplace(4, 40).second);
+      CHECK_FALSE(data.emplace(4, 41).second);
+      CHECK_EQUAL(40, data[4]);
+    }
+  }
+}
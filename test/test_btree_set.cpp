@@ -0,0 +1,147 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/btree_set.h"
+
+#include <set>
+#include <string>
+#include <algorithm>
+#include <random>
+
+namespace
+{
+  SUITE(test_btree_set)
+  {
+    static const size_t SIZE = 500U;
+
+    typedef etl::btree_set<int, SIZE>    Data;
+    typedef etl::btree_set<int, SIZE, 4> Data4;
+    typedef std::set<int>                Compare;
+
+    //*************************************************************************
+    TEST(test_random_insert_and_erase)
+    {
+      Data4 data;
+      Compare compare;
+      std::mt19937 generator(7U);
+      std::uniform_int_distribution<int> key_distribution(0, 999);
+
+      for (int round = 0; round < 4; ++round)
+      {
+        while (compare.size() < SIZE)
+        {
+          const int key = key_distribution(generator);
+          CHECK_EQUAL(compare.insert(key).second, data.insert(key).second);
+        }
+
+        CHECK_TRUE(data.full());
+        CHECK_TRUE(std::equal(compare.begin(), compare.end(), data.begin()));
+
+        while (compare.size() > 10U)
+        {
+          const int key = key_distribution(generator);
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+
+        CHECK_TRUE(std::equal(compare.begin(), compare.end(), data.begin()));
+      }
+
+      data.clear();
+      CHECK_TRUE(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_bounds)
+    {
+      Data data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data.insert(i * 3);
+      }
+
+      CHECK_EQUAL(30, *data.find(30));
+      CHECK_TRUE(data.find(31) == data.end());
+      CHECK_EQUAL(33, *data.lower_bound(31));
+      CHECK_EQUAL(33, *data.upper_bound(30));
+      CHECK_TRUE(data.lower_bound(300) == data.end());
+      CHECK_EQUAL(1U, data.count(99));
+      CHECK_EQUAL(0U, data.count(100));
+    }
+
+    //*************************************************************************
+    TEST(test_range_scan)
+    {
+      Data data;
+      std::vector<int> expected;
+
+      for (int i = 0; i < 400; ++i)
+      {
+        data.insert(i);
+      }
+
+      for (int i = 100; i < 250; ++i)
+      {
+        expected.push_back(i);
+      }
+
+      std::vector<int> result(data.lower_bound(100), data.lower_bound(250));
+
+      CHECK_TRUE(expected == result);
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      etl::btree_set<std::string, 50, 4> data;
+      std::set<std::string> compare;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        data.insert(std::to_string(i));
+        compare.insert(std::to_string(i));
+      }
+
+      CHECK_TRUE(std::equal(compare.begin(), compare.end(), data.begin()));
+
+      etl::btree_set<std::string, 50, 4> copy(data);
+      CHECK_TRUE(copy == data);
+
+      for (int i = 0; i < 50; i += 2)
+      {
+        copy.erase(std::to_string(i));
+        compare.erase(std::to_string(i));
+      }
+
+      CHECK_TRUE(std::equal(compare.begin(), compare.end(), copy.begin()));
+      CHECK_TRUE(copy != data);
+    }
+  }
+}
@@ -991,6 +991,133 @@ namespace
       CHECK(isEqual);
     }
 
+    //*************************************************************************
+    TEST(test_push_span)
+    {
+      Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
+      Data data;
+
+      data.push(etl::span<const Ndc>(input.data(), input.size()));
+
+      CHECK_EQUAL(input.size(), data.size());
+      CHECK(std::equal(input.begin(), input.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_push_span_overlap_start_and_end_of_buffer)
+    {
+      Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7") };
+      Compare input2{ Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
+      Compare expected{ Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
+      Data data;
+
+      data.push(etl::span<const Ndc>(input1.data(), input1.size()));
+      data.pop(2);
+      data.push(etl::span<const Ndc>(input2.data(), input2.size()));
+
+      CHECK(data.full());
+      CHECK_EQUAL(expected.size(), data.size());
+      CHECK(std::equal(expected.begin(), expected.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_push_span_excess)
+    {
+      Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
+      Data data;
+
+      data.push(Ndc("A"));
+      data.push(etl::span<const Ndc>(input.data(), input.size()));
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(std::equal(input.end() - SIZE, input.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_pop_n)
+    {
+      Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
+      Data data;
+      data.push(input.begin(), input.end());
+
+      // The stored items wrap around the end of the buffer.
+      data.pop(7);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(std::equal(input.end() - 3, input.end(), data.begin()));
+
+      data.pop(3);
+      CHECK(data.empty());
+
+      CHECK_THROW(data.pop(1), etl::circular_buffer_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_array_one_array_two)
+    {
+      using CB = etl::circular_buffer<int, SIZE>;
+
+      std::vector<int> input = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+      CB data;
+
+      CHECK(data.array_one().empty());
+      CHECK(data.array_two().empty());
+
+      data.push(input.begin(), input.begin() + 4);
+
+      CHECK_EQUAL(4U, data.array_one().size());
+      CHECK(data.array_two().empty());
+      CHECK(std::equal(input.begin(), input.begin() + 4, data.array_one().begin()));
+
+      // Wrap around.
+      data.push(input.begin() + 4, input.end());
+
+      etl::span<int> one = data.array_one();
+      etl::span<int> two = data.array_two();
+
+      CHECK_EQUAL(data.size(), one.size() + two.size());
+      CHECK(!two.empty());
+      CHECK(std::equal(one.begin(), one.end(), data.begin()));
+      CHECK(std::equal(two.begin(), two.end(), data.begin() + one.size()));
+
+      const CB& cdata = data;
+      CHECK(cdata.array_one().data() == one.data());
+      CHECK(cdata.array_two().data() == two.data());
+    }
+
+    //*************************************************************************
+    TEST(test_free_arrays_and_commit)
+    {
+      using CB = etl::circular_buffer<int, SIZE>;
+
+      const int input[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+      CB data;
+
+      // Move the indexes to the middle of the buffer.
+      data.push(etl::span<const int>(input, 6U));
+      data.pop(6);
+
+      etl::span<int> one = data.free_array_one();
+      etl::span<int> two = data.free_array_two();
+
+      CHECK_EQUAL(SIZE, one.size() + two.size());
+      CHECK(!two.empty());
+
+      memcpy(one.data(), input, one.size() * sizeof(int));
+      memcpy(two.data(), input + one.size(), (SIZE - one.size()) * sizeof(int));
+      data.commit(SIZE);
+
+      CHECK(data.full());
+      CHECK(std::equal(input, input + SIZE, data.begin()));
+      CHECK(data.free_array_one().empty());
+      CHECK(data.free_array_two().empty());
+
+      CHECK_THROW(data.commit(1U), etl::circular_buffer_full);
+
+      data.pop(4);
+      CHECK_EQUAL(4U, data.free_array_one().size() + data.free_array_two().size());
+    }
+
     //*************************************************************************
     TEST(test_memcpy_repair)
     {
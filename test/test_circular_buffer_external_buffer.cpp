@@ -1096,5 +1096,30 @@ namespace
 
       CHECK(data1 != data2);
     }
+
+    //*************************************************************************
+    TEST(test_push_span_and_contiguous_blocks)
+    {
+      using CB = etl::circular_buffer_ext<int>;
+
+      const int input[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+      etl::uninitialized_buffer_of<int, SIZE + 1> buffer;
+      CB data(buffer.raw, SIZE);
+
+      data.push(etl::span<const int>(input, 8U));
+      data.pop(5);
+      data.push(etl::span<const int>(input + 8, 5U));
+
+      etl::span<int> one = data.array_one();
+      etl::span<int> two = data.array_two();
+
+      CHECK_EQUAL(8U, data.size());
+      CHECK_EQUAL(data.size(), one.size() + two.size());
+      CHECK(std::equal(input + 5, input + 13, data.begin()));
+      CHECK(std::equal(one.begin(), one.end(), input + 5));
+      CHECK(std::equal(two.begin(), two.end(), input + 5 + one.size()));
+
+      CHECK_EQUAL(2U, data.free_array_one().size() + data.free_array_two().size());
+    }
   }
 }
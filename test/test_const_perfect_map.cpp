@@ -0,0 +1,623 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/const_perfect_map.h"
+#include "etl/string_view.h"
+
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#if ETL_USING_CPP14
+
+namespace
+{
+  using Keywords = etl::const_perfect_map<etl::string_view, int, 51>;
+  using Keyword  = Keywords::value_type;
+
+  using Numbers  = etl::const_perfect_map<int, int, 200>;
+  using Number   = Numbers::value_type;
+
+  enum class Colour
+  {
+    Red,
+    Green,
+    Blue
+  };
+
+  const char* const keyword_text[] =
+  {
+    "GET",
+    "HEAD",
+    "POST",
+    "PUT",
+    "DELETE",
+    "CONNECT",
+    "OPTIONS",
+    "TRACE",
+    "PATCH",
+    "Accept",
+    "Accept-Charset",
+    "Accept-Encoding",
+    "Accept-Language",
+    "Authorization",
+    "Cache-Control",
+    "Connection",
+    "Content-Length",
+    "Content-Type",
+    "Cookie",
+    "Date",
+    "Expect",
+    "From",
+    "Host",
+    "If-Match",
+    "If-Modified-Since",
+    "If-None-Match",
+    "If-Range",
+    "If-Unmodified-Since",
+    "Max-Forwards",
+    "Origin",
+    "Pragma",
+    "Proxy-Authorization",
+    "Range",
+    "Referer",
+    "TE",
+    "Trailer",
+    "Transfer-Encoding",
+    "Upgrade",
+    "User-Agent",
+    "Via",
+    "Warning",
+    "ETag",
+    "Location",
+    "Server",
+    "Set-Cookie",
+    "Vary",
+    "WWW-Authenticate",
+    "Age",
+    "Allow",
+    "Expires",
+    "Last-Modified"
+  };
+
+  static constexpr Keywords keywords
+  {
+    Keyword{etl::string_view("GET"), 0},
+    Keyword{etl::string_view("HEAD"), 1},
+    Keyword{etl::string_view("POST"), 2},
+    Keyword{etl::string_view("PUT"), 3},
+    Keyword{etl::string_view("DELETE"), 4},
+    Keyword{etl::string_view("CONNECT"), 5},
+    Keyword{etl::string_view("OPTIONS"), 6},
+    Keyword{etl::string_view("TRACE"), 7},
+    Keyword{etl::string_view("PATCH"), 8},
+    Keyword{etl::string_view("Accept"), 9},
+    Keyword{etl::string_view("Accept-Charset"), 10},
+    Keyword{etl::string_view("Accept-Encoding"), 11},
+    Keyword{etl::string_view("Accept-Language"), 12},
+    Keyword{etl::string_view("Authorization"), 13},
+    Keyword{etl::string_view("Cache-Control"), 14},
+    Keyword{etl::string_view("Connection"), 15},
+    Keyword{etl::string_view("Content-Length"), 16},
+    Keyword{etl::string_view("Content-Type"), 17},
+    Keyword{etl::string_view("Cookie"), 18},
+    Keyword{etl::string_view("Date"), 19},
+    Keyword{etl::string_view("Expect"), 20},
+    Keyword{etl::string_view("From"), 21},
+    Keyword{etl::string_view("Host"), 22},
+    Keyword{etl::string_view("If-Match"), 23},
+    Keyword{etl::string_view("If-Modified-Since"), 24},
+    Keyword{etl::string_view("If-None-Match"), 25},
+    Keyword{etl::string_view("If-Range"), 26},
+    Keyword{etl::string_view("If-Unmodified-Since"), 27},
+    Keyword{etl::string_view("Max-Forwards"), 28},
+    Keyword{etl::string_view("Origin"), 29},
+    Keyword{etl::string_view("Pragma"), 30},
+    Keyword{etl::string_view("Proxy-Authorization"), 31},
+    Keyword{etl::string_view("Range"), 32},
+    Keyword{etl::string_view("Referer"), 33},
+    Keyword{etl::string_view("TE"), 34},
+    Keyword{etl::string_view("Trailer"), 35},
+    Keyword{etl::string_view("Transfer-Encoding"), 36},
+    Keyword{etl::string_view("Upgrade"), 37},
+    Keyword{etl::string_view("User-Agent"), 38},
+    Keyword{etl::string_view("Via"), 39},
+    Keyword{etl::string_view("Warning"), 40},
+    Keyword{etl::string_view("ETag"), 41},
+    Keyword{etl::string_view("Location"), 42},
+    Keyword{etl::string_view("Server"), 43},
+    Keyword{etl::string_view("Set-Cookie"), 44},
+    Keyword{etl::string_view("Vary"), 45},
+    Keyword{etl::string_view("WWW-Authenticate"), 46},
+    Keyword{etl::string_view("Age"), 47},
+    Keyword{etl::string_view("Allow"), 48},
+    Keyword{etl::string_view("Expires"), 49},
+    Keyword{etl::string_view("Last-Modified"), 50}
+  };
+
+  static constexpr Numbers numbers
+  {
+    Number{13, 0},
+    Number{7932, 1},
+    Number{15851, 2},
+    Number{23770, 3},
+    Number{31689, 4},
+    Number{39608, 5},
+    Number{47527, 6},
+    Number{55446, 7},
+    Number{63365, 8},
+    Number{71284, 9},
+    Number{79203, 10},
+    Number{87122, 11},
+    Number{95041, 12},
+    Number{2957, 13},
+    Number{10876, 14},
+    Number{18795, 15},
+    Number{26714, 16},
+    Number{34633, 17},
+    Number{42552, 18},
+    Number{50471, 19},
+    Number{58390, 20},
+    Number{66309, 21},
+    Number{74228, 22},
+    Number{82147, 23},
+    Number{90066, 24},
+    Number{97985, 25},
+    Number{5901, 26},
+    Number{13820, 27},
+    Number{21739, 28},
+    Number{29658, 29},
+    Number{37577, 30},
+    Number{45496, 31},
+    Number{53415, 32},
+    Number{61334, 33},
+    Number{69253, 34},
+    Number{77172, 35},
+    Number{85091, 36},
+    Number{93010, 37},
+    Number{926, 38},
+    Number{8845, 39},
+    Number{16764, 40},
+    Number{24683, 41},
+    Number{32602, 42},
+    Number{40521, 43},
+    Number{48440, 44},
+    Number{56359, 45},
+    Number{64278, 46},
+    Number{72197, 47},
+    Number{80116, 48},
+    Number{88035, 49},
+    Number{95954, 50},
+    Number{3870, 51},
+    Number{11789, 52},
+    Number{19708, 53},
+    Number{27627, 54},
+    Number{35546, 55},
+    Number{43465, 56},
+    Number{51384, 57},
+    Number{59303, 58},
+    Number{67222, 59},
+    Number{75141, 60},
+    Number{83060, 61},
+    Number{90979, 62},
+    Number{98898, 63},
+    Number{6814, 64},
+    Number{14733, 65},
+    Number{22652, 66},
+    Number{30571, 67},
+    Number{38490, 68},
+    Number{46409, 69},
+    Number{54328, 70},
+    Number{62247, 71},
+    Number{70166, 72},
+    Number{78085, 73},
+    Number{86004, 74},
+    Number{93923, 75},
+    Number{1839, 76},
+    Number{9758, 77},
+    Number{17677, 78},
+    Number{25596, 79},
+    Number{33515, 80},
+    Number{41434, 81},
+    Number{49353, 82},
+    Number{57272, 83},
+    Number{65191, 84},
+    Number{73110, 85},
+    Number{81029, 86},
+    Number{88948, 87},
+    Number{96867, 88},
+    Number{4783, 89},
+    Number{12702, 90},
+    Number{20621, 91},
+    Number{28540, 92},
+    Number{36459, 93},
+    Number{44378, 94},
+    Number{52297, 95},
+    Number{60216, 96},
+    Number{68135, 97},
+    Number{76054, 98},
+    Number{83973, 99},
+    Number{91892, 100},
+    Number{99811, 101},
+    Number{7727, 102},
+    Number{15646, 103},
+    Number{23565, 104},
+    Number{31484, 105},
+    Number{39403, 106},
+    Number{47322, 107},
+    Number{55241, 108},
+    Number{63160, 109},
+    Number{71079, 110},
+    Number{78998, 111},
+    Number{86917, 112},
+    Number{94836, 113},
+    Number{2752, 114},
+    Number{10671, 115},
+    Number{18590, 116},
+    Number{26509, 117},
+    Number{34428, 118},
+    Number{42347, 119},
+    Number{50266, 120},
+    Number{58185, 121},
+    Number{66104, 122},
+    Number{74023, 123},
+    Number{81942, 124},
+    Number{89861, 125},
+    Number{97780, 126},
+    Number{5696, 127},
+    Number{13615, 128},
+    Number{21534, 129},
+    Number{29453, 130},
+    Number{37372, 131},
+    Number{45291, 132},
+    Number{53210, 133},
+    Number{61129, 134},
+    Number{69048, 135},
+    Number{76967, 136},
+    Number{84886, 137},
+    Number{92805, 138},
+    Number{721, 139},
+    Number{8640, 140},
+    Number{16559, 141},
+    Number{24478, 142},
+    Number{32397, 143},
+    Number{40316, 144},
+    Number{48235, 145},
+    Number{56154, 146},
+    Number{64073, 147},
+    Number{71992, 148},
+    Number{79911, 149},
+    Number{87830, 150},
+    Number{95749, 151},
+    Number{3665, 152},
+    Number{11584, 153},
+    Number{19503, 154},
+    Number{27422, 155},
+    Number{35341, 156},
+    Number{43260, 157},
+    Number{51179, 158},
+    Number{59098, 159},
+    Number{67017, 160},
+    Number{74936, 161},
+    Number{82855, 162},
+    Number{90774, 163},
+    Number{98693, 164},
+    Number{6609, 165},
+    Number{14528, 166},
+    Number{22447, 167},
+    Number{30366, 168},
+    Number{38285, 169},
+    Number{46204, 170},
+    Number{54123, 171},
+    Number{62042, 172},
+    Number{69961, 173},
+    Number{77880, 174},
+    Number{85799, 175},
+    Number{93718, 176},
+    Number{1634, 177},
+    Number{9553, 178},
+    Number{17472, 179},
+    Number{25391, 180},
+    Number{33310, 181},
+    Number{41229, 182},
+    Number{49148, 183},
+    Number{57067, 184},
+    Number{64986, 185},
+    Number{72905, 186},
+    Number{80824, 187},
+    Number{88743, 188},
+    Number{96662, 189},
+    Number{4578, 190},
+    Number{12497, 191},
+    Number{20416, 192},
+    Number{28335, 193},
+    Number{36254, 194},
+    Number{44173, 195},
+    Number{52092, 196},
+    Number{60011, 197},
+    Number{67930, 198},
+    Number{75849, 199}
+  };
+
+  // Hashes every key to the same value.
+  struct ConstantHash
+  {
+    constexpr uint64_t operator()(int) const
+    {
+      return 42U;
+    }
+  };
+
+  // Hashes only the low digit.
+  struct LowDigitHash
+  {
+    constexpr uint64_t operator()(int key) const
+    {
+      return static_cast<uint64_t>(key % 10);
+    }
+  };
+
+  // A map of run time keys, built with the same algorithm as the constexpr maps.
+  template <size_t Size>
+  class LargeMap : public etl::iconst_perfect_map<uint32_t, uint32_t, etl::const_perfect_hash<uint32_t>, etl::equal_to<uint32_t>>
+  {
+  public:
+
+    using base_t = etl::iconst_perfect_map<uint32_t, uint32_t, etl::const_perfect_hash<uint32_t>, etl::equal_to<uint32_t>>;
+
+    LargeMap(const value_type* elements, uint16_t* slots, uint16_t* pilots)
+      : base_t(elements, slots, pilots, Size, Size)
+    {
+      this->template build<Size>(slots, pilots);
+    }
+  };
+
+  SUITE(test_const_perfect_map)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      static constexpr etl::const_perfect_map<int, int, 4> data;
+
+      static constexpr bool   is_valid = data.is_valid();
+      static constexpr bool   empty    = data.empty();
+      static constexpr size_t size     = data.size();
+      static constexpr bool   contains = data.contains(1);
+
+      CHECK_TRUE(is_valid);
+      CHECK_TRUE(empty);
+      CHECK_EQUAL(0U, size);
+      CHECK_FALSE(contains);
+      CHECK_TRUE(data.find(1) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constexpr_lookup)
+    {
+      using Data = etl::const_perfect_map<Colour, int, 4>;
+
+      static constexpr Data data{ Data::value_type{Colour::Red, 1}, Data::value_type{Colour::Blue, 3} };
+
+      static constexpr bool   is_valid       = data.is_valid();
+      static constexpr size_t size           = data.size();
+      static constexpr bool   full           = data.full();
+      static constexpr size_t capacity       = data.capacity();
+      static constexpr int    red            = data[Colour::Red];
+      static constexpr int    blue           = data.at(Colour::Blue);
+      static constexpr bool   contains_green = data.contains(Colour::Green);
+      static constexpr size_t count_red      = data.count(Colour::Red);
+
+      CHECK_TRUE(is_valid);
+      CHECK_EQUAL(2U, size);
+      CHECK_FALSE(full);
+      CHECK_EQUAL(4U, capacity);
+      CHECK_EQUAL(1, red);
+      CHECK_EQUAL(3, blue);
+      CHECK_FALSE(contains_green);
+      CHECK_EQUAL(1U, count_red);
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      static constexpr bool is_valid = keywords.is_valid();
+
+      CHECK_TRUE(is_valid);
+      CHECK_TRUE(keywords.full());
+      CHECK_EQUAL(ETL_ARRAY_SIZE(keyword_text), keywords.size());
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(keyword_text); ++i)
+      {
+        etl::string_view key(keyword_text[i]);
+
+        Keywords::const_iterator itr = keywords.find(key);
+        CHECK_TRUE(itr != keywords.end());
+        CHECK_TRUE(itr->first == key);
+        CHECK_EQUAL(int(i), itr->second);
+        CHECK_EQUAL(int(i), keywords[key]);
+      }
+
+      CHECK_FALSE(keywords.contains(etl::string_view("get")));
+      CHECK_FALSE(keywords.contains(etl::string_view("Content")));
+      CHECK_FALSE(keywords.contains(etl::string_view("Content-Length ")));
+      CHECK_FALSE(keywords.contains(etl::string_view("")));
+    }
+
+    //*************************************************************************
+    TEST(test_integer_keys)
+    {
+      static constexpr bool is_valid = numbers.is_valid();
+
+      CHECK_TRUE(is_valid);
+
+      for (int i = 0; i < int(numbers.size()); ++i)
+      {
+        const int key = (i * 7919 + 13) % 100003;
+
+        CHECK_TRUE(numbers.contains(key));
+        CHECK_EQUAL(i, numbers.at(key));
+      }
+
+      size_t found = 0U;
+
+      for (int key = 0; key < 100003; ++key)
+      {
+        found += numbers.count(key);
+      }
+
+      CHECK_EQUAL(numbers.size(), found);
+    }
+
+    //*************************************************************************
+    TEST(test_iteration_is_in_supplied_order)
+    {
+      int expected = 0;
+
+      for (Keywords::const_iterator itr = keywords.begin(); itr != keywords.end(); ++itr)
+      {
+        CHECK_EQUAL(expected, itr->second);
+        CHECK_TRUE(itr->first == etl::string_view(keyword_text[expected]));
+        ++expected;
+      }
+
+      CHECK_TRUE(keywords.data() == keywords.cbegin());
+      CHECK_TRUE(keywords.end() == keywords.cend());
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      using Data  = etl::const_perfect_map<int, int, 10>;
+      using IData = etl::iconst_perfect_map<int, int, etl::const_perfect_hash<int>, etl::equal_to<int>>;
+
+      static constexpr Data data{ Data::value_type{10, 1}, Data::value_type{20, 2}, Data::value_type{30, 3} };
+
+      const IData& idata = data;
+
+      CHECK_EQUAL(3U, idata.size());
+      CHECK_EQUAL(10U, idata.max_size());
+      CHECK_EQUAL(2, idata[20]);
+      CHECK_TRUE(idata.find(40) == idata.end());
+    }
+
+    //*************************************************************************
+    TEST(test_duplicate_keys_are_invalid)
+    {
+      using Data = etl::const_perfect_map<int, int, 4>;
+
+      CHECK_THROW(Data(Data::value_type{1, 1}, Data::value_type{2, 2}, Data::value_type{1, 3}), etl::const_perfect_map_build_failed);
+    }
+
+    //*************************************************************************
+    TEST(test_custom_hash)
+    {
+      using Data = etl::const_perfect_map<int, int, 4, LowDigitHash>;
+
+      static constexpr Data data{ Data::value_type{1, 1}, Data::value_type{2, 2}, Data::value_type{13, 3} };
+
+      static constexpr bool is_valid = data.is_valid();
+
+      CHECK_TRUE(is_valid);
+      CHECK_EQUAL(3, data[13]);
+      CHECK_FALSE(data.contains(3));
+      CHECK_FALSE(data.contains(11));
+    }
+
+    //*************************************************************************
+    TEST(test_colliding_hashes_are_invalid)
+    {
+      using Data = etl::const_perfect_map<int, int, 4, ConstantHash>;
+
+      CHECK_THROW(Data(Data::value_type{1, 1}, Data::value_type{2, 2}), etl::const_perfect_map_build_failed);
+    }
+
+    //*************************************************************************
+    TEST(test_large_random_key_sets)
+    {
+      static const size_t Size = 20000U;
+
+      using Map = LargeMap<Size>;
+
+      for (uint32_t set = 0U; set < 10U; ++set)
+      {
+        std::mt19937 generator(set);
+        std::unordered_set<uint32_t> unique_keys;
+        std::vector<Map::value_type> elements;
+        elements.reserve(Size);
+
+        while (elements.size() < Size)
+        {
+          const uint32_t key = generator();
+
+          if (unique_keys.insert(key).second)
+          {
+            elements.emplace_back(key, static_cast<uint32_t>(elements.size()));
+          }
+        }
+
+        std::vector<uint16_t> slots(etl::private_const_perfect_map::table_size(Size));
+        std::vector<uint16_t> pilots(etl::private_const_perfect_map::bucket_count(Size));
+
+        Map map(elements.data(), slots.data(), pilots.data());
+
+        CHECK_TRUE(map.is_valid());
+
+        size_t found = 0U;
+
+        for (const Map::value_type& element : elements)
+        {
+          Map::const_iterator itr = map.find(element.first);
+
+          if ((itr != map.end()) && (itr->second == element.second))
+          {
+            ++found;
+          }
+        }
+
+        CHECK_EQUAL(Size, found);
+      }
+    }
+
+#if ETL_USING_CPP17
+    //*************************************************************************
+    TEST(test_cpp17_deduced_constructor)
+    {
+      static constexpr etl::const_perfect_map data{ ETL_OR_STD::pair<const int, int>{1, 10}, ETL_OR_STD::pair<const int, int>{2, 20} };
+
+      CHECK_TRUE(data.is_valid());
+      CHECK_EQUAL(2U, data.max_size());
+      CHECK_EQUAL(20, data[2]);
+    }
+#endif
+  }
+}
+
+#endif
@@ -31,6 +31,8 @@ SOFTWARE.
 #include "etl/correlation.h"
 
 #include <array>
+#include <random>
+#include <vector>
 
 namespace
 {
@@ -81,6 +83,80 @@ namespace
     0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0
   };
 
+  //*********************************
+  // Values spread evenly over [-range, range].
+  template <typename T>
+  std::vector<T> make_values(uint32_t seed, size_t size, int32_t range)
+  {
+    std::mt19937 generator(seed);
+    std::vector<T> values;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      values.push_back(T(int32_t(generator() % uint32_t((2 * range) + 1)) - range));
+    }
+
+    return values;
+  }
+
+  //*********************************
+  // Values with a mean of about 1000 and a standard deviation of about 1.
+  std::vector<float> make_large_window(uint32_t seed, size_t size)
+  {
+    std::mt19937 generator(seed);
+    std::vector<float> values;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      values.push_back(1000.0f + (float(int32_t(generator() % 2001U) - 1000) / 577.0f));
+    }
+
+    return values;
+  }
+
+  //*********************************
+  // Second values that follow the first, with some noise.
+  template <typename T>
+  std::vector<T> make_related(const std::vector<T>& values, uint32_t seed, int32_t noise)
+  {
+    std::mt19937 generator(seed);
+    std::vector<T> related;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      related.push_back(T((values[i] / 2) + T(int32_t(generator() % uint32_t((2 * noise) + 1)) - noise)));
+    }
+
+    return related;
+  }
+
+  //*********************************
+  // The co-moment of two sequences, in two passes.
+  template <typename T>
+  double reference_co_moment(const std::vector<T>& values1, const std::vector<T>& values2)
+  {
+    double mean1 = 0.0;
+    double mean2 = 0.0;
+
+    for (size_t i = 0U; i < values1.size(); ++i)
+    {
+      mean1 += double(values1[i]);
+      mean2 += double(values2[i]);
+    }
+
+    mean1 /= double(values1.size());
+    mean2 /= double(values2.size());
+
+    double co_moment = 0.0;
+
+    for (size_t i = 0U; i < values1.size(); ++i)
+    {
+      co_moment += (double(values1[i]) - mean1) * (double(values2[i]) - mean2);
+    }
+
+    return co_moment;
+  }
+
   SUITE(test_correlation)
   {
     //*************************************************************************
@@ -280,5 +356,77 @@ namespace
       covariance_result = correlation3.get_covariance();
       CHECK_CLOSE(9.17, covariance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_correlation_add_span_int32)
+    {
+      std::vector<int32_t> values1 = make_values<int32_t>(1U, 1001U, 1000000);
+      std::vector<int32_t> values2 = make_related(values1, 2U, 300000);
+
+      etl::correlation<etl::correlation_type::Sample, int32_t, int64_t> by_value(values1.begin(), values1.end(), values2.begin());
+      etl::correlation<etl::correlation_type::Sample, int32_t, int64_t> by_span;
+      by_span.add(etl::span<const int32_t>(values1.data(), values1.size()), etl::span<const int32_t>(values2.data(), values2.size()));
+
+      const double expected = reference_co_moment(values1, values2) / sqrt(reference_co_moment(values1, values1) * reference_co_moment(values2, values2));
+
+      CHECK_EQUAL(values1.size(), by_span.count());
+      CHECK_EQUAL(by_value.get_correlation(), by_span.get_correlation());
+      CHECK_CLOSE(expected, by_span.get_correlation(), 1e-9);
+
+      // Only the pairs covered by both spans are added.
+      etl::correlation<etl::correlation_type::Sample, int32_t, int64_t> shorter;
+      shorter.add(etl::span<const int32_t>(values1.data(), 5U), etl::span<const int32_t>(values2.data(), values2.size()));
+
+      CHECK_EQUAL(5U, shorter.count());
+    }
+
+    //*************************************************************************
+    TEST(test_correlation_add_span_large_window)
+    {
+      std::vector<float> values1 = make_large_window(3U, 100000U);
+      std::vector<float> values2 = make_large_window(4U, 100000U);
+
+      // Anti-correlated with the first values.
+      for (size_t i = 0U; i < values2.size(); ++i)
+      {
+        values2[i] = 3000.0f - values1[i] - ((values2[i] - 1000.0f) / 4.0f);
+      }
+
+      etl::correlation<etl::correlation_type::Sample, float> by_value(values1.begin(), values1.end(), values2.begin());
+      etl::correlation<etl::correlation_type::Sample, float> by_span;
+      by_span.add(etl::span<const float>(values1.data(), values1.size()), etl::span<const float>(values2.data(), values2.size()));
+
+      const double expected = reference_co_moment(values1, values2) / sqrt(reference_co_moment(values1, values1) * reference_co_moment(values2, values2));
+
+      CHECK_CLOSE(-0.97, expected, 0.01);
+      CHECK_EQUAL(values1.size(), by_span.count());
+      CHECK_CLOSE(expected, by_span.get_correlation(), 1e-6);
+      CHECK_CLOSE(expected, by_value.get_correlation(), 1e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_correlation_merge)
+    {
+      std::vector<int16_t> values1 = make_values<int16_t>(5U, 1000U, 32767);
+      std::vector<int16_t> values2 = make_related(values1, 6U, 10000);
+
+      etl::correlation<etl::correlation_type::Sample, int16_t, int64_t> all(values1.begin(), values1.end(), values2.begin());
+      etl::correlation<etl::correlation_type::Sample, int16_t, int64_t> merged;
+
+      const size_t bounds[] = { 0U, 1U, 1U, 130U, 1000U };
+
+      for (size_t i = 1U; i < (sizeof(bounds) / sizeof(bounds[0])); ++i)
+      {
+        const size_t length = bounds[i] - bounds[i - 1U];
+
+        etl::correlation<etl::correlation_type::Sample, int16_t, int64_t> part;
+        part.add(etl::span<const int16_t>(values1.data() + bounds[i - 1U], length), etl::span<const int16_t>(values2.data() + bounds[i - 1U], length));
+        merged.merge(part);
+      }
+
+      CHECK_EQUAL(all.count(), merged.count());
+      CHECK_EQUAL(all.get_correlation(), merged.get_correlation());
+      CHECK_EQUAL(all.get_covariance(), merged.get_covariance());
+    }
   }
 }
@@ -0,0 +1,196 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/deferred_log.h"
+#include "etl/string.h"
+
+#include <string>
+
+#if ETL_USING_CPP11 && ETL_HAS_ATOMIC
+
+namespace
+{
+  using String = etl::string<100>;
+
+  SUITE(test_deferred_log)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::deferred_log<64> log;
+      String text("unchanged");
+
+      CHECK(log.empty());
+      CHECK(!log.format_next(text));
+      CHECK_EQUAL(String("unchanged"), text);
+      CHECK_EQUAL(0U, log.dropped());
+    }
+
+    //*************************************************************************
+    TEST(test_argument_types)
+    {
+      etl::deferred_log<256> log;
+      String text;
+
+      const void* pointer = reinterpret_cast<const void*>(0x1234);
+      short s = -3;
+      unsigned long ul = 4UL;
+      unsigned char uc = 'u';
+
+      CHECK(log.log("{} {} {} {} {} {}", true, 'c', -1, 2U, -5LL, 6ULL));
+      CHECK(log.log("{} {} {}", s, ul, uc));
+      CHECK(log.log("{} {} {}", 1.5f, 0.1, 2.25L));
+      CHECK(log.log("{} {} {:p}", "abc", etl::string_view("def"), pointer));
+      CHECK(log.log("no arguments"));
+      CHECK(!log.empty());
+
+      CHECK(log.format_next(text));
+      CHECK_EQUAL(String("true c -1 2 -5 6"), text);
+      CHECK(log.format_next(text));
+      CHECK_EQUAL(String("-3 4 u"), text);
+      CHECK(log.format_next(text));
+      CHECK_EQUAL(String("1.5 0.1 2.25"), text);
+      CHECK(log.format_next(text));
+      CHECK_EQUAL(String("abc def 0x1234"), text);
+      CHECK(log.format_next(text));
+      CHECK_EQUAL(String("no arguments"), text);
+
+      CHECK(log.empty());
+      CHECK(!log.format_next(text));
+    }
+
+    //*************************************************************************
+    TEST(test_format_specifications)
+    {
+      etl::deferred_log<128> log;
+      String text;
+
+      log.log("{:>5}|{:x}|{:.2f}|{:#o}|{:<4}|", 12, 255, 3.14159, 255, "ab");
+
+      CHECK(log.format_next(text));
+      CHECK_EQUAL(String("   12|ff|3.14|0377|ab  |"), text);
+    }
+
+    //*************************************************************************
+    TEST(test_strings_are_copied)
+    {
+      etl::deferred_log<128> log;
+      String text;
+      String argument("before");
+      std::string std_argument("std");
+
+      log.log("{} {}", argument, std_argument.c_str());
+      argument = "after";
+      std_argument = "changed";
+
+      CHECK(log.format_next(text));
+      CHECK_EQUAL(String("before std"), text);
+    }
+
+    //*************************************************************************
+    TEST(test_long_strings_are_truncated)
+    {
+      etl::deferred_log<1024> log;
+      etl::string<300> text;
+      std::string argument(300U, 'x');
+
+      CHECK(log.log("{}", argument.c_str()));
+      CHECK(log.format_next(text));
+      CHECK_EQUAL(255U, text.size());
+    }
+
+    //*************************************************************************
+    TEST(test_output_iterator)
+    {
+      etl::deferred_log<64> log;
+      char buffer[16] = {};
+      char* out = buffer;
+
+      log.log("{}+{}", 1, 2);
+      log.log("={}", 3);
+
+      CHECK(log.format_next(out));
+      CHECK(log.format_next(out));
+      CHECK(!log.format_next(out));
+      CHECK_EQUAL(std::string("1+2=3"), std::string(buffer, out));
+    }
+
+    //*************************************************************************
+    TEST(test_full_ring_drops_records)
+    {
+      etl::deferred_log<64> log;
+      String text;
+
+      size_t stored = 0U;
+
+      while (log.log("{} {}", stored, 1.0))
+      {
+        ++stored;
+      }
+
+      CHECK(stored > 0U);
+      CHECK_EQUAL(1U, log.dropped());
+
+      CHECK(!log.log("{}", 1));
+      CHECK_EQUAL(2U, log.dropped());
+
+      for (size_t i = 0U; i < stored; ++i)
+      {
+        CHECK(log.format_next(text));
+        CHECK_EQUAL(std::to_string(i) + " 1", std::string(text.c_str()));
+      }
+
+      CHECK(!log.format_next(text));
+    }
+
+    //*************************************************************************
+    TEST(test_records_wrap_around)
+    {
+      etl::deferred_log<128> log;
+      String text;
+
+      // Records of varying size, consumed as they are produced, wrap around the ring many times.
+      for (int i = 0; i < 200; ++i)
+      {
+        CHECK(log.log("{} {}", i, (i % 3 == 0) ? "a" : "longer string"));
+        CHECK(log.format_next(text));
+
+        String expected(std::to_string(i).c_str());
+        expected += (i % 3 == 0) ? " a" : " longer string";
+        CHECK_EQUAL(expected, text);
+      }
+
+      CHECK(log.empty());
+      CHECK_EQUAL(0U, log.dropped());
+    }
+  }
+}
+
+#endif
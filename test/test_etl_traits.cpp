@@ -80,6 +80,7 @@ namespace
       CHECK_EQUAL((ETL_HAS_IVECTOR_REPAIR == 1),               etl::traits::has_ivector_repair);
       CHECK_EQUAL((ETL_HAS_IDEQUE_REPAIR == 1),                etl::traits::has_ideque_repair);
       CHECK_EQUAL((ETL_HAS_MUTABLE_ARRAY_VIEW == 1),           etl::traits::has_mutable_array_view);
+      CHECK_EQUAL((ETL_HAS_ALGORITHM_BLOCK_KERNELS == 1),      etl::traits::has_algorithm_block_kernels);
       CHECK_EQUAL((ETL_HAS_VIRTUAL_MESSAGES == 1),             etl::traits::has_virtual_messages);
       CHECK_EQUAL((ETL_HAS_PACKED == 1),                       etl::traits::has_packed);
 
@@ -0,0 +1,367 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/execution.h"
+#include "etl/worker_pool.h"
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <atomic>
+#include <functional>
+#include <string>
+
+namespace
+{
+  //***************************************************************************
+  /// Runs the chunks on the calling thread, last chunk first, and records
+  /// the number of chunks.
+  //***************************************************************************
+  class reverse_pool : public etl::iworker_pool
+  {
+  public:
+
+    reverse_pool(size_t concurrency_)
+      : n(concurrency_)
+      , last_count(0U)
+      , runs(0U)
+    {
+    }
+
+    size_t concurrency() const override
+    {
+      return n;
+    }
+
+    void run(etl::iparallel_task& task, size_t count) override
+    {
+      last_count = count;
+      ++runs;
+
+      for (size_t i = count; i != 0U; --i)
+      {
+        task(i - 1U);
+      }
+    }
+
+    size_t n;
+    size_t last_count;
+    size_t runs;
+  };
+
+  //***************************************************************************
+  std::vector<int> make_random(size_t n, unsigned seed)
+  {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> distribution(-100000, 100000);
+    std::vector<int> result(n);
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      result[i] = distribution(generator);
+    }
+
+    return result;
+  }
+
+#if ETL_USING_STL
+  etl::worker_pool<3> pool;
+#else
+  reverse_pool pool(4U);
+#endif
+
+  SUITE(test_execution)
+  {
+#if ETL_USING_STL
+    //*************************************************************************
+    TEST(test_worker_pool_runs_every_chunk_once)
+    {
+      struct task_t : public etl::iparallel_task
+      {
+        void operator ()(size_t index) override
+        {
+          ++calls[index];
+        }
+
+        std::atomic<int> calls[100] = {};
+      };
+
+      CHECK_EQUAL(4U, pool.concurrency());
+
+      for (int repeat = 0; repeat < 50; ++repeat)
+      {
+        task_t task;
+        pool.run(task, 100U);
+
+        for (size_t i = 0U; i < 100U; ++i)
+        {
+          CHECK_EQUAL(1, task.calls[i].load());
+        }
+      }
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_chunk_count)
+    {
+      reverse_pool rpool(8U);
+
+      CHECK_EQUAL(1U, etl::execution::par(rpool, 100U).chunk_count(0U));
+      CHECK_EQUAL(1U, etl::execution::par(rpool, 100U).chunk_count(199U));
+      CHECK_EQUAL(2U, etl::execution::par(rpool, 100U).chunk_count(200U));
+      CHECK_EQUAL(8U, etl::execution::par(rpool, 100U).chunk_count(1000000U));
+      CHECK_EQUAL(8U, etl::execution::par(rpool, 0U).chunk_count(8U));
+
+      reverse_pool wide(1000U);
+      CHECK_EQUAL(size_t(ETL_EXECUTION_MAX_CHUNKS), etl::execution::par(wide, 1U).chunk_count(1000000U));
+    }
+
+    //*************************************************************************
+    TEST(test_is_execution_policy)
+    {
+      CHECK_TRUE(etl::is_execution_policy<etl::execution::sequenced_policy>::value);
+      CHECK_TRUE(etl::is_execution_policy<etl::execution::parallel_policy>::value);
+      CHECK_FALSE(etl::is_execution_policy<int*>::value);
+    }
+
+    //*************************************************************************
+    TEST(test_small_range_runs_on_calling_thread)
+    {
+      reverse_pool rpool(4U);
+      std::vector<int> data(100U, 1);
+
+      etl::fill(etl::execution::par(rpool), data.begin(), data.end(), 2);
+
+      CHECK_EQUAL(0U, rpool.runs);
+      CHECK_TRUE(std::vector<int>(100U, 2) == data);
+    }
+
+    //*************************************************************************
+    TEST(test_for_each)
+    {
+      std::vector<int> data = make_random(100003U, 1U);
+      std::vector<int> expected = data;
+
+      for (int& i : expected) { i *= 3; }
+
+      etl::for_each(etl::execution::par(pool, 64U), data.begin(), data.end(), [](int& i) { i *= 3; });
+      CHECK_TRUE(expected == data);
+
+      etl::for_each(etl::execution::seq, data.begin(), data.end(), [](int& i) { i /= 3; });
+      etl::for_each(etl::execution::par(pool, 64U), data.begin(), data.end(), [](int& i) { i *= 3; });
+      CHECK_TRUE(expected == data);
+    }
+
+    //*************************************************************************
+    TEST(test_transform)
+    {
+      std::vector<int> data = make_random(100003U, 2U);
+      std::vector<long long> expected(data.size());
+      std::vector<long long> output(data.size());
+
+      auto square = [](int i) { return (long long)i * i; };
+
+      std::transform(data.begin(), data.end(), expected.begin(), square);
+
+      reverse_pool rpool(5U);
+      auto end = etl::transform(etl::execution::par(rpool, 64U), data.begin(), data.end(), output.begin(), square);
+
+      CHECK_EQUAL(5U, rpool.last_count);
+      CHECK_TRUE(end == output.end());
+      CHECK_TRUE(expected == output);
+
+      std::fill(output.begin(), output.end(), 0);
+      etl::transform(etl::execution::par(pool, 64U), data.begin(), data.end(), output.begin(), square);
+      CHECK_TRUE(expected == output);
+    }
+
+    //*************************************************************************
+    TEST(test_transform_binary)
+    {
+      std::vector<int> data1 = make_random(50001U, 3U);
+      std::vector<int> data2 = make_random(50001U, 4U);
+      std::vector<int> expected(data1.size());
+      std::vector<int> output(data1.size());
+
+      std::transform(data1.begin(), data1.end(), data2.begin(), expected.begin(), std::minus<int>());
+
+      int* end = etl::transform(etl::execution::par(pool, 64U), data1.data(), data1.data() + data1.size(), data2.data(), output.data(), std::minus<int>());
+
+      CHECK_TRUE(end == output.data() + output.size());
+      CHECK_TRUE(expected == output);
+    }
+
+    //*************************************************************************
+    TEST(test_reduce_and_accumulate)
+    {
+      std::vector<int> data = make_random(100003U, 5U);
+
+      const long long expected = std::accumulate(data.begin(), data.end(), 7LL);
+
+      CHECK_EQUAL(expected, etl::reduce(etl::execution::par(pool, 64U), data.begin(), data.end(), 7LL));
+      CHECK_EQUAL(expected, etl::reduce(etl::execution::seq, data.begin(), data.end(), 7LL));
+      CHECK_EQUAL(expected, etl::accumulate(etl::execution::par(pool, 64U), data.begin(), data.end(), 7LL));
+      CHECK_EQUAL(expected, etl::accumulate(etl::execution::seq, data.begin(), data.end(), 7LL));
+      CHECK_EQUAL(int(expected - 7), etl::reduce(etl::execution::par(pool, 64U), data.begin(), data.end()));
+
+      const int max = *std::max_element(data.begin(), data.end());
+      auto op = [](int a, int b) { return std::max(a, b); };
+
+      CHECK_EQUAL(max, etl::reduce(etl::execution::par(pool, 64U), data.begin(), data.end(), -1000000, op));
+      CHECK_EQUAL(max, etl::accumulate(etl::execution::par(pool, 64U), data.begin(), data.end(), -1000000, op));
+
+      // Empty range.
+      CHECK_EQUAL(7LL, etl::reduce(etl::execution::par(pool, 64U), data.begin(), data.begin(), 7LL));
+    }
+
+    //*************************************************************************
+    TEST(test_reduce_non_trivial_type)
+    {
+      std::vector<std::string> data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.push_back(std::string(1, char('a' + (i % 26))));
+      }
+
+      std::string expected = std::accumulate(data.begin(), data.end(), std::string(">"));
+
+      // Concatenation is associative, and the chunks are combined in order.
+      CHECK_TRUE(expected == etl::reduce(etl::execution::par(pool, 10U), data.begin(), data.end(), std::string(">")));
+    }
+
+    //*************************************************************************
+    TEST(test_fill_and_copy)
+    {
+      std::vector<int> data(100003U);
+      std::vector<int> output(data.size());
+
+      etl::fill(etl::execution::par(pool, 64U), data.begin(), data.end(), 42);
+      CHECK_TRUE(std::vector<int>(data.size(), 42) == data);
+
+      data = make_random(data.size(), 6U);
+
+      auto end = etl::copy(etl::execution::par(pool, 64U), data.begin(), data.end(), output.begin());
+      CHECK_TRUE(end == output.end());
+      CHECK_TRUE(data == output);
+
+      std::fill(output.begin(), output.end(), 0);
+      etl::copy(etl::execution::seq, data.begin(), data.end(), output.begin());
+      CHECK_TRUE(data == output);
+    }
+
+    //*************************************************************************
+    TEST(test_count_if)
+    {
+      std::vector<int> data = make_random(100003U, 7U);
+      auto is_even = [](int i) { return (i % 2) == 0; };
+
+      const auto expected = std::count_if(data.begin(), data.end(), is_even);
+
+      CHECK_EQUAL(expected, etl::count_if(etl::execution::par(pool, 64U), data.begin(), data.end(), is_even));
+      CHECK_EQUAL(expected, etl::count_if(etl::execution::seq, data.begin(), data.end(), is_even));
+    }
+
+    //*************************************************************************
+    TEST(test_sort_in_place)
+    {
+      for (size_t concurrency = 1U; concurrency <= 9U; ++concurrency)
+      {
+        reverse_pool rpool(concurrency);
+        std::vector<int> data = make_random(2011U, unsigned(concurrency));
+        std::vector<int> expected = data;
+
+        std::sort(expected.begin(), expected.end());
+        etl::sort(etl::execution::par(rpool, 16U), data.begin(), data.end());
+
+        CHECK_TRUE(expected == data);
+      }
+
+      std::vector<int> data = make_random(20003U, 8U);
+      std::vector<int> expected = data;
+
+      std::sort(expected.begin(), expected.end(), std::greater<int>());
+      etl::sort(etl::execution::par(pool, 64U), data.begin(), data.end(), std::greater<int>());
+
+      CHECK_TRUE(expected == data);
+    }
+
+    //*************************************************************************
+    TEST(test_sort_with_buffer)
+    {
+      for (size_t concurrency = 1U; concurrency <= 9U; ++concurrency)
+      {
+        reverse_pool rpool(concurrency);
+        std::vector<int> data = make_random(2011U, unsigned(concurrency + 10U));
+        std::vector<int> expected = data;
+        std::vector<int> buffer(data.size());
+
+        std::sort(expected.begin(), expected.end());
+        etl::sort(etl::execution::par(rpool, 16U), data.begin(), data.end(), etl::span<int>(buffer.data(), buffer.size()));
+
+        CHECK_TRUE(expected == data);
+      }
+
+      std::vector<int> data = make_random(20003U, 9U);
+      std::vector<int> expected = data;
+      std::vector<int> buffer(data.size());
+
+      std::sort(expected.begin(), expected.end(), std::greater<int>());
+      etl::sort(etl::execution::par(pool, 64U), data.begin(), data.end(), etl::span<int>(buffer.data(), buffer.size()), std::greater<int>());
+
+      CHECK_TRUE(expected == data);
+    }
+
+    //*************************************************************************
+    TEST(test_sort_buffer_too_small)
+    {
+      std::vector<int> data = make_random(1000U, 10U);
+      std::vector<int> buffer(data.size() - 1U);
+
+      CHECK_THROW(etl::sort(etl::execution::par(pool, 16U), data.begin(), data.end(), etl::span<int>(buffer.data(), buffer.size())), etl::execution_buffer_too_small);
+    }
+
+    //*************************************************************************
+    TEST(test_sort_sequenced)
+    {
+      std::vector<int> data = make_random(1000U, 11U);
+      std::vector<int> expected = data;
+
+      std::sort(expected.begin(), expected.end());
+      etl::sort(etl::execution::seq, data.begin(), data.end());
+      CHECK_TRUE(expected == data);
+
+      std::sort(expected.begin(), expected.end(), std::greater<int>());
+      etl::sort(etl::execution::seq, data.begin(), data.end(), std::greater<int>());
+      CHECK_TRUE(expected == data);
+    }
+  }
+}
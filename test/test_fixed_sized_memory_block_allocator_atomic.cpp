@@ -0,0 +1,232 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/fixed_sized_memory_block_allocator_atomic.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/shared_message.h"
+#include "etl/message.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  using Allocator16 = etl::fixed_sized_memory_block_allocator_atomic<sizeof(int16_t), alignof(int16_t), 4>;
+  using Allocator32 = etl::fixed_sized_memory_block_allocator_atomic<sizeof(int32_t), alignof(int32_t), 4>;
+
+  //*************************************************************************
+  struct Message1 : public etl::message<1>
+  {
+    Message1(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  using pool_message_parameters = etl::atomic_counted_message_pool::pool_message_parameters<Message1>;
+
+  SUITE(test_fixed_sized_memory_block_allocator_atomic)
+  {
+    //*************************************************************************
+    TEST(test_allocator_no_successor_use_all_allocation)
+    {
+      Allocator16 allocator16;
+
+      int16_t* p1 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p2 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p3 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p4 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p5 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p3 != nullptr);
+      CHECK(p4 != nullptr);
+      CHECK(p5 == nullptr);
+
+      CHECK(p1 != p2);
+      CHECK(p1 != p3);
+      CHECK(p1 != p4);
+      CHECK(p2 != p3);
+      CHECK(p2 != p4);
+      CHECK(p3 != p4);
+
+      CHECK(allocator16.is_owner_of(p1));
+      CHECK(allocator16.is_owner_of(p4));
+
+      CHECK(allocator16.release(p1));
+      CHECK(allocator16.release(p2));
+      CHECK(allocator16.release(p3));
+      CHECK(allocator16.release(p4));
+      CHECK(!allocator16.release(p5));
+
+      // All of the blocks are available again.
+      CHECK(allocator16.allocate(sizeof(int16_t), alignof(int16_t)) != nullptr);
+      CHECK(allocator16.allocate(sizeof(int16_t), alignof(int16_t)) != nullptr);
+      CHECK(allocator16.allocate(sizeof(int16_t), alignof(int16_t)) != nullptr);
+      CHECK(allocator16.allocate(sizeof(int16_t), alignof(int16_t)) != nullptr);
+      CHECK(allocator16.allocate(sizeof(int16_t), alignof(int16_t)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_wrong_size_or_alignment)
+    {
+      Allocator16 allocator16;
+
+      CHECK(allocator16.allocate(sizeof(int32_t), alignof(int16_t)) == nullptr);
+      CHECK(allocator16.allocate(sizeof(int16_t), alignof(int32_t)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_with_successor)
+    {
+      Allocator16 allocator16;
+      Allocator32 allocator32;
+
+      allocator16.set_successor(allocator32);
+
+      int32_t* p1 = static_cast<int32_t*>(allocator16.allocate(sizeof(int32_t), alignof(int32_t)));
+
+      CHECK(p1 != nullptr);
+      CHECK(allocator16.is_owner_of(p1)); // Via the successor.
+      CHECK(allocator32.is_owner_of(p1));
+      CHECK(allocator16.release(p1));
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_threads)
+    {
+      static const size_t Blocks    = 16U;
+      static const int    Threads   = 4;
+      static const int    Loops     = 10000;
+
+      etl::fixed_sized_memory_block_allocator_atomic<sizeof(int), alignof(int), Blocks> allocator;
+
+      std::atomic<bool> corrupted(false);
+
+      auto worker = [&](int id)
+      {
+        for (int i = 0; i < Loops; ++i)
+        {
+          int* p = static_cast<int*>(allocator.allocate(sizeof(int), alignof(int)));
+
+          if (p != nullptr)
+          {
+            *p = id;
+
+            std::this_thread::yield();
+
+            // No other thread should have been given the same block.
+            if (*p != id)
+            {
+              corrupted = true;
+            }
+
+            allocator.release(p);
+          }
+        }
+      };
+
+      std::vector<std::thread> threads;
+
+      for (int i = 0; i < Threads; ++i)
+      {
+        threads.emplace_back(worker, i);
+      }
+
+      for (auto& t : threads)
+      {
+        t.join();
+      }
+
+      CHECK(!corrupted.load());
+
+      // All of the blocks have been returned.
+      std::vector<void*> blocks;
+
+      for (size_t i = 0U; i < Blocks; ++i)
+      {
+        blocks.push_back(allocator.allocate(sizeof(int), alignof(int)));
+        CHECK(blocks.back() != nullptr);
+      }
+
+      CHECK(allocator.allocate(sizeof(int), alignof(int)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_shared_message_fan_out_without_lock)
+    {
+      static const int Consumers = 4;
+      static const int Messages  = 1000;
+
+      etl::fixed_sized_memory_block_allocator_atomic<pool_message_parameters::max_size,
+                                                     pool_message_parameters::max_alignment,
+                                                     4U> memory_allocator;
+
+      // No lock is needed, as the counters and the free list are both atomic.
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      std::atomic<int> sum(0);
+
+      for (int m = 0; m < Messages; ++m)
+      {
+        etl::shared_message sm(message_pool, Message1(m));
+
+        std::vector<std::thread> consumers;
+
+        for (int c = 0; c < Consumers; ++c)
+        {
+          // Each consumer has its own copy of the shared message.
+          consumers.emplace_back([&sum](etl::shared_message msg)
+          {
+            sum += static_cast<const Message1&>(msg.get_message()).i;
+          }, sm);
+        }
+
+        for (auto& t : consumers)
+        {
+          t.join();
+        }
+
+        CHECK_EQUAL(1U, sm.get_reference_count());
+      }
+
+      CHECK_EQUAL(Consumers * ((Messages * (Messages - 1)) / 2), sum.load());
+    }
+  }
+}
+
+#endif
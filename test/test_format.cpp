@@ -32,6 +32,9 @@ SOFTWARE.
 
 #include "etl/iterator.h"
 
+#include <cmath>
+#include <cstdlib>
+
 #if ETL_USING_CPP11
 
 namespace
@@ -202,9 +205,9 @@ namespace
     {
       etl::string<100> s;
 
-      CHECK_EQUAL("1.0", test_format(s, "{}", 1.0f));
+      CHECK_EQUAL("1", test_format(s, "{}", 1.0f));
       CHECK_EQUAL("1.234567", test_format(s, "{}", 1.234567f));
-      CHECK_EQUAL("1.234567", test_format(s, "{}", 1.2345678f));
+      CHECK_EQUAL("1.2345678", test_format(s, "{}", 1.2345678f));
       CHECK_EQUAL("1.125", test_format(s, "{}", 1.125f));
     }
 
@@ -213,9 +216,9 @@ namespace
     {
       etl::string<100> s;
 
-      CHECK_EQUAL("1.0", test_format(s, "{}", 1.0));
+      CHECK_EQUAL("1", test_format(s, "{}", 1.0));
       CHECK_EQUAL("1.234564", test_format(s, "{}", 1.234564));
-      CHECK_EQUAL("1.234567", test_format(s, "{}", 1.2345678));
+      CHECK_EQUAL("1.2345678", test_format(s, "{}", 1.2345678));
       CHECK_EQUAL("1.5", test_format(s, "{}", 1.5));
     }
 
@@ -224,10 +227,10 @@ namespace
     {
       etl::string<100> s;
 
-      CHECK_EQUAL("1.0", test_format(s, "{}", 1.0l));
+      CHECK_EQUAL("1", test_format(s, "{}", 1.0l));
       auto& result = test_format(s, "{}", 1.234567l);
       CHECK("1.234567" == result || "1.234566" == result);
-      CHECK_EQUAL("1.234567", test_format(s, "{}", 1.2345678l));
+      CHECK_EQUAL("1.2345678", test_format(s, "{}", 1.2345678l));
       CHECK_EQUAL("1.25", test_format(s, "{}", 1.25l));
     }
 
@@ -242,10 +245,10 @@ namespace
       CHECK_EQUAL("-2.500000e+11", test_format(s, "{:e}", -250000000000.0f));
       CHECK_EQUAL("1.000000", test_format(s, "{:f}", 1.0f));
       CHECK_EQUAL("1.125000", test_format(s, "{:F}", 1.125f));
-      CHECK_EQUAL("1.000000", test_format(s, "{:g}", 1.0f));
-      CHECK_EQUAL("1.125000", test_format(s, "{:G}", 1.125f));
-      CHECK_EQUAL("1.000000e+10", test_format(s, "{:g}", 10000000000.0f));
-      CHECK_EQUAL("1.000000E+10", test_format(s, "{:G}", 10000000000.0f));
+      CHECK_EQUAL("1", test_format(s, "{:g}", 1.0f));
+      CHECK_EQUAL("1.125", test_format(s, "{:G}", 1.125f));
+      CHECK_EQUAL("1e+10", test_format(s, "{:g}", 10000000000.0f));
+      CHECK_EQUAL("1E+10", test_format(s, "{:G}", 10000000000.0f));
       CHECK_EQUAL("nan", test_format(s, "{}", NAN));
       CHECK_EQUAL("nan", test_format(s, "{:e}", NAN));
       CHECK_EQUAL("NAN", test_format(s, "{:E}", NAN));
@@ -267,6 +270,81 @@ namespace
       CHECK_EQUAL("0x1.6345785d8ap+e", test_format(s, "{:a}", 100000000000000000.l));
     }
 
+    //*************************************************************************
+    TEST(test_format_float_shortest_round_trip)
+    {
+      etl::string<100> s;
+
+      CHECK_EQUAL("0.1", test_format(s, "{}", 0.1));
+      CHECK_EQUAL("0.3", test_format(s, "{}", 0.3f));
+      CHECK_EQUAL("0.30000000000000004", test_format(s, "{}", 0.1 + 0.2));
+      CHECK_EQUAL("100", test_format(s, "{}", 100.0));
+      CHECK_EQUAL("123456789", test_format(s, "{}", 123456789.0));
+      CHECK_EQUAL("16777216", test_format(s, "{}", 16777216.0f));
+      CHECK_EQUAL("1e+16", test_format(s, "{}", 1e16));
+      CHECK_EQUAL("1e+22", test_format(s, "{}", 1e22));
+      CHECK_EQUAL("1e-05", test_format(s, "{}", 1e-5));
+      CHECK_EQUAL("0.001", test_format(s, "{}", 1e-3));
+      CHECK_EQUAL("-0", test_format(s, "{}", -0.0));
+      CHECK_EQUAL("-1.5", test_format(s, "{}", -1.5f));
+      CHECK_EQUAL("5e-324", test_format(s, "{}", 4.9406564584124654e-324));
+      CHECK_EQUAL("1.7976931348623157e+308", test_format(s, "{}", 1.7976931348623157e308));
+      CHECK_EQUAL("3.4028235e+38", test_format(s, "{}", 3.4028235e38f));
+      CHECK_EQUAL("1e-45", test_format(s, "{}", 1.4e-45f));
+
+      // Every value parses back to the same bits.
+      const double values[] = { 0.1, 2.0 / 3.0, 1e-300, 6.02214076e23, 2.2250738585072014e-308, 9007199254740993.0, 299792458.0, 1.0 / 7.0 };
+
+      for (double value : values)
+      {
+        test_format(s, "{}", value);
+        CHECK_EQUAL(value, strtod(s.c_str(), nullptr));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_format_float_precision)
+    {
+      etl::string<100> s;
+
+      CHECK_EQUAL("3.14", test_format(s, "{:.2f}", 3.14159));
+      CHECK_EQUAL("3", test_format(s, "{:.0f}", 3.14159));
+      CHECK_EQUAL("3.", test_format(s, "{:#.0f}", 3.14159));
+      CHECK_EQUAL("0.10000000000000000555", test_format(s, "{:.20f}", 0.1));
+      CHECK_EQUAL("100000000000000000000.000000", test_format(s, "{:f}", 1e20));
+      CHECK_EQUAL("0.000000", test_format(s, "{:f}", 1e-20));
+      CHECK_EQUAL("0.000001", test_format(s, "{:f}", 9e-7));
+      CHECK_EQUAL("-0.00", test_format(s, "{:.2f}", -0.001));
+
+      // Rounding is exact, and half to even.
+      CHECK_EQUAL("2", test_format(s, "{:.0f}", 2.5));
+      CHECK_EQUAL("4", test_format(s, "{:.0f}", 3.5));
+      CHECK_EQUAL("0.12", test_format(s, "{:.2f}", 0.125));
+      CHECK_EQUAL("1.00", test_format(s, "{:.2f}", 1.005)); // 1.00499999999999989...
+      CHECK_EQUAL("100.0", test_format(s, "{:.1f}", 99.96));
+
+      CHECK_EQUAL("1.23e+02", test_format(s, "{:.2e}", 123.456));
+      CHECK_EQUAL("1.00e+01", test_format(s, "{:.2e}", 9.999));
+      CHECK_EQUAL("1e+01", test_format(s, "{:.0e}", 9.999));
+      CHECK_EQUAL("0.000e+00", test_format(s, "{:.3e}", 0.0));
+      CHECK_EQUAL("1.797693E+308", test_format(s, "{:E}", 1.7976931348623157e308));
+      CHECK_EQUAL("4.940656e-324", test_format(s, "{:e}", 4.9406564584124654e-324));
+
+      CHECK_EQUAL("0.000123", test_format(s, "{:.3g}", 0.0001234));
+      CHECK_EQUAL("1.23e-05", test_format(s, "{:.3g}", 0.00001234));
+      CHECK_EQUAL("1.23457e+08", test_format(s, "{:g}", 123456789.0));
+      CHECK_EQUAL("1e+02", test_format(s, "{:.2g}", 99.7));
+      CHECK_EQUAL("1.00", test_format(s, "{:#.3g}", 1.0));
+      CHECK_EQUAL("0", test_format(s, "{:g}", 0.0));
+      CHECK_EQUAL("3.14", test_format(s, "{:.3}", 3.14159));
+      CHECK_EQUAL("1e+02", test_format(s, "{:.1}", 99.7));
+
+      CHECK_EQUAL("+1.50", test_format(s, "{:+.2f}", 1.5f));
+      CHECK_EQUAL("      3.14", test_format(s, "{:>10.2f}", 3.14159));
+      CHECK_EQUAL("3.14**", test_format(s, "{:*<6.2f}", 3.14159));
+      CHECK_EQUAL("-inf", test_format(s, "{}", -INFINITY));
+    }
+
     //*************************************************************************
     TEST(test_format_char_array)
     {
@@ -682,6 +760,101 @@ namespace
       CHECK_EQUAL("+0X00EF1", test_format(s, "{:+#05X}", 0xEF1));
       CHECK_THROW(test_format(s, "{:+#05.5X}", 0xEF1), etl::bad_format_string_exception);
     }
+
+    //*************************************************************************
+    TEST(test_compiled_format)
+    {
+      etl::string<100> s;
+
+      const etl::compiled_format<10, int, const char*, const char*> fmt("a{} {{b}} {:>6}|{:.2}");
+
+      CHECK_EQUAL(5U, fmt.size());
+
+      etl::format_to(s, fmt, 34, "xyz", "hello");
+      CHECK_EQUAL("a34 {b}    xyz|he", s);
+
+      // The same result as the runtime parsed format.
+      etl::string<100> expected;
+      etl::format_to(expected, "a{} {{b}} {:>6}|{:.2}", 34, "xyz", "hello");
+      CHECK_EQUAL(expected, s);
+
+      etl::format_to(s, fmt, -1, "", "");
+      CHECK_EQUAL("a-1 {b}       |", s);
+
+      CHECK_EQUAL(17U, etl::formatted_size(fmt, 34, "xyz", "hello"));
+    }
+
+    //*************************************************************************
+    TEST(test_compiled_format_iterators)
+    {
+      etl::string<100> s;
+
+      const auto fmt = etl::compile_format<int, int>("{1} {0}");
+
+      etl::format_to(iterator(s), fmt, 65, 34);
+      CHECK_EQUAL("34 65", s);
+
+      s = "abcdefghij";
+      etl::format_to_n(s.begin(), 3, etl::compile_format<int>("xy{}"), 123);
+      CHECK_EQUAL("xy1defghij", s);
+    }
+
+    //*************************************************************************
+    TEST(test_compiled_format_specs)
+    {
+      etl::string<100> s;
+
+      etl::format_to(s, etl::compile_format<int>("a{:*^5}"), 34);
+      CHECK_EQUAL("a*34**", s);
+
+      etl::format_to(s, etl::compile_format<unsigned int>("{:+#05X}"), 0xEF1U);
+      CHECK_EQUAL("+0X00EF1", s);
+
+      etl::format_to(s, etl::compile_format<int, int>("{:>{}}"), 34, 5);
+      CHECK_EQUAL("   34", s);
+
+      etl::format_to(s, etl::compile_format<const char*, int, int>("{0:{1}.{2}}|"), "abcdef", 5, 3);
+      CHECK_EQUAL("abc  |", s);
+
+      etl::format_to(s, etl::compile_format<char, bool>("{:c}{:d}"), 'x', true);
+      CHECK_EQUAL("x1", s);
+
+      etl::format_to(s, etl::compile_format<>("}}{{"));
+      CHECK_EQUAL("}{", s);
+    }
+
+    //*************************************************************************
+    TEST(test_compiled_format_bad_format_string)
+    {
+      using Fmt = etl::compiled_format<10, int, const char*>;
+
+      CHECK_THROW(Fmt("{"), etl::bad_format_string_exception);
+      CHECK_THROW(Fmt("}"), etl::bad_format_string_exception);
+      CHECK_THROW(Fmt("{} {} {}"), etl::bad_format_string_exception);
+      CHECK_THROW(Fmt("{2}"), etl::bad_format_string_exception);
+      CHECK_THROW(Fmt("{0} {}"), etl::bad_format_string_exception);
+      CHECK_THROW(Fmt("{:s}"), etl::bad_format_string_exception);
+      CHECK_THROW(Fmt("{:.2}"), etl::bad_format_string_exception);
+      CHECK_THROW(Fmt("{:*5}"), etl::bad_format_string_exception);
+      CHECK_THROW(Fmt("{1:{}}"), etl::bad_format_string_exception);
+      CHECK_THROW(Fmt("{:{}}"), etl::bad_format_string_exception);
+      CHECK_THROW(Fmt("{} {:x}"), etl::bad_format_string_exception);
+      CHECK_THROW((etl::compiled_format<2, int>("a{}b{{c")), etl::bad_format_string_exception);
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_compiled_format_constexpr)
+    {
+      static constexpr auto fmt = etl::compile_format<int, const char*>("id={:04} name={}");
+
+      static_assert(fmt.size() == 2U, "Unexpected number of segments");
+
+      etl::string<100> s;
+      etl::format_to(s, fmt, 7, "abc");
+      CHECK_EQUAL("id=0007 name=abc", s);
+    }
+#endif
   }
 }
 
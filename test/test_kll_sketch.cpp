@@ -0,0 +1,243 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/kll_sketch.h"
+
+#include <stdint.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+  using Sketch = etl::kll_sketch<int, 200>;
+
+  //***********************************
+  std::vector<int> make_shuffled(int n, unsigned seed)
+  {
+    std::vector<int> values(static_cast<size_t>(n));
+    std::iota(values.begin(), values.end(), 1);
+    std::shuffle(values.begin(), values.end(), std::mt19937(seed));
+
+    return values;
+  }
+
+  SUITE(test_kll_sketch)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      Sketch sketch;
+
+      CHECK(sketch.empty());
+      CHECK_EQUAL(0U, sketch.count());
+      CHECK_EQUAL(0U, sketch.size());
+      CHECK_EQUAL(1U, sketch.height());
+      CHECK_CLOSE(0.0, sketch.rank(10), 0.0);
+      CHECK_THROW(sketch.quantile(0.5), etl::kll_sketch_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_exact_while_below_capacity)
+    {
+      Sketch sketch;
+
+      std::vector<int> values = make_shuffled(100, 1U);
+      sketch.add(values.begin(), values.end());
+
+      CHECK_EQUAL(100U, sketch.count());
+      CHECK_EQUAL(100U, sketch.size());
+      CHECK_EQUAL(1,   sketch.min_value());
+      CHECK_EQUAL(100, sketch.max_value());
+      CHECK_EQUAL(1,   sketch.quantile(0.0));
+      CHECK_EQUAL(50,  sketch.quantile(0.5));
+      CHECK_EQUAL(99,  sketch.quantile(0.99));
+      CHECK_EQUAL(100, sketch.quantile(1.0));
+      CHECK_CLOSE(0.5,  sketch.rank(50), 1e-9);
+      CHECK_CLOSE(0.0,  sketch.rank(0),  1e-9);
+      CHECK_CLOSE(1.0,  sketch.rank(100), 1e-9);
+    }
+
+    //*************************************************************************
+    TEST(test_large_stream_is_bounded_and_accurate)
+    {
+      const int N = 1000000;
+
+      Sketch sketch;
+
+      std::vector<int> values = make_shuffled(N, 2U);
+
+      for (int value : values)
+      {
+        sketch(value);
+      }
+
+      CHECK_EQUAL(uint64_t(N), sketch.count());
+      CHECK(sketch.size() <= Sketch::max_size());
+      CHECK(sketch.height() > 1U);
+      CHECK_EQUAL(1, sketch.min_value());
+      CHECK_EQUAL(N, sketch.max_value());
+
+      const double qs[] = { 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99 };
+
+      for (double q : qs)
+      {
+        const double estimate = double(sketch.quantile(q)) / N;
+
+        CHECK_CLOSE(q, estimate, 0.02);
+        CHECK_CLOSE(q, sketch.rank(int(q * N)), 0.02);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_add_span_matches_add)
+    {
+      Sketch one_by_one(7U);
+      Sketch bulk(7U);
+
+      std::vector<int> values = make_shuffled(50000, 3U);
+
+      for (int value : values)
+      {
+        one_by_one.add(value);
+      }
+
+      // Add in uneven chunks.
+      size_t i = 0U;
+
+      while (i < values.size())
+      {
+        const size_t n = std::min(values.size() - i, size_t(777U));
+        bulk.add(etl::span<const int>(values.data() + i, n));
+        i += n;
+      }
+
+      CHECK_EQUAL(one_by_one.count(), bulk.count());
+      CHECK_EQUAL(one_by_one.size(),  bulk.size());
+
+      for (double q = 0.05; q < 1.0; q += 0.05)
+      {
+        CHECK_EQUAL(one_by_one.quantile(q), bulk.quantile(q));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      const int N = 200000;
+
+      std::vector<int> values = make_shuffled(N, 4U);
+
+      Sketch sketches[4];
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        sketches[i % 4U].add(values[i]);
+      }
+
+      Sketch merged;
+
+      for (Sketch& sketch : sketches)
+      {
+        merged.merge(sketch);
+      }
+
+      merged.merge(merged);
+
+      CHECK_EQUAL(uint64_t(N), merged.count());
+      CHECK(merged.size() <= Sketch::max_size());
+      CHECK_EQUAL(1, merged.min_value());
+      CHECK_EQUAL(N, merged.max_value());
+
+      const double qs[] = { 0.01, 0.5, 0.99 };
+
+      for (double q : qs)
+      {
+        CHECK_CLOSE(q, double(merged.quantile(q)) / N, 0.02);
+      }
+
+      // Merging small sketches stays exact.
+      Sketch a;
+      Sketch b;
+      a.add(1);
+      a.add(3);
+      b.add(2);
+      b.add(4);
+      a.merge(b);
+
+      CHECK_EQUAL(4U, a.count());
+      CHECK_EQUAL(2, a.quantile(0.5));
+      CHECK_EQUAL(4, a.max_value());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_and_compare)
+    {
+      etl::kll_sketch<double, 64, 32, etl::greater<double> > sketch;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        sketch.add(double(i) / 100.0);
+      }
+
+      // Ordered largest first.
+      CHECK_CLOSE(99.99, sketch.min_value(), 1e-9);
+      CHECK_CLOSE(0.0,   sketch.max_value(), 1e-9);
+      CHECK_CLOSE(90.0,  sketch.quantile(0.1), 3.0);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Sketch sketch;
+
+      std::vector<int> values = make_shuffled(10000, 5U);
+      sketch.add(etl::span<const int>(values.data(), values.size()));
+
+      sketch.clear();
+
+      CHECK(sketch.empty());
+      CHECK_EQUAL(0U, sketch.size());
+      CHECK_EQUAL(1U, sketch.height());
+
+      sketch.add(5);
+      CHECK_EQUAL(5, sketch.quantile(0.5));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::kll_sketch<int, 8, 3> sketch;
+
+      CHECK_THROW(for (int i = 0; i < 10000; ++i) { sketch.add(i); }, etl::kll_sketch_full);
+    }
+  }
+}
@@ -0,0 +1,273 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/log_linear_histogram.h"
+
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+#include <thread>
+
+namespace
+{
+  // 3 significant bits, values up to 2^16 - 1.
+  using Small = etl::log_linear_histogram<3, 16>;
+
+  // 7 significant bits (< 1% error), nanoseconds up to about 18 minutes.
+  using Latency = etl::log_linear_histogram<7, 40>;
+
+  SUITE(test_log_linear_histogram)
+  {
+    //*************************************************************************
+    TEST(test_layout)
+    {
+      CHECK_EQUAL(((16U - 3U) + 2U) * 4U, Small::size());
+      CHECK_EQUAL(65535U, Small::max_value());
+      CHECK((std::is_same<Small::value_type, uint16_t>::value));
+      CHECK((std::is_same<Latency::value_type, uint64_t>::value));
+
+      // Exact below 2^Sub_Bucket_Bits.
+      for (uint16_t i = 0U; i < 8U; ++i)
+      {
+        CHECK_EQUAL(size_t(i), Small::index_of(i));
+        CHECK_EQUAL(i, Small::lowest_value_at_index(i));
+        CHECK_EQUAL(i, Small::highest_value_at_index(i));
+      }
+
+      // 8 to 15 are in buckets of width 2.
+      CHECK_EQUAL(8U,  Small::index_of(8));
+      CHECK_EQUAL(8U,  Small::index_of(9));
+      CHECK_EQUAL(11U, Small::index_of(15));
+      CHECK_EQUAL(14U, Small::lowest_equivalent_value(15));
+      CHECK_EQUAL(15U, Small::highest_equivalent_value(14));
+
+      // 16 to 31 are in buckets of width 4.
+      CHECK_EQUAL(12U, Small::index_of(16));
+      CHECK_EQUAL(16U, Small::lowest_value_at_index(12));
+      CHECK_EQUAL(19U, Small::highest_value_at_index(12));
+
+      CHECK_EQUAL(Small::size() - 1U, Small::index_of(65535U));
+      CHECK_EQUAL(65535U, Small::highest_value_at_index(Small::size() - 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_buckets_are_contiguous)
+    {
+      for (size_t i = 1U; i < Small::size(); ++i)
+      {
+        CHECK_EQUAL(Small::highest_value_at_index(i - 1U) + 1U, Small::lowest_value_at_index(i));
+      }
+
+      for (size_t i = 1U; i < Latency::size(); ++i)
+      {
+        CHECK_EQUAL(Latency::highest_value_at_index(i - 1U) + 1U, Latency::lowest_value_at_index(i));
+      }
+
+      CHECK_EQUAL(Latency::max_value(), Latency::highest_value_at_index(Latency::size() - 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_relative_error)
+    {
+      for (uint64_t value = 1U; value < Latency::max_value(); value = (value * 3U) + 1U)
+      {
+        const uint64_t lowest  = Latency::lowest_equivalent_value(value);
+        const uint64_t highest = Latency::highest_equivalent_value(value);
+
+        CHECK(lowest <= value);
+        CHECK(value <= highest);
+        CHECK(double(highest - lowest) <= double(value) / 64.0);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_add_and_count)
+    {
+      Small histogram;
+
+      CHECK(histogram.empty());
+
+      histogram.add(5);
+      histogram.add(9);
+      histogram.add(8);
+      histogram(100);
+      histogram.add(1000, 3);
+
+      std::vector<uint16_t> values = { 5, 5 };
+      histogram.add(values.begin(), values.end());
+
+      CHECK(!histogram.empty());
+      CHECK_EQUAL(9U, histogram.total_count());
+      CHECK_EQUAL(3U, histogram.count(5));
+      CHECK_EQUAL(2U, histogram.count(8));
+      CHECK_EQUAL(2U, histogram.count_at_index(Small::index_of(9)));
+      CHECK_EQUAL(3U, histogram.count(1000));
+      CHECK_EQUAL(0U, histogram.count(7));
+
+      histogram.clear();
+      CHECK(histogram.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_values_above_range_go_to_last_bucket)
+    {
+      etl::log_linear_histogram<3, 10> histogram;
+
+      histogram.add(2000U);
+      histogram.add(1023U);
+
+      CHECK_EQUAL(2U, histogram.count_at_index(histogram.size() - 1U));
+      CHECK_EQUAL(1023U, histogram.percentile(100.0));
+    }
+
+    //*************************************************************************
+    TEST(test_percentile)
+    {
+      Latency histogram;
+
+      CHECK_EQUAL(0U, histogram.percentile(50.0));
+
+      for (uint64_t i = 1U; i <= 10000U; ++i)
+      {
+        histogram.add(i * 1000U);
+      }
+
+      const uint64_t p50  = histogram.percentile(50.0);
+      const uint64_t p99  = histogram.percentile(99.0);
+      const uint64_t p100 = histogram.percentile(100.0);
+
+      CHECK(p50 >= 5000000U);
+      CHECK(double(p50)  <= 5000000.0 * (1.0 + (1.0 / 64.0)));
+      CHECK(p99 >= 9900000U);
+      CHECK(double(p99)  <= 9900000.0 * (1.0 + (1.0 / 64.0)));
+      CHECK(p100 >= 10000000U);
+      CHECK(double(p100) <= 10000000.0 * (1.0 + (1.0 / 64.0)));
+
+      CHECK_EQUAL(Latency::highest_equivalent_value(1000U), histogram.percentile(0.0));
+      CHECK_EQUAL(histogram.percentile(0.0),   histogram.percentile(-5.0));
+      CHECK_EQUAL(histogram.percentile(100.0), histogram.percentile(150.0));
+    }
+
+    //*************************************************************************
+    TEST(test_mean)
+    {
+      Small histogram;
+
+      CHECK_CLOSE(0.0, histogram.mean(), 0.0);
+
+      // Exact buckets.
+      histogram.add(2);
+      histogram.add(4);
+      histogram.add(6);
+      CHECK_CLOSE(4.0, histogram.mean(), 0.0);
+
+      // Bucket 16 to 19 has a mid point of 17.5.
+      histogram.clear();
+      histogram.add(16);
+      histogram.add(19);
+      CHECK_CLOSE(17.5, histogram.mean(), 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      Small a;
+      Small b;
+
+      a.add(1);
+      a.add(100);
+      b.add(100);
+      b.add(200, 2);
+
+      a.merge(b);
+
+      CHECK_EQUAL(5U, a.total_count());
+      CHECK_EQUAL(1U, a.count(1));
+      CHECK_EQUAL(2U, a.count(100));
+      CHECK_EQUAL(2U, a.count(200));
+      CHECK_EQUAL(3U, b.total_count());
+    }
+
+    //*************************************************************************
+    TEST(test_reset_and_swap)
+    {
+      Small active;
+      Small snapshot;
+
+      snapshot.add(42);
+      active.add(1);
+      active.add(500, 4);
+
+      active.reset_and_swap(snapshot);
+
+      CHECK(active.empty());
+      CHECK_EQUAL(5U, snapshot.total_count());
+      CHECK_EQUAL(0U, snapshot.count(42));
+      CHECK_EQUAL(4U, snapshot.count(500));
+
+      Small copy(snapshot);
+      CHECK_EQUAL(5U, copy.total_count());
+
+      active = copy;
+      CHECK_EQUAL(4U, active.count(500));
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    TEST(test_concurrent_add)
+    {
+      static Latency histogram;
+
+      const size_t Threads = 4U;
+      const size_t Values  = 10000U;
+
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.emplace_back([t]()
+        {
+          for (size_t i = 0U; i < Values; ++i)
+          {
+            histogram.add(uint64_t((t * Values) + i));
+          }
+        });
+      }
+
+      for (std::thread& thread : threads)
+      {
+        thread.join();
+      }
+
+      CHECK_EQUAL(Threads * Values, histogram.total_count());
+    }
+#endif
+  }
+}
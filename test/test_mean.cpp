@@ -31,6 +31,8 @@ SOFTWARE.
 #include "etl/mean.h"
 
 #include <array>
+#include <random>
+#include <vector>
 
 namespace
 {
@@ -51,6 +53,51 @@ namespace
     0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0
   };
 
+  //*********************************
+  // Values spread evenly over [-range, range].
+  template <typename T>
+  std::vector<T> make_values(uint32_t seed, size_t size, int32_t range)
+  {
+    std::mt19937 generator(seed);
+    std::vector<T> values;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      values.push_back(T(int32_t(generator() % uint32_t((2 * range) + 1)) - range));
+    }
+
+    return values;
+  }
+
+  //*********************************
+  // Values with a mean of about 1000 and a standard deviation of about 1.
+  std::vector<float> make_large_window(uint32_t seed, size_t size)
+  {
+    std::mt19937 generator(seed);
+    std::vector<float> values;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      values.push_back(1000.0f + (float(int32_t(generator() % 2001U) - 1000) / 577.0f));
+    }
+
+    return values;
+  }
+
+  //*********************************
+  template <typename T>
+  double reference_mean(const std::vector<T>& values)
+  {
+    double sum = 0.0;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      sum += double(values[i]);
+    }
+
+    return sum / double(values.size());
+  }
+
   SUITE(test_mean)
   {
     //*************************************************************************
@@ -112,5 +159,71 @@ namespace
       mean_result = mean1.get_mean();
       CHECK_CLOSE(4.5, mean_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_mean_add_span_int16)
+    {
+      // 1003 is not a multiple of the lane count, so the tail is used.
+      std::vector<int16_t> values = make_values<int16_t>(1U, 1003U, 32767);
+
+      etl::mean<int16_t, int32_t> by_value(values.begin(), values.end());
+      etl::mean<int16_t, int32_t> by_span;
+      by_span.add(etl::span<const int16_t>(values.data(), values.size()));
+
+      CHECK_EQUAL(values.size(), by_span.count());
+      CHECK_EQUAL(by_value.get_mean(), by_span.get_mean());
+      CHECK_CLOSE(reference_mean(values), by_span.get_mean(), 1e-9);
+    }
+
+    //*************************************************************************
+    TEST(test_mean_add_span_int32)
+    {
+      std::vector<int32_t> values = make_values<int32_t>(2U, 1001U, 1000000);
+
+      etl::mean<int32_t, int64_t> by_value(values.begin(), values.end());
+      etl::mean<int32_t, int64_t> by_span;
+      by_span.add(etl::span<const int32_t>(values.data(), values.size()));
+
+      CHECK_EQUAL(values.size(), by_span.count());
+      CHECK_EQUAL(by_value.get_mean(), by_span.get_mean());
+      CHECK_CLOSE(reference_mean(values), by_span.get_mean(), 1e-9);
+    }
+
+    //*************************************************************************
+    TEST(test_mean_add_span_large_window)
+    {
+      std::vector<float> values = make_large_window(3U, 100000U);
+
+      etl::mean<float> by_span;
+      by_span.add(etl::span<const float>(values.data(), values.size()));
+
+      CHECK_EQUAL(values.size(), by_span.count());
+      CHECK_CLOSE(reference_mean(values), by_span.get_mean(), 1e-3);
+    }
+
+    //*************************************************************************
+    TEST(test_mean_merge)
+    {
+      std::vector<int32_t> values = make_values<int32_t>(4U, 1000U, 1000000);
+
+      etl::mean<int32_t, int64_t> all(values.begin(), values.end());
+      etl::mean<int32_t, int64_t> merged;
+      etl::mean<int32_t, int64_t> empty;
+
+      // Uneven parts, including an empty one.
+      const size_t bounds[] = { 0U, 0U, 1U, 6U, 69U, 500U, 1000U };
+
+      for (size_t i = 1U; i < (sizeof(bounds) / sizeof(bounds[0])); ++i)
+      {
+        etl::mean<int32_t, int64_t> part;
+        part.add(etl::span<const int32_t>(values.data() + bounds[i - 1U], bounds[i] - bounds[i - 1U]));
+        merged.merge(part);
+      }
+
+      merged.merge(empty);
+
+      CHECK_EQUAL(all.count(), merged.count());
+      CHECK_EQUAL(all.get_mean(), merged.get_mean());
+    }
   }
 }
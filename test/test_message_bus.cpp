@@ -30,6 +30,7 @@ SOFTWARE.
 
 #include "etl/message_router.h"
 #include "etl/message_bus.h"
+#include "etl/message_broker.h"
 #include "etl/queue.h"
 #include "etl/largest.h"
 #include "etl/packet.h"
@@ -278,6 +279,80 @@ namespace
     int message_count;
   };
 
+  //***************************************************************************
+  // Router that counts the calls to 'accepts'.
+  //***************************************************************************
+  class RouterCountAccepts : public RouterC
+  {
+  public:
+
+    RouterCountAccepts(etl::message_router_id_t id)
+      : RouterC(id)
+      , accepts_count(0)
+    {
+    }
+
+    using RouterC::accepts;
+
+    bool accepts(etl::message_id_t id) const override
+    {
+      ++accepts_count;
+      return RouterC::accepts(id);
+    }
+
+    mutable int accepts_count;
+  };
+
+  //***************************************************************************
+  // Router that subscribes another router to a bus when it gets message 1.
+  //***************************************************************************
+  class RouterSubscriber : public etl::message_router<RouterSubscriber, Message1>
+  {
+  public:
+
+    RouterSubscriber(etl::message_router_id_t id, etl::imessage_bus& bus_, etl::imessage_router& router_)
+      : message_router(id)
+      , bus(bus_)
+      , router(router_)
+    {
+    }
+
+    void on_receive(const Message1&)
+    {
+      bus.subscribe(router);
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    etl::imessage_bus&    bus;
+    etl::imessage_router& router;
+  };
+
+  //***************************************************************************
+  // Broker subscription for a fixed list of message ids.
+  //***************************************************************************
+  class BrokerSubscription : public etl::message_broker::subscription
+  {
+  public:
+
+    BrokerSubscription(etl::imessage_router& router, const etl::message_id_t* ids_, size_t n_ids_)
+      : etl::message_broker::subscription(router)
+      , ids(ids_)
+      , n_ids(n_ids_)
+    {
+    }
+
+    etl::message_broker::message_id_span_t message_id_list() const override
+    {
+      return etl::message_broker::message_id_span_t(ids, n_ids);
+    }
+
+    const etl::message_id_t* ids;
+    size_t n_ids;
+  };
+
   SUITE(test_message_bus)
   {
     //*************************************************************************
@@ -1007,5 +1082,182 @@ namespace
       CHECK_TRUE(bus1.accepts(MESSAGE6));
       CHECK_FALSE(bus1.accepts(MESSAGE7));
     }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast)
+    {
+      etl::message_bus_indexed<3, 4> bus1;
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER2);
+      RouterCountAccepts router3(ROUTER3);
+      RouterA callback(ROUTER4);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+      bus1.subscribe(router3);
+
+      Message1 message1(callback);
+      Message3 message3(callback);
+
+      bus1.receive(message1);
+      bus1.receive(message1);
+      bus1.receive(message3);
+      bus1.receive(message3);
+
+      CHECK_EQUAL(2, router1.message1_count);
+      CHECK_EQUAL(2, router1.message3_count);
+      CHECK_EQUAL(0, router1.message_unknown_count);
+
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+
+      CHECK_EQUAL(6, callback.message5_count);
+
+      // Only asked once for each message id.
+      CHECK_EQUAL(2, router3.accepts_count);
+
+      // Subscribing resets the index.
+      RouterB router4(ROUTER4);
+      bus1.unsubscribe(router2);
+      bus1.subscribe(router4);
+
+      bus1.receive(message1);
+
+      CHECK_EQUAL(3, router1.message1_count);
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(1, router4.message1_count);
+      CHECK_EQUAL(3, router3.accepts_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast_index_full)
+    {
+      etl::message_bus_indexed<2, 1> bus1;
+
+      RouterA router1(ROUTER1);
+      RouterCountAccepts router2(ROUTER2);
+      RouterA callback(ROUTER3);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+
+      Message1 message1(callback);
+      Message2 message2(callback);
+
+      bus1.receive(message1);
+      bus1.receive(message2);
+      bus1.receive(message1);
+      bus1.receive(message2);
+
+      CHECK_EQUAL(2, router1.message1_count);
+      CHECK_EQUAL(2, router1.message2_count);
+
+      // Message 2 could not be indexed.
+      CHECK_EQUAL(3, router2.accepts_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast_sub_bus)
+    {
+      etl::message_bus_indexed<3, 4> bus1;
+      MessageBus<2> bus2;
+
+      RouterA router1(ROUTER1);
+      RouterA router2(ROUTER2);
+      RouterA router3(ROUTER3);
+
+      RouterA callback(ROUTER5);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(bus2);
+
+      bus2.subscribe(router2);
+
+      Message1 message1(callback);
+
+      bus1.receive(message1);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router2.message1_count);
+
+      // Subscriptions to the sub-bus are seen without resetting the index.
+      bus2.subscribe(router3);
+
+      bus1.receive(message1);
+
+      CHECK_EQUAL(2, router1.message1_count);
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(1, router3.message1_count);
+
+      CHECK_EQUAL(2, bus2.message_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast_broker_subscribes_later)
+    {
+      etl::message_bus_indexed<3, 4> bus1;
+      etl::message_broker broker;
+
+      RouterA router1(ROUTER1);
+      RouterA router2(ROUTER2);
+      RouterA callback(ROUTER3);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(broker);
+
+      Message1 message1(callback);
+
+      // The broker has no subscriptions when message 1 is first indexed.
+      bus1.receive(message1);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(0, router2.message1_count);
+
+      const etl::message_id_t ids[] = { MESSAGE1 };
+      BrokerSubscription subscription(router2, ids, 1U);
+      broker.subscribe(subscription);
+
+      bus1.receive(message1);
+
+      CHECK_EQUAL(2, router1.message1_count);
+      CHECK_EQUAL(1, router2.message1_count);
+
+      broker.unsubscribe(router2);
+
+      bus1.receive(message1);
+
+      CHECK_EQUAL(3, router1.message1_count);
+      CHECK_EQUAL(1, router2.message1_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast_subscribe_during_broadcast)
+    {
+      etl::message_bus_indexed<4, 4> bus1;
+
+      RouterA router0(ROUTER1);
+      RouterA router2(ROUTER3);
+      RouterA callback(ROUTER4);
+      RouterSubscriber subscriber(ROUTER2, bus1, router0);
+
+      bus1.subscribe(subscriber);
+      bus1.subscribe(router2);
+
+      Message1 message1(callback);
+
+      // The subscriber adds router0 while message 1 is being broadcast.
+      bus1.receive(message1);
+
+      // The broadcast still reached the routers after the subscriber.
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(0, router0.message1_count);
+
+      bus1.unsubscribe(subscriber);
+      bus1.receive(message1);
+
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(1, router0.message1_count);
+    }
   }
 }
@@ -0,0 +1,402 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/message_router_async.h"
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+#include "etl/shared_message.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+
+#include <thread>
+#include <mutex>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  constexpr etl::message_id_t MessageId1 = 1U;
+  constexpr etl::message_id_t MessageId2 = 2U;
+  constexpr etl::message_id_t MessageId3 = 3U;
+
+  constexpr etl::message_router_id_t RouterId1 = 1U;
+
+  //*************************************************************************
+  struct Message1 : public etl::message<MessageId1>
+  {
+    Message1(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  //*************************************************************************
+  struct Message2 : public etl::message<MessageId2>
+  {
+  };
+
+  //*************************************************************************
+  struct Message3 : public etl::message<MessageId3>
+  {
+  };
+
+  //*************************************************************************
+  struct Router1 : public etl::message_router<Router1, Message1, Message2>
+  {
+    Router1()
+      : message_router(RouterId1)
+      , count_message1(0)
+      , count_message2(0)
+      , sum(0)
+      , last_i(-1)
+      , in_order(true)
+    {
+    }
+
+    void on_receive(const Message1& msg)
+    {
+      ++count_message1;
+      sum += msg.i;
+
+      if (msg.i <= last_i)
+      {
+        in_order = false;
+      }
+
+      last_i = msg.i;
+    }
+
+    void on_receive(const Message2&)
+    {
+      ++count_message2;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    int  count_message1;
+    int  count_message2;
+    long sum;
+    int  last_i;
+    bool in_order;
+  };
+
+  using pool_message_parameters = etl::atomic_counted_message_pool::pool_message_parameters<Message1, Message2>;
+
+  //*************************************************************************
+  class LockedMessagePool : public etl::atomic_counted_message_pool
+  {
+  public:
+
+    LockedMessagePool(etl::imemory_block_allocator& memory_block_allocator_)
+      : etl::atomic_counted_message_pool(memory_block_allocator_)
+    {
+    }
+
+  protected:
+
+    void lock() override
+    {
+      mutex.lock();
+    }
+
+    void unlock() override
+    {
+      mutex.unlock();
+    }
+
+  private:
+
+    std::mutex mutex;
+  };
+
+  //*************************************************************************
+  struct Overflow
+  {
+    Overflow()
+      : count(0)
+    {
+    }
+
+    void on_overflow(const etl::shared_message& msg)
+    {
+      ++count;
+      id = msg.get_message().get_message_id();
+    }
+
+    int count;
+    etl::message_id_t id;
+  };
+
+  //*************************************************************************
+  struct HighWater
+  {
+    HighWater()
+      : level(0U)
+    {
+    }
+
+    void on_high_water(size_t level_)
+    {
+      level = level_;
+    }
+
+    size_t level;
+  };
+
+  SUITE(test_message_router_async)
+  {
+    //*************************************************************************
+    TEST(test_queued_and_processed_in_batches)
+    {
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment,
+                                              8U> memory_allocator;
+
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      Router1 router;
+      etl::message_router_async<4> async_router(router);
+
+      CHECK_EQUAL(router.get_message_router_id(), async_router.get_message_router_id());
+      CHECK_TRUE(async_router.accepts(MessageId1));
+      CHECK_TRUE(async_router.accepts(MessageId2));
+      CHECK_FALSE(async_router.accepts(MessageId3));
+      CHECK_TRUE(async_router.is_consumer());
+
+      etl::shared_message sm1(message_pool, Message1(1));
+
+      async_router.receive(sm1);
+      async_router.receive(etl::shared_message(message_pool, Message2()));
+      async_router.receive(etl::shared_message(message_pool, Message1(2)));
+
+      CHECK_EQUAL(3U, async_router.size());
+      CHECK_EQUAL(2U, sm1.get_reference_count());
+      CHECK_EQUAL(0, router.count_message1);
+      CHECK_EQUAL(0, router.count_message2);
+
+      CHECK_EQUAL(2U, async_router.process_queue(2U));
+      CHECK_EQUAL(1, router.count_message1);
+      CHECK_EQUAL(1, router.count_message2);
+      CHECK_EQUAL(1U, async_router.size());
+
+      CHECK_EQUAL(1U, async_router.process_queue());
+      CHECK_EQUAL(2, router.count_message1);
+      CHECK_EQUAL(3, router.sum);
+      CHECK_TRUE(async_router.empty());
+
+      CHECK_EQUAL(0U, async_router.process_queue());
+
+      // The inbox has released the message.
+      CHECK_EQUAL(1U, sm1.get_reference_count());
+    }
+
+    //*************************************************************************
+    TEST(test_message_not_shared_is_rejected)
+    {
+      Router1 router;
+      etl::message_router_async<4> async_router(router);
+
+      Message1 message1(1);
+      CHECK_THROW(async_router.receive(message1), etl::message_router_async_not_shared);
+
+      CHECK_EQUAL(0, router.count_message1);
+      CHECK_TRUE(async_router.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_overflow_and_high_water)
+    {
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment,
+                                              8U> memory_allocator;
+
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      Router1 router;
+      etl::message_router_async<2> async_router(router);
+
+      Overflow  overflow;
+      HighWater high_water;
+
+      async_router.set_overflow_callback(etl::message_router_async<2>::overflow_callback_type::create<Overflow, &Overflow::on_overflow>(overflow));
+      async_router.set_high_water_callback(etl::message_router_async<2>::high_water_callback_type::create<HighWater, &HighWater::on_high_water>(high_water), 2U);
+
+      async_router.receive(etl::shared_message(message_pool, Message1(1)));
+      CHECK_EQUAL(0U, high_water.level);
+
+      async_router.receive(etl::shared_message(message_pool, Message1(2)));
+      CHECK_EQUAL(2U, high_water.level);
+
+      etl::shared_message sm2(message_pool, Message2());
+
+      async_router.receive(sm2);
+      CHECK_EQUAL(1, overflow.count);
+      CHECK_EQUAL(MessageId2, overflow.id);
+      CHECK_EQUAL(1U, async_router.get_overflow_count());
+
+      // The dropped message has been released.
+      CHECK_EQUAL(1U, sm2.get_reference_count());
+
+      async_router.process_queue();
+
+      CHECK_EQUAL(2, router.count_message1);
+      CHECK_EQUAL(0, router.count_message2);
+    }
+
+    //*************************************************************************
+    TEST(test_high_water_crossing)
+    {
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment,
+                                              8U> memory_allocator;
+
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      Router1 router;
+      etl::message_router_async<4> async_router(router);
+
+      HighWater high_water;
+
+      async_router.receive(etl::shared_message(message_pool, Message1(1)));
+      async_router.receive(etl::shared_message(message_pool, Message1(2)));
+      async_router.receive(etl::shared_message(message_pool, Message1(3)));
+
+      // The level is already passed, so the next message crosses it without equalling it.
+      async_router.set_high_water_callback(etl::message_router_async<4>::high_water_callback_type::create<HighWater, &HighWater::on_high_water>(high_water), 2U);
+
+      async_router.receive(etl::shared_message(message_pool, Message1(4)));
+      CHECK_EQUAL(4U, high_water.level);
+
+      // Still above the level, so not called again.
+      high_water.level = 0U;
+      async_router.process_queue(1U);
+      async_router.receive(etl::shared_message(message_pool, Message1(5)));
+      CHECK_EQUAL(0U, high_water.level);
+
+      // Falls below the level, then reaches it again.
+      async_router.process_queue(3U);
+      async_router.receive(etl::shared_message(message_pool, Message1(6)));
+      CHECK_EQUAL(2U, high_water.level);
+
+      // Still at the level, so not called again.
+      high_water.level = 0U;
+      async_router.receive(etl::shared_message(message_pool, Message1(7)));
+      CHECK_EQUAL(0U, high_water.level);
+
+      async_router.process_queue();
+      CHECK_EQUAL(7, router.count_message1);
+    }
+
+    //*************************************************************************
+    TEST(test_subscribed_to_bus)
+    {
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment,
+                                              4U> memory_allocator;
+
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      Router1 router;
+      etl::message_router_async<4> async_router(router);
+      etl::message_bus<1> bus;
+
+      bus.subscribe(async_router);
+
+      bus.receive(etl::shared_message(message_pool, Message1(1)));
+      bus.receive(RouterId1, etl::shared_message(message_pool, Message1(2)));
+
+      CHECK_EQUAL(0, router.count_message1);
+
+      async_router.process_queue();
+
+      CHECK_EQUAL(2, router.count_message1);
+    }
+
+    //*************************************************************************
+    TEST(test_producer_and_consumer_threads)
+    {
+      // More messages than the pool can hold, so they must all be released.
+      static const int Messages = 1000;
+
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment,
+                                              64U> memory_allocator;
+
+      // Messages are allocated and released on different threads.
+      LockedMessagePool message_pool(memory_allocator);
+
+      Router1 router;
+      etl::message_router_async<32> async_router(router);
+
+      std::atomic<bool> done(false);
+
+      std::thread producer([&]()
+      {
+        int i = 0;
+
+        while (i < Messages)
+        {
+          // Wait for space in the inbox.
+          if (async_router.size() < 32U)
+          {
+            async_router.receive(etl::shared_message(message_pool, Message1(i)));
+            ++i;
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+
+        done = true;
+      });
+
+      while (!done.load() || !async_router.empty())
+      {
+        if (async_router.process_queue(8U) == 0U)
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      producer.join();
+
+      CHECK_EQUAL(Messages, router.count_message1);
+      CHECK_EQUAL(0U, async_router.get_overflow_count());
+      CHECK_TRUE(router.in_order);
+    }
+  }
+}
+
+#endif
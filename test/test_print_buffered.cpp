@@ -0,0 +1,132 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#define ETL_PRINT_BUFFER_SIZE 8
+
+#include "unit_test_framework.h"
+
+#include "etl/print.h"
+
+#include <string>
+#include <vector>
+#include <thread>
+
+#if ETL_USING_CPP11
+
+namespace {
+  std::vector<std::string> writes;
+}
+
+// to be implemented in a concrete project, typically writing to a serial console or stdout
+extern "C" void etl_write(const char* data, size_t length)
+{
+  writes.push_back(std::string(data, length));
+}
+
+namespace
+{
+  SUITE(test_print_buffered)
+  {
+    //*************************************************************************
+    TEST(test_print_is_buffered_until_flush)
+    {
+      writes.clear();
+      etl::print("Hello");
+      CHECK(writes.empty());
+
+      etl::print_flush();
+      CHECK_EQUAL(1U, writes.size());
+      CHECK_EQUAL(std::string("Hello"), writes[0]);
+
+      // Nothing more to flush.
+      etl::print_flush();
+      CHECK_EQUAL(1U, writes.size());
+    }
+
+    //*************************************************************************
+    TEST(test_print_writes_full_buffers)
+    {
+      writes.clear();
+      etl::print("The answer is {}!", 42);
+      etl::println();
+
+      CHECK_EQUAL(2U, writes.size());
+      CHECK_EQUAL(std::string("The answ"), writes[0]);
+      CHECK_EQUAL(std::string("er is 42"), writes[1]);
+
+      etl::print_flush();
+      CHECK_EQUAL(3U, writes.size());
+      CHECK_EQUAL(std::string("!\n"), writes[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_println_is_buffered)
+    {
+      writes.clear();
+      etl::println("{} {}", 1, 2);
+      etl::println(etl::compile_format<int>("[{}]"), 3);
+      etl::print_flush();
+
+      std::string output;
+
+      for (const std::string& write : writes)
+      {
+        CHECK(write.size() <= 8U);
+        output += write;
+      }
+
+      CHECK_EQUAL(std::string("1 2\n[3]\n"), output);
+    }
+
+    //*************************************************************************
+    TEST(test_print_buffer_per_thread)
+    {
+      writes.clear();
+      etl::print("ab");
+
+      // The other thread has its own buffer.
+      std::thread other([]()
+      {
+        etl::print("cd");
+        etl::print_flush();
+      });
+
+      other.join();
+
+      CHECK_EQUAL(1U, writes.size());
+      CHECK_EQUAL(std::string("cd"), writes[0]);
+
+      etl::print_flush();
+      CHECK_EQUAL(2U, writes.size());
+      CHECK_EQUAL(std::string("ab"), writes[1]);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,231 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/radix_sort.h"
+
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <cmath>
+
+namespace
+{
+  struct Record
+  {
+    uint32_t timestamp;
+    int      sequence;
+  };
+
+  bool operator <(const Record& lhs, const Record& rhs)
+  {
+    return lhs.timestamp < rhs.timestamp;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  std::vector<T> make_random(size_t n, T low, T high, unsigned seed)
+  {
+    std::mt19937_64 generator(seed);
+    std::vector<T> result(n);
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      const double fraction = double(generator() >> 11) / double(1ULL << 53);
+      result[i] = static_cast<T>(double(low) + (fraction * (double(high) - double(low))));
+    }
+
+    return result;
+  }
+
+  SUITE(test_radix_sort)
+  {
+    //*************************************************************************
+    TEST(test_unsigned_32)
+    {
+      std::vector<uint32_t> data    = make_random<uint32_t>(10000U, 0U, 0xFFFFFFFFU, 1U);
+      std::vector<uint32_t> compare = data;
+      std::vector<uint32_t> scratch(data.size());
+
+      etl::radix_sort(data.begin(), data.end(), etl::span<uint32_t>(scratch.data(), scratch.size()));
+      std::sort(compare.begin(), compare.end());
+
+      CHECK_TRUE(compare == data);
+    }
+
+    //*************************************************************************
+    TEST(test_unsigned_8_and_64)
+    {
+      std::vector<uint8_t>  data8    = make_random<uint8_t>(1000U, 0U, 255U, 2U);
+      std::vector<uint8_t>  compare8 = data8;
+      std::vector<uint8_t>  scratch8(data8.size());
+      std::vector<uint64_t> data64;
+      std::mt19937_64 generator(3U);
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data64.push_back(generator());
+      }
+
+      std::vector<uint64_t> compare64 = data64;
+      std::vector<uint64_t> scratch64(data64.size());
+
+      etl::radix_sort(data8.begin(), data8.end(), etl::span<uint8_t>(scratch8.data(), scratch8.size()));
+      etl::radix_sort(data64.data(), data64.data() + data64.size(), etl::span<uint64_t>(scratch64.data(), scratch64.size()));
+      std::sort(compare8.begin(), compare8.end());
+      std::sort(compare64.begin(), compare64.end());
+
+      CHECK_TRUE(compare8 == data8);
+      CHECK_TRUE(compare64 == data64);
+    }
+
+    //*************************************************************************
+    TEST(test_signed)
+    {
+      std::vector<int32_t> data = make_random<int32_t>(5000U, -1000000, 1000000, 4U);
+      data.push_back(std::numeric_limits<int32_t>::min());
+      data.push_back(std::numeric_limits<int32_t>::max());
+      data.push_back(0);
+      data.push_back(-1);
+
+      std::vector<int32_t> compare = data;
+      std::vector<int32_t> scratch(data.size());
+
+      etl::radix_sort(data.begin(), data.end(), etl::span<int32_t>(scratch.data(), scratch.size()));
+      std::sort(compare.begin(), compare.end());
+
+      CHECK_TRUE(compare == data);
+
+      std::vector<int16_t> data16    = make_random<int16_t>(1000U, -32768, 32767, 5U);
+      std::vector<int16_t> compare16 = data16;
+      std::vector<int16_t> scratch16(data16.size());
+
+      etl::radix_sort(data16.begin(), data16.end(), etl::span<int16_t>(scratch16.data(), scratch16.size()));
+      std::sort(compare16.begin(), compare16.end());
+
+      CHECK_TRUE(compare16 == data16);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      std::vector<float> data = make_random<float>(5000U, -1.0e6f, 1.0e6f, 6U);
+      data.push_back(std::numeric_limits<float>::infinity());
+      data.push_back(-std::numeric_limits<float>::infinity());
+      data.push_back(std::numeric_limits<float>::min());
+      data.push_back(-std::numeric_limits<float>::max());
+
+      std::vector<float> compare = data;
+      std::vector<float> scratch(data.size());
+
+      etl::radix_sort(data.begin(), data.end(), etl::span<float>(scratch.data(), scratch.size()));
+      std::sort(compare.begin(), compare.end());
+
+      CHECK_TRUE(compare == data);
+
+      std::vector<double> datad    = make_random<double>(5000U, -1.0e300, 1.0e300, 7U);
+      std::vector<double> compared = datad;
+      std::vector<double> scratchd(datad.size());
+
+      etl::radix_sort(datad.begin(), datad.end(), etl::span<double>(scratchd.data(), scratchd.size()));
+      std::sort(compared.begin(), compared.end());
+
+      CHECK_TRUE(compared == datad);
+    }
+
+    //*************************************************************************
+    TEST(test_negative_zero_before_positive_zero)
+    {
+      float data[] = { 0.0f, -0.0f, 1.0f, -1.0f };
+      float scratch[4];
+
+      etl::radix_sort(data, data + 4, scratch);
+
+      CHECK_EQUAL(-1.0f, data[0]);
+      CHECK_TRUE(std::signbit(data[1]));
+      CHECK_FALSE(std::signbit(data[2]));
+      CHECK_EQUAL(1.0f, data[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_records_are_stable)
+    {
+      std::vector<Record> data;
+      std::mt19937 generator(8U);
+
+      // Timestamps share their upper bytes, so those digits are skipped.
+      for (int i = 0; i < 10000; ++i)
+      {
+        Record record = { static_cast<uint32_t>(0x12340000U + (generator() % 500U)), i };
+        data.push_back(record);
+      }
+
+      std::vector<Record> compare = data;
+      std::vector<Record> scratch(data.size());
+
+      etl::radix_sort(data.begin(), data.end(), etl::span<Record>(scratch.data(), scratch.size()),
+                      [](const Record& record) { return record.timestamp; });
+      std::stable_sort(compare.begin(), compare.end());
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(compare[i].timestamp, data[i].timestamp);
+        CHECK_EQUAL(compare[i].sequence,  data[i].sequence);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_all_equal_and_short)
+    {
+      std::vector<uint32_t> data(100U, 42U);
+      uint32_t scratch[1];
+
+      // Every digit is skipped, so the scratch area is never written.
+      std::vector<uint32_t> scratch_all(100U);
+      etl::radix_sort(data.begin(), data.end(), etl::span<uint32_t>(scratch_all.data(), scratch_all.size()));
+      CHECK_TRUE(std::vector<uint32_t>(100U, 42U) == data);
+
+      uint32_t one[] = { 5U };
+      etl::radix_sort(one, one + 1, scratch);
+      CHECK_EQUAL(5U, one[0]);
+
+      etl::radix_sort(one, one, scratch);
+    }
+
+    //*************************************************************************
+    TEST(test_scratch_too_small)
+    {
+      uint32_t data[]    = { 3U, 2U, 1U };
+      uint32_t scratch[2];
+
+      CHECK_THROW(etl::radix_sort(data, data + 3, scratch), etl::algorithm_error);
+    }
+  }
+}
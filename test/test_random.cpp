@@ -359,6 +359,86 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_random_xoshiro256ss_sequence)
+    {
+      etl::random_xoshiro256ss r(12345UL);
+
+      CHECK_EQUAL(3194631735UL, r());
+      CHECK_EQUAL(558541318UL,  r());
+      CHECK_EQUAL(4137490142UL, r());
+      CHECK_EQUAL(207619212UL,  r());
+      CHECK_EQUAL(2384492206UL, r());
+    }
+
+    //*************************************************************************
+    TEST(test_random_xoshiro256ss_range)
+    {
+      etl::random_xoshiro256ss r;
+
+      uint32_t low  = 1234UL;
+      uint32_t high = 9876UL;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint32_t n = r.range(low, high);
+
+        CHECK(n >= low);
+        CHECK(n <= high);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_wyrand_sequence)
+    {
+      etl::random_wyrand r(12345UL);
+
+      CHECK_EQUAL(876673524UL,  r());
+      CHECK_EQUAL(3348405279UL, r());
+      CHECK_EQUAL(3667398290UL, r());
+      CHECK_EQUAL(3329904371UL, r());
+      CHECK_EQUAL(2731216262UL, r());
+    }
+
+    //*************************************************************************
+    TEST(test_random_wyrand_range)
+    {
+      etl::random_wyrand r;
+
+      uint32_t low  = 1234UL;
+      uint32_t high = 9876UL;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint32_t n = r.range(low, high);
+
+        CHECK(n >= low);
+        CHECK(n <= high);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_64_bit_fill_uses_both_halves)
+    {
+      etl::random_xoshiro256ss r1(12345UL);
+      etl::random_xoshiro256ss r2(12345UL);
+
+      uint32_t values[5];
+      r1.fill(etl::span<uint32_t>(values, 5U));
+
+      // The upper halves match operator().
+      CHECK_EQUAL(r2(), values[0]);
+      CHECK_EQUAL(r2(), values[2]);
+
+      // The odd element at the end is taken from operator().
+      CHECK_EQUAL(r2(), values[4]);
+      CHECK(values[1] != values[0]);
+      CHECK(values[3] != values[2]);
+
+      // The generators are now in step.
+      CHECK_EQUAL(r2(), r1());
+    }
+
     //*************************************************************************
     TEST(test_random_hash_sequence)
     {
@@ -411,5 +491,122 @@ namespace
         CHECK(n <= high);
       }
     }
+
+    //*************************************************************************
+    TEST(test_random_range_multiply_shift)
+    {
+      etl::random_xorshift r1(1UL);
+      etl::random_xorshift r2(1UL);
+
+      uint32_t low  = 1234UL;
+      uint32_t high = 9876UL;
+      uint32_t size = high - low + 1UL;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        uint32_t expected = low + uint32_t((uint64_t(r2()) * size) >> 32U);
+
+        CHECK_EQUAL(expected, r1.range(low, high));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_range_limits)
+    {
+      etl::random_xorshift r1(1UL);
+      etl::random_xorshift r2(1UL);
+
+      // The full range returns the raw sequence.
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL(r2(), r1.range(0UL, 0xFFFFFFFFUL));
+      }
+
+      // A single value range.
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL(42UL, r1.range(42UL, 42UL));
+      }
+
+      // The 31 bit generators.
+      etl::random_lcg  lcg1(1UL);
+      etl::random_lcg  lcg2(1UL);
+      etl::random_clcg clcg1(1UL);
+      etl::random_clcg clcg2(1UL);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL(lcg2(),  lcg1.range(0UL, 0xFFFFFFFFUL));
+        CHECK_EQUAL(clcg2(), clcg1.range(0UL, 0xFFFFFFFFUL));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_range_uniform)
+    {
+      etl::random_pcg r(1UL);
+
+      // 3 does not divide 2^32, so the modulo method would be biased towards 0.
+      int counts[3] = { 0, 0, 0 };
+
+      for (int i = 0; i < 300000; ++i)
+      {
+        ++counts[r.range(0UL, 2UL)];
+      }
+
+      for (int i = 0; i < 3; ++i)
+      {
+        CHECK(counts[i] > 99000);
+        CHECK(counts[i] < 101000);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_fill)
+    {
+      etl::random_mwc r1(1UL);
+      etl::random_mwc r2(1UL);
+
+      std::vector<uint32_t> values(1001);
+      r1.fill(etl::span<uint32_t>(values.data(), values.size()));
+
+      for (size_t i = 0UL; i < values.size(); ++i)
+      {
+        CHECK_EQUAL(r2(), values[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_fill_float)
+    {
+      etl::random_lcg          r1(1UL);
+      etl::random_clcg         r2(1UL);
+      etl::random_wyrand       r3(1UL);
+      etl::random_xoshiro256ss r4(1UL);
+
+      std::vector<float> values(1001);
+
+      etl::random* generators[] = { &r1, &r2, &r3, &r4 };
+
+      for (size_t g = 0UL; g < 4UL; ++g)
+      {
+        // Called through the base.
+        generators[g]->fill(etl::span<float>(values.data(), values.size()));
+
+        float total = 0.0f;
+
+        for (size_t i = 0UL; i < values.size(); ++i)
+        {
+          CHECK(values[i] >= 0.0f);
+          CHECK(values[i] < 1.0f);
+          total += values[i];
+        }
+
+        float mean = total / float(values.size());
+
+        CHECK(mean > 0.45f);
+        CHECK(mean < 0.55f);
+      }
+    }
   }
 }
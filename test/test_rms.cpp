@@ -31,6 +31,8 @@ SOFTWARE.
 #include "etl/rms.h"
 
 #include <array>
+#include <random>
+#include <vector>
 
 namespace
 {
@@ -47,6 +49,51 @@ namespace
     0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, -8.0, -7.0, -6.0, -5.0, -4.0, -3.0, -2.0, -1.0
   };
 
+  //*********************************
+  // Values spread evenly over [-range, range].
+  template <typename T>
+  std::vector<T> make_values(uint32_t seed, size_t size, int32_t range)
+  {
+    std::mt19937 generator(seed);
+    std::vector<T> values;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      values.push_back(T(int32_t(generator() % uint32_t((2 * range) + 1)) - range));
+    }
+
+    return values;
+  }
+
+  //*********************************
+  // Values with a mean of about 1000 and a standard deviation of about 1.
+  std::vector<float> make_large_window(uint32_t seed, size_t size)
+  {
+    std::mt19937 generator(seed);
+    std::vector<float> values;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      values.push_back(1000.0f + (float(int32_t(generator() % 2001U) - 1000) / 577.0f));
+    }
+
+    return values;
+  }
+
+  //*********************************
+  template <typename T>
+  double reference_rms(const std::vector<T>& values)
+  {
+    double sum_of_squares = 0.0;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      sum_of_squares += double(values[i]) * double(values[i]);
+    }
+
+    return sqrt(sum_of_squares / double(values.size()));
+  }
+
   SUITE(test_rms)
   {
     //*************************************************************************
@@ -66,5 +113,66 @@ namespace
 
       CHECK_CLOSE(5.21, result, 0.05);
     }
+
+    //*************************************************************************
+    TEST(test_rms_add_span_int16)
+    {
+      std::vector<int16_t> values = make_values<int16_t>(5U, 1003U, 32767);
+
+      etl::rms<int16_t, int64_t> by_value(values.begin(), values.end());
+      etl::rms<int16_t, int64_t> by_span;
+      by_span.add(etl::span<const int16_t>(values.data(), values.size()));
+
+      CHECK_EQUAL(values.size(), by_span.count());
+      CHECK_EQUAL(by_value.get_rms(), by_span.get_rms());
+      CHECK_CLOSE(reference_rms(values), by_span.get_rms(), 1e-9);
+    }
+
+    //*************************************************************************
+    TEST(test_rms_add_span_int32)
+    {
+      std::vector<int32_t> values = make_values<int32_t>(6U, 1001U, 1000000);
+
+      etl::rms<int32_t, int64_t> by_value(values.begin(), values.end());
+      etl::rms<int32_t, int64_t> by_span;
+      by_span.add(etl::span<const int32_t>(values.data(), values.size()));
+
+      CHECK_EQUAL(values.size(), by_span.count());
+      CHECK_EQUAL(by_value.get_rms(), by_span.get_rms());
+      CHECK_CLOSE(reference_rms(values), by_span.get_rms(), 1e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_rms_add_span_large_window)
+    {
+      std::vector<float> values = make_large_window(7U, 100000U);
+
+      etl::rms<float> by_span;
+      by_span.add(etl::span<const float>(values.data(), values.size()));
+
+      CHECK_EQUAL(values.size(), by_span.count());
+      CHECK_CLOSE(reference_rms(values), by_span.get_rms(), 1e-3);
+    }
+
+    //*************************************************************************
+    TEST(test_rms_merge)
+    {
+      std::vector<int16_t> values = make_values<int16_t>(8U, 1000U, 32767);
+
+      etl::rms<int16_t, int64_t> all(values.begin(), values.end());
+      etl::rms<int16_t, int64_t> merged;
+
+      const size_t bounds[] = { 0U, 3U, 3U, 64U, 129U, 1000U };
+
+      for (size_t i = 1U; i < (sizeof(bounds) / sizeof(bounds[0])); ++i)
+      {
+        etl::rms<int16_t, int64_t> part;
+        part.add(etl::span<const int16_t>(values.data() + bounds[i - 1U], bounds[i] - bounds[i - 1U]));
+        merged.merge(part);
+      }
+
+      CHECK_EQUAL(all.count(), merged.count());
+      CHECK_EQUAL(all.get_rms(), merged.get_rms());
+    }
   }
 }
@@ -0,0 +1,377 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/roaring_bitmap.h"
+
+#include <set>
+#include <vector>
+#include <random>
+#include <memory>
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+  typedef etl::roaring_bitmap<20> Bitmap;
+
+  //***************************************************************************
+  /// Values spread over several chunks, with sparse, dense and run filled chunks.
+  //***************************************************************************
+  std::set<uint32_t> make_values(unsigned seed)
+  {
+    std::mt19937 generator(seed);
+    std::set<uint32_t> values;
+
+    // Sparse chunk.
+    for (int i = 0; i < 300; ++i)
+    {
+      values.insert(0x00000000U + (generator() & 0xFFFFU));
+    }
+
+    // Dense chunk, more than fits in an array.
+    for (int i = 0; i < 20000; ++i)
+    {
+      values.insert(0x00030000U + (generator() & 0xFFFFU));
+    }
+
+    // Runs.
+    for (uint32_t start = 0U; start < 60000U; start += 1000U)
+    {
+      for (uint32_t i = 0U; i < 500U; ++i)
+      {
+        values.insert(0x00070000U + start + (generator() % 7U) + i);
+      }
+    }
+
+    // The last chunk.
+    values.insert(0xFFFFFFFFU);
+    values.insert(0xFFFF0000U);
+
+    return values;
+  }
+
+  //***************************************************************************
+  bool contents_equal(const Bitmap& bitmap, const std::set<uint32_t>& expected)
+  {
+    std::vector<uint32_t> from_iterator(bitmap.begin(), bitmap.end());
+
+    std::vector<uint32_t> from_for_each;
+    bitmap.for_each([&from_for_each](uint32_t value) { from_for_each.push_back(value); });
+
+    std::vector<uint32_t> compare(expected.begin(), expected.end());
+
+    return (bitmap.count() == expected.size()) && (compare == from_iterator) && (compare == from_for_each);
+  }
+
+  SUITE(test_roaring_bitmap)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      std::unique_ptr<Bitmap> bitmap(new Bitmap);
+
+      CHECK_TRUE(bitmap->empty());
+      CHECK_EQUAL(0U, bitmap->count());
+      CHECK_EQUAL(0U, bitmap->container_count());
+      CHECK_EQUAL(20U, bitmap->max_containers());
+      CHECK_TRUE(bitmap->begin() == bitmap->end());
+      CHECK_FALSE(bitmap->contains(0U));
+    }
+
+    //*************************************************************************
+    TEST(test_add_contains)
+    {
+      std::unique_ptr<Bitmap> bitmap(new Bitmap);
+      const std::set<uint32_t> values = make_values(1U);
+
+      for (uint32_t value : values)
+      {
+        CHECK_TRUE(bitmap->add(value));
+      }
+
+      // Adding again changes nothing.
+      CHECK_FALSE(bitmap->add(*values.begin()));
+
+      CHECK_EQUAL(4U, bitmap->container_count());
+      CHECK_TRUE(contents_equal(*bitmap, values));
+
+      for (uint32_t value = 0x00070000U; value < 0x00080000U; ++value)
+      {
+        CHECK_EQUAL(values.count(value) != 0U, bitmap->contains(value));
+      }
+
+      CHECK_FALSE(bitmap->contains(0x00010000U));
+      CHECK_TRUE(bitmap->contains(0xFFFFFFFFU));
+    }
+
+    //*************************************************************************
+    TEST(test_add_range)
+    {
+      std::unique_ptr<Bitmap> bitmap(new Bitmap);
+      const std::vector<uint32_t> values = { 5U, 1U, 70000U, 5U, 3U };
+
+      bitmap->add(values.begin(), values.end());
+
+      CHECK_TRUE(contents_equal(*bitmap, std::set<uint32_t>(values.begin(), values.end())));
+    }
+
+    //*************************************************************************
+    TEST(test_array_to_bitmap_and_back)
+    {
+      std::unique_ptr<Bitmap> bitmap(new Bitmap);
+      std::set<uint32_t> expected;
+
+      // Every other value, so the container stops fitting in an array.
+      for (uint32_t value = 0U; value < 2U * 4097U; value += 2U)
+      {
+        bitmap->add(value);
+        expected.insert(value);
+      }
+
+      CHECK_TRUE(contents_equal(*bitmap, expected));
+
+      CHECK_TRUE(bitmap->remove(0U));
+      CHECK_TRUE(bitmap->remove(2U));
+      CHECK_FALSE(bitmap->remove(2U));
+      CHECK_FALSE(bitmap->remove(1U));
+      expected.erase(0U);
+      expected.erase(2U);
+
+      CHECK_TRUE(contents_equal(*bitmap, expected));
+    }
+
+    //*************************************************************************
+    TEST(test_remove_to_empty)
+    {
+      std::unique_ptr<Bitmap> bitmap(new Bitmap);
+      std::set<uint32_t> values = make_values(2U);
+
+      bitmap->add(values.begin(), values.end());
+
+      std::vector<uint32_t> shuffled(values.begin(), values.end());
+      std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(3U));
+
+      for (size_t i = 0U; i < shuffled.size(); ++i)
+      {
+        CHECK_TRUE(bitmap->remove(shuffled[i]));
+        values.erase(shuffled[i]);
+
+        if ((i % 997U) == 0U)
+        {
+          CHECK_TRUE(contents_equal(*bitmap, values));
+        }
+      }
+
+      CHECK_TRUE(bitmap->empty());
+      CHECK_EQUAL(0U, bitmap->container_count());
+    }
+
+    //*************************************************************************
+    TEST(test_run_optimize)
+    {
+      std::unique_ptr<Bitmap> bitmap(new Bitmap);
+      std::set<uint32_t> values = make_values(4U);
+
+      // A full chunk is a single run.
+      for (uint32_t value = 0x00090000U; value < 0x000A0000U; ++value)
+      {
+        values.insert(value);
+      }
+
+      bitmap->add(values.begin(), values.end());
+      bitmap->run_optimize();
+
+      CHECK_TRUE(contents_equal(*bitmap, values));
+
+      for (uint32_t value = 0x00070000U; value < 0x00080000U; value += 3U)
+      {
+        CHECK_EQUAL(values.count(value) != 0U, bitmap->contains(value));
+      }
+
+      CHECK_TRUE(bitmap->contains(0x00090000U));
+      CHECK_TRUE(bitmap->contains(0x0009FFFFU));
+
+      // Modifying a container of runs.
+      CHECK_TRUE(bitmap->remove(0x00090005U));
+      CHECK_FALSE(bitmap->add(0x00090006U));
+      CHECK_TRUE(bitmap->add(0x00070000U + 999U));
+      values.erase(0x00090005U);
+      values.insert(0x00070000U + 999U);
+
+      CHECK_TRUE(contents_equal(*bitmap, values));
+
+      // Optimising twice changes nothing.
+      bitmap->run_optimize();
+      bitmap->run_optimize();
+      CHECK_TRUE(contents_equal(*bitmap, values));
+    }
+
+    //*************************************************************************
+    TEST(test_intersection)
+    {
+      for (int optimise = 0; optimise < 4; ++optimise)
+      {
+        std::unique_ptr<Bitmap> bitmap1(new Bitmap);
+        std::unique_ptr<Bitmap> bitmap2(new Bitmap);
+
+        const std::set<uint32_t> values1 = make_values(5U);
+        std::set<uint32_t> values2 = make_values(6U);
+        values2.insert(0x00100000U);
+
+        bitmap1->add(values1.begin(), values1.end());
+        bitmap2->add(values2.begin(), values2.end());
+
+        if ((optimise & 1) != 0) { bitmap1->run_optimize(); }
+        if ((optimise & 2) != 0) { bitmap2->run_optimize(); }
+
+        std::set<uint32_t> expected;
+        std::set_intersection(values1.begin(), values1.end(), values2.begin(), values2.end(), std::inserter(expected, expected.begin()));
+
+        *bitmap1 &= *bitmap2;
+
+        CHECK_TRUE(contents_equal(*bitmap1, expected));
+        CHECK_TRUE(contents_equal(*bitmap2, values2));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_union)
+    {
+      for (int optimise = 0; optimise < 4; ++optimise)
+      {
+        std::unique_ptr<Bitmap> bitmap1(new Bitmap);
+        std::unique_ptr<Bitmap> bitmap2(new Bitmap);
+
+        const std::set<uint32_t> values1 = make_values(7U);
+        std::set<uint32_t> values2 = make_values(8U);
+        values2.insert(0x00100000U);
+        values2.insert(0x00200000U);
+
+        bitmap1->add(values1.begin(), values1.end());
+        bitmap2->add(values2.begin(), values2.end());
+
+        if ((optimise & 1) != 0) { bitmap1->run_optimize(); }
+        if ((optimise & 2) != 0) { bitmap2->run_optimize(); }
+
+        std::set<uint32_t> expected = values1;
+        expected.insert(values2.begin(), values2.end());
+
+        *bitmap1 |= *bitmap2;
+
+        CHECK_TRUE(contents_equal(*bitmap1, expected));
+        CHECK_EQUAL(6U, bitmap1->container_count());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_small_arrays)
+    {
+      std::unique_ptr<Bitmap> bitmap1(new Bitmap);
+      std::unique_ptr<Bitmap> bitmap2(new Bitmap);
+
+      bitmap1->add(1U);
+      bitmap1->add(3U);
+      bitmap1->add(5U);
+      bitmap2->add(3U);
+      bitmap2->add(4U);
+      bitmap2->add(5U);
+      bitmap2->add(65536U);
+
+      Bitmap& union_result = *std::unique_ptr<Bitmap>(new Bitmap(*bitmap1)).release();
+      union_result |= *bitmap2;
+      CHECK_TRUE(contents_equal(union_result, { 1U, 3U, 4U, 5U, 65536U }));
+      delete &union_result;
+
+      *bitmap1 &= *bitmap2;
+      CHECK_TRUE(contents_equal(*bitmap1, { 3U, 5U }));
+      CHECK_EQUAL(1U, bitmap1->container_count());
+    }
+
+    //*************************************************************************
+    TEST(test_self_operations)
+    {
+      std::unique_ptr<Bitmap> bitmap(new Bitmap);
+      const std::set<uint32_t> values = make_values(9U);
+
+      bitmap->add(values.begin(), values.end());
+
+      *bitmap &= *bitmap;
+      CHECK_TRUE(contents_equal(*bitmap, values));
+
+      *bitmap |= *bitmap;
+      CHECK_TRUE(contents_equal(*bitmap, values));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_equality)
+    {
+      std::unique_ptr<Bitmap> bitmap1(new Bitmap);
+      const std::set<uint32_t> values = make_values(10U);
+
+      bitmap1->add(values.begin(), values.end());
+
+      std::unique_ptr<Bitmap> bitmap2(new Bitmap(*bitmap1));
+      CHECK_TRUE(*bitmap1 == *bitmap2);
+
+      // Equal contents in different forms.
+      bitmap2->run_optimize();
+      CHECK_TRUE(*bitmap1 == *bitmap2);
+
+      bitmap2->remove(*values.rbegin());
+      CHECK_TRUE(*bitmap1 != *bitmap2);
+
+      *bitmap2 = *bitmap1;
+      CHECK_TRUE(*bitmap1 == *bitmap2);
+
+      bitmap1->clear();
+      CHECK_TRUE(bitmap1->empty());
+      CHECK_TRUE(contents_equal(*bitmap2, values));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::roaring_bitmap<2> bitmap;
+
+      CHECK_TRUE(bitmap.add(0x00000001U));
+      CHECK_TRUE(bitmap.add(0x00010001U));
+      CHECK_TRUE(bitmap.add(0x00010002U));
+      CHECK_THROW(bitmap.add(0x00020001U), etl::roaring_bitmap_full);
+
+      etl::roaring_bitmap<2> other;
+      other.add(0x00050000U);
+      CHECK_THROW(bitmap |= other, etl::roaring_bitmap_full);
+
+      // Releasing a container makes room.
+      CHECK_TRUE(bitmap.remove(0x00000001U));
+      CHECK_TRUE(bitmap.add(0x00020001U));
+    }
+  }
+}
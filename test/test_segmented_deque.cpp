@@ -0,0 +1,332 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/segmented_deque.h"
+#include "etl/pool.h"
+
+#include "data.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  SUITE(test_segmented_deque)
+  {
+    typedef TestDataNDC<std::string> ItemNDC;
+
+    typedef etl::segmented_deque<int, 4, 4> Data;
+    typedef etl::pool<Data::pool_type, 4>   Pool;
+    typedef etl::pool<Data::pool_type, 8>   Pool8;
+
+    typedef etl::segmented_deque<ItemNDC, 4, 4> DataNDC;
+    typedef etl::pool<DataNDC::pool_type, 4>    PoolNDC;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Pool pool;
+      Data data(pool);
+
+      CHECK_TRUE(data.empty());
+      CHECK_FALSE(data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(15U, data.max_size());
+      CHECK_EQUAL(15U, data.available());
+      CHECK_EQUAL(0U, data.block_count());
+      CHECK_EQUAL(0U, pool.size());
+      CHECK(data.begin() == data.end());
+      CHECK(&pool == &data.get_pool());
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_pop_front)
+    {
+      Pool pool;
+      Data data(pool);
+      std::deque<int> compare;
+
+      for (int i = 0; i < 15; ++i)
+      {
+        data.push_back(i);
+        compare.push_back(i);
+        CHECK_EQUAL(compare.front(), data.front());
+        CHECK_EQUAL(compare.back(), data.back());
+      }
+
+      CHECK_TRUE(data.full());
+      CHECK_EQUAL(4U, data.block_count());
+      CHECK_TRUE(std::equal(compare.begin(), compare.end(), data.begin()));
+
+      while (!data.empty())
+      {
+        CHECK_EQUAL(compare.front(), data.front());
+        data.pop_front();
+        compare.pop_front();
+      }
+
+      CHECK_EQUAL(0U, data.block_count());
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_push_front_pop_back)
+    {
+      Pool pool;
+      Data data(pool);
+      std::deque<int> compare;
+
+      for (int i = 0; i < 15; ++i)
+      {
+        data.push_front(i);
+        compare.push_front(i);
+        CHECK_EQUAL(compare.front(), data.front());
+        CHECK_EQUAL(compare.back(), data.back());
+      }
+
+      CHECK_TRUE(std::equal(compare.begin(), compare.end(), data.begin()));
+      CHECK_TRUE(std::equal(compare.rbegin(), compare.rend(), data.rbegin()));
+
+      while (!data.empty())
+      {
+        CHECK_EQUAL(compare.back(), data.back());
+        data.pop_back();
+        compare.pop_back();
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_index_and_at)
+    {
+      Pool pool;
+      Data data(pool);
+
+      data.push_back(2);
+      data.push_back(3);
+      data.push_front(1);
+      data.push_front(0);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), data[i]);
+        CHECK_EQUAL(int(i), data.at(i));
+      }
+
+      CHECK_THROW(data.at(4), etl::segmented_deque_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      Pool pool;
+      Data data(pool);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(i);
+      }
+
+      Data::iterator       itr  = data.begin();
+      Data::const_iterator citr = data.cbegin();
+
+      CHECK_EQUAL(10, data.end() - data.begin());
+      CHECK_EQUAL(5, *(itr + 5));
+      CHECK_EQUAL(5, *(5 + citr));
+      CHECK_EQUAL(7, itr[7]);
+      CHECK(itr < (itr + 1));
+      CHECK((data.end() - 1) > itr);
+
+      itr += 9;
+      CHECK_EQUAL(9, *itr);
+      itr -= 9;
+      CHECK(itr == data.begin());
+
+      citr = data.begin();
+      CHECK(citr == data.cbegin());
+
+      std::vector<int> reversed(data.rbegin(), data.rend());
+      CHECK_EQUAL(9, reversed.front());
+      CHECK_EQUAL(0, reversed.back());
+    }
+
+    //*************************************************************************
+    TEST(test_iterator_stability)
+    {
+      Pool pool;
+      Data data(pool);
+
+      data.push_back(100);
+      Data::iterator itr = data.begin();
+      int* p = &data.front();
+
+      for (int i = 0; i < 7; ++i)
+      {
+        data.push_back(i);
+        data.push_front(-i);
+      }
+
+      CHECK_EQUAL(100, *itr);
+      CHECK_EQUAL(p, &*itr);
+
+      for (int i = 0; i < 7; ++i)
+      {
+        data.pop_back();
+        data.pop_front();
+      }
+
+      CHECK_EQUAL(1U, data.size());
+      CHECK(itr == data.begin());
+      CHECK_EQUAL(p, &data.front());
+      CHECK_EQUAL(100, *itr);
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      Pool pool;
+      Data data(pool);
+      std::deque<int> compare;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data.push_back(i);
+        compare.push_back(i);
+
+        if (compare.size() > 6U)
+        {
+          data.pop_front();
+          compare.pop_front();
+        }
+
+        CHECK_TRUE(std::equal(compare.begin(), compare.end(), data.begin()));
+        CHECK(data.block_count() <= 3U);
+      }
+
+      CHECK_EQUAL(6, data.end() - data.begin());
+    }
+
+    //*************************************************************************
+    TEST(test_shared_pool)
+    {
+      Pool8 pool;
+      Data data1(pool);
+      Data data2(pool);
+
+      data1.push_back(1);
+      data2.push_back(2);
+      CHECK_EQUAL(2U, pool.size());
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data1.push_back(i);
+      }
+
+      CHECK_EQUAL(2U, data1.block_count());
+      CHECK_EQUAL(1U, data2.block_count());
+      CHECK_EQUAL(3U, pool.size());
+
+      data1.clear();
+      CHECK_EQUAL(1U, pool.size());
+
+      data2.pop_front();
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_pool_exhausted)
+    {
+      etl::pool<Data::pool_type, 1> pool;
+      Data data1(pool);
+      Data data2(pool);
+
+      data1.push_back(1);
+      CHECK_THROW(data2.push_back(2), etl::pool_no_allocation);
+      CHECK_TRUE(data2.empty());
+
+      data1.pop_back();
+      data2.push_back(2);
+      CHECK_EQUAL(2, data2.front());
+    }
+
+    //*************************************************************************
+    TEST(test_full_and_empty)
+    {
+      Pool pool;
+      Data data(pool);
+
+      CHECK_THROW(data.pop_back(), etl::segmented_deque_empty);
+      CHECK_THROW(data.pop_front(), etl::segmented_deque_empty);
+      CHECK_THROW(data.front(), etl::segmented_deque_empty);
+
+      for (int i = 0; i < 15; ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK_THROW(data.push_back(15), etl::segmented_deque_full);
+      CHECK_THROW(data.push_front(15), etl::segmented_deque_full);
+      CHECK_EQUAL(15U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial_type)
+    {
+      PoolNDC pool;
+
+      {
+        DataNDC data(pool);
+
+        data.push_back(ItemNDC("1"));
+        data.push_front(ItemNDC("0"));
+        data.emplace_back("2");
+        data.emplace_front("-1");
+
+        CHECK_EQUAL(4U, data.size());
+        CHECK_EQUAL(ItemNDC("-1"), data.front());
+        CHECK_EQUAL(ItemNDC("2"), data.back());
+
+        DataNDC copy(data);
+        CHECK_TRUE(copy == data);
+
+        copy.pop_back();
+        CHECK_TRUE(copy != data);
+
+        copy = data;
+        CHECK_TRUE(copy == data);
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+  }
+}
@@ -0,0 +1,339 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/small_vector.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+#include "data.h"
+
+#include <vector>
+#include <string>
+#include <algorithm>
+
+namespace
+{
+  SUITE(test_small_vector)
+  {
+    typedef TestDataNDC<std::string> ItemNDC;
+
+    typedef etl::small_vector<int, 4> Data;
+    typedef etl::ismall_vector<int>   IData;
+    typedef etl::fixed_sized_memory_block_allocator<sizeof(int) * 64, alignof(int), 4> Allocator;
+
+    typedef etl::small_vector<ItemNDC, 2> DataNDC;
+    typedef etl::fixed_sized_memory_block_allocator<sizeof(ItemNDC) * 16, alignof(ItemNDC), 4> AllocatorNDC;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Allocator allocator;
+      Data data(allocator);
+
+      CHECK_TRUE(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(4U, data.capacity());
+      CHECK_EQUAL(4U, data.internal_capacity_size());
+      CHECK_TRUE(data.is_internal());
+      CHECK(&allocator == data.get_allocator());
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_spills_to_allocator)
+    {
+      Allocator allocator;
+      Data data(allocator);
+      std::vector<int> compare;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data.push_back(i);
+        compare.push_back(i);
+      }
+
+      CHECK_TRUE(data.is_internal());
+
+      for (int i = 4; i < 64; ++i)
+      {
+        data.push_back(i);
+        compare.push_back(i);
+      }
+
+      CHECK_FALSE(data.is_internal());
+      CHECK_EQUAL(64U, data.capacity());
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK_TRUE(std::equal(compare.begin(), compare.end(), data.begin()));
+
+      CHECK_THROW(data.push_back(64), etl::small_vector_full);
+      CHECK_EQUAL(64U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_growth_falls_back_to_required_size)
+    {
+      Allocator allocator;
+      Data data(allocator);
+
+      data.resize(40, 1);
+      CHECK_EQUAL(40U, data.capacity());
+
+      // Doubling to 80 is more than the block size, so exactly 64 is requested.
+      data.resize(64, 2);
+      CHECK_EQUAL(64U, data.capacity());
+      CHECK_EQUAL(1, data[39]);
+      CHECK_EQUAL(2, data[40]);
+    }
+
+    //*************************************************************************
+    TEST(test_no_allocator)
+    {
+      Data data;
+
+      data.assign(4U, 7);
+      CHECK_EQUAL(4U, data.max_size());
+      CHECK_THROW(data.push_back(8), etl::small_vector_full);
+      CHECK_EQUAL(4U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_own_element)
+    {
+      Allocator allocator;
+      Data data(allocator);
+
+      data.assign(4U, 5);
+      data.push_back(data.front());
+
+      CHECK_EQUAL(5U, data.size());
+      CHECK_EQUAL(5, data.back());
+    }
+
+    //*************************************************************************
+    TEST(test_shrink_to_fit_returns_block)
+    {
+      Allocator allocator;
+      Data data(allocator);
+      Data other(allocator);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(i);
+      }
+
+      data.resize(3);
+      CHECK_FALSE(data.is_internal());
+
+      data.shrink_to_fit();
+      CHECK_TRUE(data.is_internal());
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2, data.back());
+
+      // The released block can be used again.
+      other.reserve(64);
+      data.reserve(64);
+      CHECK_EQUAL(64U, data.capacity());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_erase)
+    {
+      Allocator allocator;
+      Data data(allocator);
+      std::vector<int> compare;
+
+      const int initial[] = { 0, 1, 2 };
+      data.assign(initial, initial + 3);
+      compare.assign(initial, initial + 3);
+
+      data.insert(data.begin() + 1, 10);
+      compare.insert(compare.begin() + 1, 10);
+
+      data.insert(data.end(), 11);
+      compare.insert(compare.end(), 11);
+
+      data.insert(data.begin(), 3U, 12);
+      compare.insert(compare.begin(), 3U, 12);
+
+      data.insert(data.begin() + 6, initial, initial + 3);
+      compare.insert(compare.begin() + 6, initial, initial + 3);
+
+      data.insert(data.begin() + 2, initial, initial + 3);
+      compare.insert(compare.begin() + 2, initial, initial + 3);
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK_TRUE(std::equal(compare.begin(), compare.end(), data.begin()));
+
+      data.erase(data.begin() + 3);
+      compare.erase(compare.begin() + 3);
+
+      data.erase(data.begin() + 1, data.begin() + 5);
+      compare.erase(compare.begin() + 1, compare.begin() + 5);
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK_TRUE(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      Allocator allocator;
+      Data data(allocator);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(i);
+      }
+
+      Data copy(data);
+      CHECK_TRUE(copy == data);
+      CHECK(copy.get_allocator() == &allocator);
+
+      const int* p = data.data();
+      Data moved(etl::move(data));
+
+      // The block is taken rather than copied.
+      CHECK_EQUAL(p, moved.data());
+      CHECK_TRUE(data.empty());
+      CHECK_TRUE(data.is_internal());
+      CHECK_TRUE(moved == copy);
+
+      Data small(allocator);
+      small.push_back(1);
+      Data small_moved(etl::move(small));
+      CHECK_EQUAL(1U, small_moved.size());
+      CHECK_TRUE(small_moved.is_internal());
+
+      copy = small_moved;
+      CHECK_TRUE(copy == small_moved);
+      CHECK_TRUE(moved < copy);
+    }
+
+    //*************************************************************************
+    TEST(test_interface_reference)
+    {
+      Allocator allocator;
+      Data data(allocator);
+      IData& idata = data;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        idata.push_back(i);
+      }
+
+      CHECK_EQUAL(20U, data.size());
+      CHECK_EQUAL(19, *data.rbegin());
+      CHECK_EQUAL(5, idata.at(5));
+      CHECK_THROW(idata.at(20), etl::small_vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_chain)
+    {
+      etl::fixed_sized_memory_block_allocator<sizeof(int) * 8, alignof(int), 1>    small_blocks;
+      etl::fixed_sized_memory_block_allocator<sizeof(int) * 1024, alignof(int), 2> large_blocks;
+
+      small_blocks.set_successor(large_blocks);
+
+      Data data(small_blocks);
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK_EQUAL(1000U, data.size());
+      CHECK_TRUE(large_blocks.is_owner_of(data.data()));
+      CHECK_EQUAL(999, data.back());
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial_type)
+    {
+      AllocatorNDC allocator;
+      DataNDC data(allocator);
+      std::vector<ItemNDC> compare;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(ItemNDC(std::to_string(i)));
+        compare.push_back(ItemNDC(std::to_string(i)));
+      }
+
+      data.emplace_back("10");
+      compare.emplace_back("10");
+
+      data.insert(data.begin() + 2, ItemNDC("a"));
+      compare.insert(compare.begin() + 2, ItemNDC("a"));
+
+      data.erase(data.begin());
+      compare.erase(compare.begin());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK_TRUE(std::equal(compare.begin(), compare.end(), data.begin()));
+
+      data.resize(2, ItemNDC("x"));
+      data.shrink_to_fit();
+      CHECK_TRUE(data.is_internal());
+      CHECK_EQUAL(compare[0], data[0]);
+      CHECK_EQUAL(compare[1], data[1]);
+
+      data.pop_back();
+      data.pop_back();
+      CHECK_THROW(data.pop_back(), etl::small_vector_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_nothing_non_trivial_type)
+    {
+      // std::string empties itself when move assigned to itself.
+      etl::small_vector<std::string, 3> data;
+
+      data.push_back("a");
+      data.push_back("b");
+
+      const std::string* empty = ETL_NULLPTR;
+
+      etl::small_vector<std::string, 3>::iterator itr = data.insert(data.begin(), 0U, std::string("X"));
+      CHECK(itr == data.begin());
+
+      itr = data.insert(data.begin(), empty, empty);
+      CHECK(itr == data.begin());
+
+      itr = data.insert(data.begin() + 1, 0U, std::string("X"));
+      CHECK(itr == data.begin() + 1);
+
+      itr = data.insert(data.end(), empty, empty);
+      CHECK(itr == data.end());
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("a"), data[0]);
+      CHECK_EQUAL(std::string("b"), data[1]);
+    }
+  }
+}
@@ -31,6 +31,8 @@ SOFTWARE.
 #include "etl/standard_deviation.h"
 
 #include <array>
+#include <random>
+#include <vector>
 
 namespace
 {
@@ -51,6 +53,61 @@ namespace
     0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0
   };
 
+  //*********************************
+  // Values spread evenly over [-range, range].
+  template <typename T>
+  std::vector<T> make_values(uint32_t seed, size_t size, int32_t range)
+  {
+    std::mt19937 generator(seed);
+    std::vector<T> values;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      values.push_back(T(int32_t(generator() % uint32_t((2 * range) + 1)) - range));
+    }
+
+    return values;
+  }
+
+  //*********************************
+  // Values with a mean of about 1000 and a standard deviation of about 1.
+  std::vector<float> make_large_window(uint32_t seed, size_t size)
+  {
+    std::mt19937 generator(seed);
+    std::vector<float> values;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      values.push_back(1000.0f + (float(int32_t(generator() % 2001U) - 1000) / 577.0f));
+    }
+
+    return values;
+  }
+
+  //*********************************
+  // The sum of squared deviations from the mean, in two passes.
+  template <typename T>
+  double reference_m2(const std::vector<T>& values)
+  {
+    double mean = 0.0;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      mean += double(values[i]);
+    }
+
+    mean /= double(values.size());
+
+    double m2 = 0.0;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      m2 += (double(values[i]) - mean) * (double(values[i]) - mean);
+    }
+
+    return m2;
+  }
+
   SUITE(test_standard_deviation)
   {
     //*************************************************************************
@@ -160,5 +217,65 @@ namespace
       variance_result = standard_deviation.get_variance();
       CHECK_CLOSE(9.17, variance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_standard_deviation_add_span_int16)
+    {
+      std::vector<int16_t> values = make_values<int16_t>(4U, 1003U, 32767);
+
+      etl::standard_deviation<etl::standard_deviation_type::Population, int16_t, int64_t> by_value(values.begin(), values.end());
+      etl::standard_deviation<etl::standard_deviation_type::Population, int16_t, int64_t> by_span;
+      by_span.add(etl::span<const int16_t>(values.data(), values.size()));
+
+      const double expected = sqrt(reference_m2(values) / double(values.size()));
+
+      CHECK_EQUAL(values.size(), by_span.count());
+      CHECK_EQUAL(by_value.get_standard_deviation(), by_span.get_standard_deviation());
+      CHECK_CLOSE(expected, by_span.get_standard_deviation(), expected * 1e-9);
+    }
+
+    //*************************************************************************
+    TEST(test_standard_deviation_add_span_large_window)
+    {
+      std::vector<float> values = make_large_window(5U, 100000U);
+
+      etl::standard_deviation<etl::standard_deviation_type::Sample, float> by_value(values.begin(), values.end());
+      etl::standard_deviation<etl::standard_deviation_type::Sample, float> by_span;
+      by_span.add(etl::span<const float>(values.data(), values.size()));
+
+      const double expected = sqrt(reference_m2(values) / double(values.size() - 1U));
+
+      CHECK_EQUAL(values.size(), by_span.count());
+      CHECK_CLOSE(expected, by_span.get_standard_deviation(), 1e-6);
+      CHECK_CLOSE(expected, by_value.get_standard_deviation(), 1e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_standard_deviation_merge)
+    {
+      std::vector<float> values1 = make_large_window(6U, 5000U);
+      std::vector<float> values2 = make_large_window(7U, 3000U);
+
+      // The second part is moved, so the parts have different means.
+      for (size_t i = 0U; i < values2.size(); ++i)
+      {
+        values2[i] += 10.0f;
+      }
+
+      etl::standard_deviation<etl::standard_deviation_type::Sample, float> part1;
+      etl::standard_deviation<etl::standard_deviation_type::Sample, float> part2;
+      part1.add(etl::span<const float>(values1.data(), values1.size()));
+      part2.add(etl::span<const float>(values2.data(), values2.size()));
+
+      part1.merge(part2);
+
+      std::vector<float> all(values1);
+      all.insert(all.end(), values2.begin(), values2.end());
+
+      const double expected = sqrt(reference_m2(all) / double(all.size() - 1U));
+
+      CHECK_EQUAL(all.size(), part1.count());
+      CHECK_CLOSE(expected, part1.get_standard_deviation(), 1e-6);
+    }
   }
 }
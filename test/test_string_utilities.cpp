@@ -996,6 +996,102 @@ namespace
       CHECK(expected == text);
     }
 
+    //*************************************************************************
+    TEST(test_tokenizer_matches_get_token)
+    {
+      String text(STR(",,,The,cat; sat,,on the;mat,,,"));
+
+      for (int ignore = 0; ignore < 2; ++ignore)
+      {
+        Vector expected;
+        Vector tokens;
+
+        etl::optional<StringView> token;
+
+        while ((token = etl::get_token(text, STR(",; "), token, ignore == 1)))
+        {
+          expected.emplace_back(token.value());
+        }
+
+        etl::tokenizer<StringView> tokenizer(STR(",; "), ignore == 1);
+        tokenizer.set_input(StringView(text.data(), text.size()));
+
+        while ((token = tokenizer.next()))
+        {
+          tokens.emplace_back(token.value());
+        }
+
+        CHECK(tokenizer.done());
+        CHECK(expected == tokens);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_tokenizer_reuse)
+    {
+      etl::tokenizer<StringView> tokenizer(STR(" "), true);
+
+      CHECK(tokenizer.is_delimiter(STR(' ')));
+      CHECK(!tokenizer.is_delimiter(STR('a')));
+      CHECK(tokenizer.done());
+      CHECK(!tokenizer.next().has_value());
+
+      tokenizer.set_input(StringView(STR("  The cat ")));
+      CHECK(StringView(STR("The")) == tokenizer.next().value());
+      CHECK(StringView(STR("cat")) == tokenizer.next().value());
+      CHECK(!tokenizer.next().has_value());
+
+      tokenizer.set_input(StringView(STR("sat")));
+      CHECK(StringView(STR("sat")) == tokenizer.next().value());
+      CHECK(!tokenizer.next().has_value());
+
+      tokenizer.set_input(StringView(STR("")));
+      CHECK(!tokenizer.next().has_value());
+    }
+
+    //*************************************************************************
+    TEST(test_tokenizer_split_into)
+    {
+      StringView text(STR("The,cat,sat,,on,the,mat"));
+
+      StringView views[4];
+      etl::span<StringView> tokens(views);
+
+      etl::tokenizer<StringView> tokenizer(STR(","), false);
+      tokenizer.set_input(text);
+
+      CHECK_EQUAL(4U, tokenizer.split_into(tokens));
+      CHECK(StringView(STR("The")) == views[0]);
+      CHECK(StringView(STR("cat")) == views[1]);
+      CHECK(StringView(STR("sat")) == views[2]);
+      CHECK(StringView(STR(""))    == views[3]);
+
+      // Continues from where it stopped.
+      CHECK_EQUAL(3U, tokenizer.split_into(tokens));
+      CHECK(StringView(STR("on"))  == views[0]);
+      CHECK(StringView(STR("the")) == views[1]);
+      CHECK(StringView(STR("mat")) == views[2]);
+
+      CHECK_EQUAL(0U, tokenizer.split_into(tokens));
+    }
+
+    //*************************************************************************
+    TEST(test_split_into)
+    {
+      String text(STR(",,,The,cat,sat,,on,the,mat,,,"));
+
+      StringView views[10];
+      etl::span<StringView> tokens(views);
+
+      CHECK_EQUAL(6U, etl::split_into(text, tokens, STR(","), true));
+      CHECK(StringView(STR("The")) == views[0]);
+      CHECK(StringView(STR("mat")) == views[5]);
+
+      CHECK_EQUAL(10U, etl::split_into(text, tokens, STR(","), false));
+      CHECK(StringView(STR(""))    == views[0]);
+      CHECK(StringView(STR("The")) == views[3]);
+    }
+
     //*************************************************************************
     TEST(test_get_token_delimiters_ignore_empty_tokens)
     {
@@ -989,6 +989,59 @@ namespace
       CHECK(expected == text);
     }
 
+    //*************************************************************************
+    TEST(test_tokenizer_matches_get_token)
+    {
+      String text(STR(",,,The,cat; sat,,on the;mat,,,"));
+
+      for (int ignore = 0; ignore < 2; ++ignore)
+      {
+        Vector expected;
+        Vector tokens;
+
+        etl::optional<StringView> token;
+
+        while ((token = etl::get_token(text, STR(",; "), token, ignore == 1)))
+        {
+          expected.emplace_back(token.value());
+        }
+
+        etl::tokenizer<StringView> tokenizer(STR(",; "), ignore == 1);
+        tokenizer.set_input(StringView(text.data(), text.size()));
+
+        while ((token = tokenizer.next()))
+        {
+          tokens.emplace_back(token.value());
+        }
+
+        CHECK(tokenizer.done());
+        CHECK(expected == tokens);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_tokenizer_reuse)
+    {
+      etl::tokenizer<StringView> tokenizer(STR(" "), true);
+
+      CHECK(tokenizer.is_delimiter(STR(' ')));
+      CHECK(!tokenizer.is_delimiter(STR('a')));
+      CHECK(tokenizer.done());
+      CHECK(!tokenizer.next().has_value());
+
+      tokenizer.set_input(StringView(STR("  The cat ")));
+      CHECK(StringView(STR("The")) == tokenizer.next().value());
+      CHECK(StringView(STR("cat")) == tokenizer.next().value());
+      CHECK(!tokenizer.next().has_value());
+
+      tokenizer.set_input(StringView(STR("sat")));
+      CHECK(StringView(STR("sat")) == tokenizer.next().value());
+      CHECK(!tokenizer.next().has_value());
+
+      tokenizer.set_input(StringView(STR("")));
+      CHECK(!tokenizer.next().has_value());
+    }
+
     //*************************************************************************
     TEST(test_get_token_delimiters_ignore_empty_tokens)
     {
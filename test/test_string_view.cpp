@@ -1014,6 +1014,63 @@ namespace
       CHECK(View::npos == view.find_first_not_of(s6, 0, 8));
     }
 
+    //*************************************************************************
+    TEST(test_find_functions_match_std)
+    {
+      const char text[] = "abcab\xE9" "cabcd\x80" "abcabd";
+
+      View view(text);
+      std::string compare_view(text);
+
+      const char* patterns[] = { "", "a", "ab", "abc", "abd", "cab", "\xE9", "\xE9" "c", "d\x80", "abcabd", "zz" };
+      const char* sets[]     = { "", "a", "ba", "cb\xE9", "\x80", "abc", "abcd\x80\xE9", "xyz" };
+
+      for (size_t position = 0UL; position <= view.size() + 1UL; ++position)
+      {
+        for (const char* pattern : patterns)
+        {
+          CHECK_EQUAL(compare_view.find(pattern, position), view.find(pattern, position));
+        }
+
+        for (const char* set : sets)
+        {
+          CHECK_EQUAL(compare_view.find_first_of(set, position),     view.find_first_of(set, position));
+          CHECK_EQUAL(compare_view.find_first_not_of(set, position), view.find_first_not_of(set, position));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_rfind_not_found_before_position)
+    {
+      View view("abcdefabc");
+
+      CHECK_EQUAL(View::npos, view.rfind("x", 3));
+      CHECK_EQUAL(View::npos, view.rfind("def", 5));
+      CHECK_EQUAL(3U, view.rfind("def", 6));
+      CHECK_EQUAL(6U, view.rfind("abc"));
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_find_constexpr)
+    {
+      constexpr View view("Hello World");
+
+      constexpr size_t position1 = view.find("World");
+      constexpr size_t position2 = view.find('o', 5U);
+      constexpr size_t position3 = view.rfind("o");
+      constexpr size_t position4 = view.find_first_of("dlr");
+      constexpr size_t position5 = view.find_first_not_of("Hel");
+
+      CHECK_EQUAL(6U, position1);
+      CHECK_EQUAL(7U, position2);
+      CHECK_EQUAL(7U, position3);
+      CHECK_EQUAL(2U, position4);
+      CHECK_EQUAL(4U, position5);
+    }
+#endif
+
     //*************************************************************************
     TEST(test_find_last_not_of)
     {
@@ -31,6 +31,9 @@ SOFTWARE.
 #include <stdint.h>
 #include <string>
 #include <vector>
+#include <atomic>
+#include <thread>
+#include <functional>
 
 #include "etl/task.h"
 #include "etl/scheduler.h"
@@ -53,6 +56,7 @@ struct Common
   void Clear()
   {
     workList.clear();
+    task_ready_callback = nullptr;
   }
 
   //*********************************************
@@ -72,6 +76,7 @@ struct Common
   etl::function<Common, void> watchdog_callback;
   etl::ischeduler* pScheduler;
   bool watchdog_called;
+  std::function<void(etl::task&)> task_ready_callback;
 };
 
 //*****************************************************************************
@@ -127,6 +132,11 @@ public:
     if (workIndex == addAtIndex)
     {
       pTaskToAddTo->work.push_back(workToAdd);
+
+      if (common.task_ready_callback)
+      {
+        common.task_ready_callback(*pTaskToAddTo);
+      }
     }
   }
 
@@ -161,10 +171,111 @@ Task task3(3, work3, common);
 
 etl::task* taskList[] = { &task1, &task2, &task3 };
 
-typedef etl::scheduler<etl::scheduler_policy_sequential_single,   sizeof(etl::array_size(taskList))> SchedulerSequentialSingle;
-typedef etl::scheduler<etl::scheduler_policy_sequential_multiple, sizeof(etl::array_size(taskList))> SchedulerSequentialMultiple;
-typedef etl::scheduler<etl::scheduler_policy_highest_priority,    sizeof(etl::array_size(taskList))> SchedulerHighestPriority;
-typedef etl::scheduler<etl::scheduler_policy_most_work,           sizeof(etl::array_size(taskList))> SchedulerMostWork;
+typedef etl::scheduler<etl::scheduler_policy_sequential_single,      sizeof(etl::array_size(taskList))> SchedulerSequentialSingle;
+typedef etl::scheduler<etl::scheduler_policy_sequential_multiple,    sizeof(etl::array_size(taskList))> SchedulerSequentialMultiple;
+typedef etl::scheduler<etl::scheduler_policy_highest_priority,       sizeof(etl::array_size(taskList))> SchedulerHighestPriority;
+typedef etl::scheduler<etl::scheduler_policy_most_work,              sizeof(etl::array_size(taskList))> SchedulerMostWork;
+typedef etl::scheduler<etl::scheduler_policy_highest_priority_ready, sizeof(etl::array_size(taskList))> SchedulerHighestPriorityReady;
+
+#if ETL_HAS_ATOMIC
+typedef etl::scheduler_work_stealing<sizeof(etl::array_size(taskList)), 1> SchedulerWorkStealingSingle;
+
+//*****************************************************************************
+struct CounterCommon
+{
+  //*********************************************
+  CounterCommon()
+    : idle_callback(*this, &CounterCommon::IdleCallback)
+    , total_work(0)
+    , processed(0)
+    , overlapped(false)
+    , pScheduler(nullptr)
+  {
+  }
+
+  //*********************************************
+  void IdleCallback()
+  {
+    if (processed.load() == total_work)
+    {
+      pScheduler->exit_scheduler();
+    }
+  }
+
+  etl::function<CounterCommon, void> idle_callback;
+  int total_work;
+  std::atomic<int> processed;
+  std::atomic<bool> overlapped;
+  etl::ischeduler* pScheduler;
+};
+
+//*****************************************************************************
+class CounterTask : public etl::task
+{
+public:
+
+  //*********************************************
+  CounterTask(etl::task_priority_t priority_, int work_, CounterCommon& common_)
+    : task(priority_)
+    , remaining(work_)
+    , busy(false)
+    , common(common_)
+  {
+    common.total_work += work_;
+  }
+
+  //*********************************************
+  virtual uint32_t task_request_work() const ETL_OVERRIDE
+  {
+    return uint32_t(remaining.load());
+  }
+
+  //*********************************************
+  virtual void task_process_work() ETL_OVERRIDE
+  {
+    if (busy.exchange(true))
+    {
+      common.overlapped = true;
+    }
+
+    --remaining;
+    ++common.processed;
+
+    busy = false;
+  }
+
+  std::atomic<int>  remaining;
+  std::atomic<bool> busy;
+  CounterCommon&    common;
+};
+
+//*****************************************************************************
+// Exits the scheduler when it is idle after the producer has finished.
+// A lost ready flag leaves work unprocessed, rather than hanging the test.
+struct ProducerCommon
+{
+  //*********************************************
+  ProducerCommon()
+    : idle_callback(*this, &ProducerCommon::IdleCallback)
+    , producer_done(false)
+    , pScheduler(nullptr)
+  {
+  }
+
+  //*********************************************
+  void IdleCallback()
+  {
+    if (producer_done.load())
+    {
+      pScheduler->exit_scheduler();
+    }
+  }
+
+  etl::function<ProducerCommon, void> idle_callback;
+  std::atomic<bool> producer_done;
+  etl::ischeduler* pScheduler;
+};
+#endif
 
 namespace
 {
@@ -287,5 +398,178 @@ namespace
       CHECK(expected == common.workList);
       CHECK(common.watchdog_called);
     }
+
+    //*************************************************************************
+    TEST(test_scheduler_highest_priority_ready)
+    {
+      SchedulerHighestPriorityReady s;
+
+      task1.Reset();
+      task2.Reset();
+      task3.Reset();
+
+      task2.WorkToAdd(2, "T3W3", task3);
+
+      common.Clear();
+      common.pScheduler = &s;
+      common.task_ready_callback = [&s](etl::task& task) { s.set_task_ready(task); };
+
+      s.set_idle_callback(common.idle_callback);
+      s.set_watchdog_callback(common.watchdog_callback);
+      s.add_task_list(taskList, ETL_OR_STD17::size(taskList));
+      s.start(); // If 'start' returns then the idle callback was successfully called.
+
+      WorkList_t expected = { "T3W1", "T3W2", "T2W1", "T2W2", "T3W3", "T2W3", "T2W4", "T1W1", "T1W2", "T1W3" };
+
+      CHECK(expected == common.workList);
+      CHECK(common.watchdog_called);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_highest_priority_ready_not_signalled)
+    {
+      SchedulerHighestPriorityReady s;
+
+      task1.Reset();
+      task2.Reset();
+      task3.Reset();
+
+      task2.WorkToAdd(2, "T3W3", task3);
+
+      common.Clear();
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.set_watchdog_callback(common.watchdog_callback);
+      s.add_task_list(taskList, ETL_OR_STD17::size(taskList));
+      s.start(); // If 'start' returns then the idle callback was successfully called.
+
+      // Task 3 was not marked as ready, so its new work is not processed.
+      WorkList_t expected = { "T3W1", "T3W2", "T2W1", "T2W2", "T2W3", "T2W4", "T1W1", "T1W2", "T1W3" };
+
+      CHECK(expected == common.workList);
+      CHECK_EQUAL(1U, task3.task_request_work());
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    TEST(test_scheduler_highest_priority_ready_set_from_another_thread)
+    {
+      const int Work = 100000;
+
+      CounterCommon  counter_common;
+      ProducerCommon producer_common;
+      CounterTask    low(1, 0, counter_common);
+      CounterTask    high(2, 0, counter_common);
+
+      etl::task* counter_list[] = { &low, &high };
+
+      etl::scheduler<etl::scheduler_policy_highest_priority_ready, 2> s;
+
+      producer_common.pScheduler = &s;
+
+      s.set_idle_callback(producer_common.idle_callback);
+      s.add_task_list(counter_list, ETL_OR_STD17::size(counter_list));
+
+      // The producer gives work to both tasks while the scheduler clears their ready flags.
+      std::thread producer([&]()
+      {
+        for (int i = 0; i < Work; ++i)
+        {
+          CounterTask& task = ((i % 2) == 0) ? low : high;
+
+          ++task.remaining;
+          s.set_task_ready(task);
+        }
+
+        producer_common.producer_done = true;
+      });
+
+      s.start();
+      producer.join();
+
+      CHECK_EQUAL(Work, counter_common.processed.load());
+      CHECK_EQUAL(0, low.remaining.load());
+      CHECK_EQUAL(0, high.remaining.load());
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_work_stealing_single_worker)
+    {
+      SchedulerWorkStealingSingle s;
+
+      task1.Reset();
+      task2.Reset();
+      task3.Reset();
+
+      task2.WorkToAdd(2, "T3W3", task3);
+
+      common.Clear();
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.set_watchdog_callback(common.watchdog_callback);
+      s.add_task_list(taskList, ETL_OR_STD17::size(taskList));
+      s.start(); // If 'start' returns then the idle callback was successfully called.
+
+      // A single worker runs in the same order as 'highest priority'.
+      WorkList_t expected = { "T3W1", "T3W2", "T2W1", "T2W2", "T3W3", "T2W3", "T2W4", "T1W1", "T1W2", "T1W3" };
+
+      CHECK(expected == common.workList);
+      CHECK(common.watchdog_called);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_work_stealing_multiple_workers)
+    {
+      static const size_t Workers = 4U;
+
+      CounterCommon counterCommon;
+
+      // The tasks are shared between the workers in priority order.
+      // Workers that run out of their own work steal from the others.
+      CounterTask ct1(1, 1000, counterCommon);
+      CounterTask ct2(2, 2000, counterCommon);
+      CounterTask ct3(3, 500,  counterCommon);
+      CounterTask ct4(4, 1500, counterCommon);
+      CounterTask ct5(5, 0,    counterCommon);
+      CounterTask ct6(6, 0,    counterCommon);
+
+      etl::task* counterTasks[] = { &ct1, &ct2, &ct3, &ct4, &ct5, &ct6 };
+
+      etl::scheduler_work_stealing<ETL_OR_STD17::size(counterTasks), Workers> s;
+
+      counterCommon.pScheduler = &s;
+
+      s.set_idle_callback(counterCommon.idle_callback);
+      s.add_task_list(counterTasks, ETL_OR_STD17::size(counterTasks));
+
+      std::thread t1(&decltype(s)::run_worker, &s, 1U);
+      std::thread t2(&decltype(s)::run_worker, &s, 2U);
+      std::thread t3(&decltype(s)::run_worker, &s, 3U);
+
+      s.start(); // If 'start' returns then all of the work was done.
+
+      t1.join();
+      t2.join();
+      t3.join();
+
+      CHECK_EQUAL(counterCommon.total_work, counterCommon.processed.load());
+      CHECK_EQUAL(0, ct1.remaining.load());
+      CHECK_EQUAL(0, ct2.remaining.load());
+      CHECK_EQUAL(0, ct3.remaining.load());
+      CHECK_EQUAL(0, ct4.remaining.load());
+      CHECK_FALSE(counterCommon.overlapped.load());
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_work_stealing_invalid_worker)
+    {
+      SchedulerWorkStealingSingle s;
+
+      CHECK_THROW(s.run_worker(0U), etl::scheduler_invalid_worker_exception);
+      CHECK_THROW(s.run_worker(1U), etl::scheduler_invalid_worker_exception);
+    }
+#endif
   }
 }
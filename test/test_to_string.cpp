@@ -326,6 +326,22 @@ namespace
       CHECK(etl::string<20>(STR("20.0")) ==    etl::to_string(19.999999, str, Format().precision(1).width(4).right()));
     }
 
+    //*************************************************************************
+    TEST(test_floating_point_exact)
+    {
+      etl::string<40> str;
+
+      CHECK(etl::string<40>(STR("0.10000000000000000555")) == etl::to_string(0.1, str, Format().precision(20)));
+      CHECK(etl::string<40>(STR("100000000000000000000")) == etl::to_string(1e20, str, Format().precision(0)));
+      CHECK(etl::string<40>(STR("-123456789012.50")) == etl::to_string(-123456789012.5, str, Format().precision(2)));
+      CHECK(etl::string<40>(STR("0.000000000000000000010")) == etl::to_string(1e-20, str, Format().precision(21)));
+
+      // Exact ties round half to even.
+      CHECK(etl::string<40>(STR("2")) == etl::to_string(2.5, str, Format().precision(0)));
+      CHECK(etl::string<40>(STR("0.12")) == etl::to_string(0.125, str, Format().precision(2)));
+      CHECK(etl::string<40>(STR("0.38")) == etl::to_string(0.375f, str, Format().precision(2)));
+    }
+
     //*************************************************************************
     TEST(test_bool_no_append)
     {
@@ -31,6 +31,8 @@ SOFTWARE.
 #include "etl/variance.h"
 
 #include <array>
+#include <random>
+#include <vector>
 
 namespace
 {
@@ -51,6 +53,61 @@ namespace
     0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0
   };
 
+  //*********************************
+  // Values spread evenly over [-range, range].
+  template <typename T>
+  std::vector<T> make_values(uint32_t seed, size_t size, int32_t range)
+  {
+    std::mt19937 generator(seed);
+    std::vector<T> values;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      values.push_back(T(int32_t(generator() % uint32_t((2 * range) + 1)) - range));
+    }
+
+    return values;
+  }
+
+  //*********************************
+  // Values with a mean of about 1000 and a standard deviation of about 1.
+  std::vector<float> make_large_window(uint32_t seed, size_t size)
+  {
+    std::mt19937 generator(seed);
+    std::vector<float> values;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      values.push_back(1000.0f + (float(int32_t(generator() % 2001U) - 1000) / 577.0f));
+    }
+
+    return values;
+  }
+
+  //*********************************
+  // The sum of squared deviations from the mean, in two passes.
+  template <typename T>
+  double reference_m2(const std::vector<T>& values)
+  {
+    double mean = 0.0;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      mean += double(values[i]);
+    }
+
+    mean /= double(values.size());
+
+    double m2 = 0.0;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      m2 += (double(values[i]) - mean) * (double(values[i]) - mean);
+    }
+
+    return m2;
+  }
+
   SUITE(test_variance)
   {
     //*************************************************************************
@@ -142,5 +199,73 @@ namespace
       variance_result = variance1.get_variance();
       CHECK_CLOSE(9.17, variance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_variance_add_span_int32)
+    {
+      // 1001 is not a multiple of the lane count, so the tail is used.
+      std::vector<int32_t> values = make_values<int32_t>(1U, 1001U, 1000000);
+
+      etl::variance<etl::variance_type::Sample, int32_t, int64_t> by_value(values.begin(), values.end());
+      etl::variance<etl::variance_type::Sample, int32_t, int64_t> by_span;
+      by_span.add(etl::span<const int32_t>(values.data(), values.size()));
+
+      const double expected = reference_m2(values) / double(values.size() - 1U);
+
+      CHECK_EQUAL(values.size(), by_span.count());
+      CHECK_EQUAL(by_value.get_variance(), by_span.get_variance());
+      CHECK_CLOSE(expected, by_span.get_variance(), expected * 1e-9);
+    }
+
+    //*************************************************************************
+    TEST(test_variance_add_span_large_window)
+    {
+      // Summing values and squares in float gives a variance of several units here.
+      std::vector<float> values = make_large_window(2U, 100000U);
+
+      etl::variance<etl::variance_type::Sample, float> by_value(values.begin(), values.end());
+      etl::variance<etl::variance_type::Sample, float> by_span;
+      by_span.add(etl::span<const float>(values.data(), values.size()));
+
+      const double expected = reference_m2(values) / double(values.size() - 1U);
+
+      CHECK_CLOSE(1.0, expected, 0.05);
+      CHECK_EQUAL(values.size(), by_span.count());
+      CHECK_CLOSE(expected, by_span.get_variance(), 1e-6);
+      CHECK_CLOSE(expected, by_value.get_variance(), 1e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_variance_merge)
+    {
+      std::vector<float> values = make_large_window(3U, 10000U);
+
+      etl::variance<etl::variance_type::Population, float> merged;
+      etl::variance<etl::variance_type::Population, float> empty;
+
+      // Uneven parts, including an empty one, added by value and by span.
+      const size_t bounds[] = { 0U, 1U, 1U, 7U, 70U, 1000U, 4321U, 10000U };
+
+      for (size_t i = 1U; i < (sizeof(bounds) / sizeof(bounds[0])); ++i)
+      {
+        etl::variance<etl::variance_type::Population, float> part;
+
+        if ((i % 2U) == 0U)
+        {
+          part.add(values.begin() + bounds[i - 1U], values.begin() + bounds[i]);
+        }
+        else
+        {
+          part.add(etl::span<const float>(values.data() + bounds[i - 1U], bounds[i] - bounds[i - 1U]));
+        }
+
+        merged.merge(part);
+      }
+
+      merged.merge(empty);
+
+      CHECK_EQUAL(values.size(), merged.count());
+      CHECK_CLOSE(reference_m2(values) / double(values.size()), merged.get_variance(), 1e-6);
+    }
   }
 }